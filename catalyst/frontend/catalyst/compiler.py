@@ -14,8 +14,6 @@
 """This module contains functions for lowering, compiling, and linking
 MLIR/LLVM representations.
 """
-import glob
-import importlib
 import logging
 import os
 import pathlib
@@ -32,7 +30,11 @@ from catalyst.logging import debug_logger, debug_logger_init
 from catalyst.pipelines import CompileOptions, KeepIntermediateLevel
 from catalyst.utils.exceptions import CompileError
 from catalyst.utils.filesystem import Directory
-from catalyst.utils.runtime_environment import get_cli_path, get_lib_path
+from catalyst.utils.runtime_environment import (
+    get_cli_path,
+    get_lapack_lib_path,
+    get_lib_path,
+)
 
 logger = logging.getLogger(__name__)
 logger.addHandler(logging.NullHandler())
@@ -116,29 +118,22 @@ class LinkerDriver:
 
         # Discover the LAPACK library provided by scipy & add link against it.
         # Doing this here ensures we will always have the correct library name.
-        lib_name = "openblas"
-        package_name = "scipy_openblas32"
-        path_within_package = "lib"
         file_extension = ".so" if platform.system() == "Linux" else ".dylib"  # pragma: no branch
 
         if platform.system() == "Darwin" and platform.machine() == "arm64":  # pragma: nocover
             # use our own build of LAPACKe to interface with Accelerate
             lapack_lib_name = "lapacke.3"
         else:
-            package_spec = importlib.util.find_spec(package_name)
-            package_directory = path.dirname(package_spec.origin)
-            lapack_lib_path = path.join(package_directory, path_within_package)
-
-            search_pattern = path.join(lapack_lib_path, f"lib*{lib_name}*{file_extension}")
-            search_result = glob.glob(search_pattern)
-            if not search_result:  # pragma: nocover
+            lapack_lib = get_lapack_lib_path()
+            if lapack_lib is None:  # pragma: nocover
                 raise CompileError(
-                    f'Unable to find OpenBLAS library at "{search_pattern}". '
+                    "Unable to find the OpenBLAS library of scipy_openblas32. "
                     "Please ensure that scipy is installed and available via pip."
                 )
 
+            lapack_lib_path = path.dirname(lapack_lib)
             lib_path_flags += [f"-Wl,-rpath,{lapack_lib_path}", f"-L{lapack_lib_path}"]
-            lapack_lib_name = path.basename(search_result[0])[3 : -len(file_extension)]
+            lapack_lib_name = path.basename(lapack_lib)[3 : -len(file_extension)]
 
         system_flags = []
         if platform.system() == "Linux":
@@ -206,8 +201,9 @@ class LinkerDriver:
 
     @staticmethod
     def _attempt_link(compiler, flags, infile, outfile, options):
+        infiles = [infile] if isinstance(infile, str) else list(infile)
         try:
-            command = [compiler] + flags + [infile, "-o", outfile]
+            command = [compiler] + flags + infiles + ["-o", outfile]
             run_writing_command(command, options)
             return True
         except subprocess.CalledProcessError as e:
@@ -239,7 +235,8 @@ class LinkerDriver:
         Link the infile against the necessary libraries and produce the outfile.
 
         Args:
-            infile (str): input file
+            infile (Union[str, List[str]]): input file, or input files such as the object files of
+                a split code generation. The output file is named after the first one.
             outfile (Optional[str]): output file
             flags (Optional[List[str]]): flags to be passed down to the compiler
             fallback_compilers (Optional[List[str]]): name of executables to be looked for in PATH
@@ -247,8 +244,9 @@ class LinkerDriver:
         Raises:
             EnvironmentError: The exception is raised when no compiler succeeded.
         """
+        infiles = [infile] if isinstance(infile, str) else list(infile)
         if outfile is None:
-            outfile = LinkerDriver.get_output_filename(infile)
+            outfile = LinkerDriver.get_output_filename(infiles[0])
         if options is None:
             options = CompileOptions()
         if flags is None:
@@ -256,14 +254,32 @@ class LinkerDriver:
         if fallback_compilers is None:
             fallback_compilers = LinkerDriver._default_fallback_compilers
         for compiler in LinkerDriver._available_compilers(fallback_compilers):
-            success = LinkerDriver._attempt_link(compiler, flags, infile, outfile, options)
+            success = LinkerDriver._attempt_link(compiler, flags, infiles, outfile, options)
             if success:
                 return outfile
-        msg = f"Unable to link {infile}. Please check the output for any error messages. If no "
-        msg += "compiler was found by Catalyst, please specify a compatible one via $CATALYST_CC."
+        msg = f"Unable to link {' '.join(infiles)}. Please check the output for any error "
+        msg += "messages. If no compiler was found by Catalyst, please specify a compatible one "
+        msg += "via $CATALYST_CC."
         raise CompileError(msg)
 
 
+def get_object_files(workspace, module_name):
+    """The object files compiled for a module: ``<module_name>.o``, followed by the partitions of a
+    split code generation, numbered from one as ``<module_name>.<i>.o``. The compiler driver
+    removes the numbered partitions of earlier compilations, so that they are not linked.
+
+    Args:
+        workspace (str): directory of the object files
+        module_name (str): name of the compiled module
+    """
+    object_files = [os.path.join(str(workspace), f"{module_name}.o")]
+    while True:
+        partition = os.path.join(str(workspace), f"{module_name}.{len(object_files)}.o")
+        if not os.path.exists(partition):
+            return object_files
+        object_files.append(partition)
+
+
 def _get_catalyst_cli_cmd(*args, stdin=None):
     """Just get the command, do not run it"""
     cli_path = get_cli_path()
@@ -437,7 +453,6 @@ class Compiler:
             tmp_infile_name = tmp_infile.name
             tmp_infile.write(ir)
 
-        output_object_name = os.path.join(str(workspace), f"{module_name}.o")
         output_ir_name = os.path.join(str(workspace), f"{module_name}.ll")
 
         cmd = self.get_cli_command(tmp_infile_name, output_ir_name, module_name, workspace)
@@ -459,7 +474,7 @@ class Compiler:
         else:
             out_IR = None
 
-        output = LinkerDriver.run(output_object_name, options=self.options)
+        output = LinkerDriver.run(get_object_files(workspace, module_name), options=self.options)
         output_object_name = str(pathlib.Path(output).absolute())
 
         # Clean up temporary files
@@ -50,7 +50,7 @@ from catalyst.device.verification import (
 from catalyst.logging import debug_logger, debug_logger_init
 from catalyst.third_party.cuda import SoftwareQQPP
 from catalyst.utils.exceptions import CompileError
-from catalyst.utils.runtime_environment import get_lib_path
+from catalyst.utils.runtime_environment import get_lapack_lib_path, get_lib_path
 
 logger = logging.getLogger(__name__)
 logger.addHandler(logging.NullHandler())
@@ -192,6 +192,12 @@ def extract_backend_info(
         if k not in device_kwargs:  # pragma: no branch
             device_kwargs[k] = v
 
+    # The MPS device computes its SVDs with LAPACK, which it loads explicitly as the symbols of the
+    # library linked into the program aren't globally visible
+    if device_name == "MPSDevice" and "lapack_library" not in device_kwargs:  # pragma: no cover
+        if lapack_lib := get_lapack_lib_path():
+            device_kwargs["lapack_library"] = lapack_lib
+
     return BackendInfo(dname, device_name, device_lpath, device_kwargs)
 
 
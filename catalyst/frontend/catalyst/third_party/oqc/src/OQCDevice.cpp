@@ -25,13 +25,18 @@ auto OQCDevice::AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType>
     }
 
     builder = std::make_unique<OpenQASM2Builder>();
+    execution_counts.reset();
 
     builder->AddRegisters("qubits", num_qubits, "cbits", num_qubits);
 
     return qubit_manager.AllocateRange(0, num_qubits);
 }
 
-void OQCDevice::ReleaseAllQubits() { builder = std::make_unique<OpenQASM2Builder>(); }
+void OQCDevice::ReleaseAllQubits()
+{
+    builder = std::make_unique<OpenQASM2Builder>();
+    execution_counts.reset();
+}
 
 auto OQCDevice::GetNumQubits() const -> size_t { return builder->getNumQubits(); }
 
@@ -60,19 +65,46 @@ void OQCDevice::NamedOperation(const std::string &name, const std::vector<double
     auto &&dev_wires = getDeviceWires(wires);
 
     builder->AddGate(name, params, dev_wires);
+    execution_counts.reset();
 }
 
 void OQCDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
                               const std::vector<QubitIdType> &wires)
 {
     const size_t numQubits = GetNumQubits();
+    std::iota(eigvals.begin(), eigvals.end(), 0);
+
+    if (batched) {
+        // Submit the circuit measuring all qubits once per execution, and compute the counts of
+        // every request from its results.
+        if (!execution_counts.has_value()) {
+            builder->AddMeasurements();
+            auto &&results = runner->BatchCounts({circuit_cache.get(*builder)}, "",
+                                                 device_shots, numQubits);
+            execution_counts = std::move(results.front());
+        }
+
+        auto &&dev_wires = getDeviceWires(wires);
+        RT_FAIL_IF(counts.size() != (size_t{1} << dev_wires.size()),
+                   "Invalid size for the pre-allocated counts");
+        std::fill(counts.begin(), counts.end(), 0);
+        for (auto &&[state, count] : execution_counts.value()) {
+            // The first wire is the most significant bit of the marginal state
+            size_t idx = 0;
+            for (auto wire : dev_wires) {
+                idx = (idx << 1) | ((state >> wire) & 1U);
+            }
+            counts(idx) += static_cast<int64_t>(count);
+        }
+        return;
+    }
+
     // Add the measurements on the given wires
     for (auto wire : wires) {
         builder->AddMeasurement(wire, wire);
     }
-    std::iota(eigvals.begin(), eigvals.end(), 0);
 
-    auto &&results = runner->Counts(builder->toOpenQASM2(), "", device_shots, GetNumQubits());
+    auto &&results = runner->Counts(circuit_cache.get(*builder), "", device_shots, numQubits);
 
     int i = 0;
     for (auto r : results) {
@@ -16,8 +16,10 @@
 
 #include <algorithm>
 #include <bitset>
+#include <chrono>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -41,6 +43,14 @@ class OQCDevice final : public Catalyst::Runtime::QuantumDevice {
 
     std::unordered_map<std::string, std::string> device_kwargs;
 
+    // Batched mode, enabled by the `batch` device kwarg: all the counts requests of an
+    // execution are computed from a single job measuring all qubits.
+    bool batched{false};
+    std::optional<OQCCountsT> execution_counts{};
+
+    // The programs serialized by the previous executions
+    OpenQASM2Cache circuit_cache{};
+
     inline auto getDeviceWires(const std::vector<QubitIdType> &wires) -> std::vector<size_t>
     {
         std::vector<size_t> res;
@@ -57,8 +67,24 @@ class OQCDevice final : public Catalyst::Runtime::QuantumDevice {
         device_shots = device_kwargs.contains("shots")
                            ? static_cast<size_t>(std::stoll(device_kwargs["shots"]))
                            : 0;
+        batched = device_kwargs.contains("batch") && device_kwargs["batch"] == "True";
         builder = std::make_unique<OpenQASM2Builder>();
-        runner = std::make_unique<OQCRunner>();
+
+        if (device_kwargs.contains("backend") && device_kwargs["backend"] == "mock") {
+            // Execute the jobs locally, without the OQC service.
+            std::optional<uint64_t> seed{};
+            if (device_kwargs.contains("seed")) {
+                seed = std::stoull(device_kwargs["seed"]);
+            }
+            std::chrono::microseconds latency{0};
+            if (device_kwargs.contains("latency_us")) {
+                latency = std::chrono::microseconds{std::stoll(device_kwargs["latency_us"])};
+            }
+            runner = std::make_unique<OQCMockRunner>(seed, latency);
+        }
+        else {
+            runner = std::make_unique<OQCRunner>();
+        }
     }
     ~OQCDevice() = default;
 
@@ -79,5 +105,7 @@ class OQCDevice final : public Catalyst::Runtime::QuantumDevice {
 
     // Circuit RT
     [[nodiscard]] auto Circuit() const -> std::string { return builder->toOpenQASM2(); }
+    [[nodiscard]] auto getRunner() const -> const OQCRunner & { return *runner; }
+    [[nodiscard]] auto getCircuitCache() const -> const OpenQASM2Cache & { return circuit_cache; }
 };
 } // namespace Catalyst::Runtime::Device
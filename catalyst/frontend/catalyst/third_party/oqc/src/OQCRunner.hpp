@@ -1,4 +1,3 @@
-
 // Copyright 2024 Xanadu Quantum Technologies Inc.
 
 // Licensed under the Apache License, Version 2.0 (the "License");
@@ -15,31 +14,166 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <random>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "DynamicLibraryLoader.hpp"
+#include "Exception.hpp"
 
 namespace Catalyst::Runtime::Device {
 
+/**
+ * The counts of the measured states of a circuit, as `(state, count)` pairs in which bit `i` of
+ * the state (from the least significant bit) is the classical bit `i`.
+ */
+using OQCCountsT = std::vector<std::pair<uint64_t, size_t>>;
+
 /**
  * The OpenQASM circuit runner to execute an OpenQASM circuit on OQC devices thanks to
  * OQC qcaas client.
  */
 struct OQCRunner {
+    explicit OQCRunner() = default;
+    virtual ~OQCRunner() = default;
 
-    [[nodiscard]] auto Counts(const std::string &circuit, const std::string &device, size_t shots,
-                              size_t num_qubits, const std::string &kwargs = "") const
-        -> std::vector<size_t>
+    [[nodiscard]] virtual auto Counts(const std::string &circuit, const std::string &device,
+                                      size_t shots, size_t num_qubits,
+                                      const std::string &kwargs = "") const -> std::vector<size_t>
     {
         DynamicLibraryLoader libLoader(OQC_PY);
 
         using countsImpl_t =
-            std::vector<size_t> (*)(const char *, const char *, size_t, const char *);
+            void (*)(const char *, const char *, size_t, size_t, const char *, void *);
         auto countsImpl = libLoader.getSymbol<countsImpl_t>("counts");
 
-        return countsImpl(circuit.c_str(), device.c_str(), shots, kwargs.c_str());
+        std::vector<size_t> results;
+        countsImpl(circuit.c_str(), device.c_str(), shots, num_qubits, kwargs.c_str(), &results);
+        return results;
+    }
+
+    /**
+     * Execute several circuits as a single job, and return the counts of the measured states of
+     * each circuit.
+     */
+    [[nodiscard]] virtual auto BatchCounts(const std::vector<std::string> &circuits,
+                                           const std::string &device, size_t shots,
+                                           size_t num_qubits, const std::string &kwargs = "") const
+        -> std::vector<OQCCountsT>
+    {
+        DynamicLibraryLoader libLoader(OQC_PY);
+
+        using batchCountsImpl_t = void (*)(const char *const *, size_t, const char *, size_t,
+                                           size_t, const char *, void *);
+        auto batchCountsImpl = libLoader.getSymbol<batchCountsImpl_t>("batch_counts");
+
+        std::vector<const char *> programs;
+        programs.reserve(circuits.size());
+        for (const auto &circuit : circuits) {
+            programs.push_back(circuit.c_str());
+        }
+
+        std::vector<OQCCountsT> results;
+        batchCountsImpl(programs.data(), programs.size(), device.c_str(), shots, num_qubits,
+                        kwargs.c_str(), &results);
+        RT_FAIL_IF(results.size() != circuits.size(), "Invalid number of results in the OQC job");
+        return results;
     }
 };
 
+/**
+ * A local OQC runner that doesn't contact the OQC service, to measure the throughput of the
+ * device and to test it.
+ *
+ * The circuits are not simulated: the shots are drawn uniformly from the computational basis
+ * states of the measured register. An optional `latency` is added to each job to model the
+ * round trip to the service.
+ *
+ * @param seed Optional seed of the random number generator
+ * @param latency The simulated latency of each job
+ */
+struct OQCMockRunner : public OQCRunner {
+  private:
+    mutable std::mt19937_64 generator;
+    const std::chrono::microseconds latency;
+
+    mutable std::atomic<size_t> num_jobs{0};
+    mutable std::atomic<size_t> num_circuits{0};
+    mutable std::string last_circuit{};
+
+    [[nodiscard]] auto sample(const std::string &circuit, size_t shots, size_t num_qubits) const
+        -> OQCCountsT
+    {
+        RT_FAIL_IF(num_qubits > 64, "Unable to sample the states of more than 64 qubits");
+        num_circuits++;
+        last_circuit = circuit;
+
+        const uint64_t mask = num_qubits == 64 ? ~uint64_t{0} : (uint64_t{1} << num_qubits) - 1;
+        std::unordered_map<uint64_t, size_t> counts;
+        for (size_t shot = 0; shot < shots; shot++) {
+            counts[generator() & mask]++;
+        }
+        return {counts.begin(), counts.end()};
+    }
+
+    void wait() const
+    {
+        num_jobs++;
+        if (latency.count() > 0) {
+            std::this_thread::sleep_for(latency);
+        }
+    }
+
+  public:
+    explicit OQCMockRunner(std::optional<uint64_t> seed = std::nullopt,
+                           std::chrono::microseconds _latency = std::chrono::microseconds{0})
+        : generator(seed.has_value() ? seed.value() : std::random_device{}()), latency(_latency)
+    {
+    }
+    ~OQCMockRunner() override = default;
+
+    [[nodiscard]] auto Counts(const std::string &circuit,
+                              [[maybe_unused]] const std::string &device, size_t shots,
+                              size_t num_qubits,
+                              [[maybe_unused]] const std::string &kwargs = "") const
+        -> std::vector<size_t> override
+    {
+        RT_FAIL_IF(num_qubits >= 32, "Unable to return dense counts of 32 qubits or more");
+        wait();
+
+        std::vector<size_t> results(size_t{1} << num_qubits, 0);
+        for (auto &&[state, count] : sample(circuit, shots, num_qubits)) {
+            results[state] += count;
+        }
+        return results;
+    }
+
+    [[nodiscard]] auto BatchCounts(const std::vector<std::string> &circuits,
+                                   [[maybe_unused]] const std::string &device, size_t shots,
+                                   size_t num_qubits,
+                                   [[maybe_unused]] const std::string &kwargs = "") const
+        -> std::vector<OQCCountsT> override
+    {
+        wait();
+
+        std::vector<OQCCountsT> results;
+        results.reserve(circuits.size());
+        for (const auto &circuit : circuits) {
+            results.push_back(sample(circuit, shots, num_qubits));
+        }
+        return results;
+    }
+
+    [[nodiscard]] auto getNumJobs() const -> size_t { return num_jobs; }
+    [[nodiscard]] auto getNumCircuits() const -> size_t { return num_circuits; }
+    [[nodiscard]] auto getLastCircuit() const -> const std::string & { return last_circuit; }
+};
+
 } // namespace Catalyst::Runtime::Device
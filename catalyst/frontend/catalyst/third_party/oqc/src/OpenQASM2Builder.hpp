@@ -16,12 +16,13 @@
 
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <complex>
-#include <iomanip>
 #include <memory>
-#include <sstream>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <unordered_set>
 #include <vector>
 
@@ -94,6 +95,29 @@ constexpr auto lookup_qasm_gate_name(std::string_view gate_name) -> std::string_
     RT_FAIL("The given QIR gate name is not supported by the OpenQASM builder.");
 }
 
+/**
+ * Append a size or an index to an OpenQasm program.
+ */
+inline void appendNumber(std::string &out, size_t value)
+{
+    std::array<char, 24> buffer{};
+    auto &&[ptr, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    out.append(buffer.data(), ptr);
+}
+
+/**
+ * Append a parameter value to an OpenQasm program, with `precision` significant digits. This is
+ * the format of `std::ostream` with `std::setprecision(precision)`.
+ */
+inline void appendNumber(std::string &out, double value, size_t precision)
+{
+    std::array<char, 64> buffer{};
+    auto &&[ptr, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value,
+                                     std::chars_format::general, static_cast<int>(precision));
+    RT_FAIL_IF(ec != std::errc(), "Failed to serialize the parameter value");
+    out.append(buffer.data(), ptr);
+}
+
 /**
  * The OpenQasm quantum register type.
  *
@@ -121,34 +145,52 @@ class QASMRegister {
     void updateSize(size_t new_size) { size = new_size; }
     void resetSize() { size = 0; }
 
-    [[nodiscard]] auto toOpenQASM2(RegisterMode mode) const -> std::string
+    auto operator==(const QASMRegister &other) const -> bool
+    {
+        return type == other.type && size == other.size && name == other.name;
+    }
+
+    /**
+     * Append the register instruction of the given mode to `out`.
+     */
+    void toOpenQASM2(std::string &out, RegisterMode mode) const
     {
-        std::ostringstream oss;
         switch (mode) {
         case RegisterMode::Alloc: {
             // qubit[size] name;
             if (type == RegisterType::Qubit) {
-                oss << "qreg ";
+                out += "qreg ";
             }
             else if (type == RegisterType::Bit) {
-                oss << "creg ";
+                out += "creg ";
             }
             else {
                 RT_FAIL("Unsupported OpenQasm register type");
             }
-            oss << name << "[" << size << "]"
-                << ";\n";
-            return oss.str();
+            out += name;
+            out += "[";
+            appendNumber(out, size);
+            out += "];\n";
+            return;
         }
         case RegisterMode::Reset: {
             // reset name;
-            oss << "reset " << name << ";\n";
-            return oss.str();
+            out += "reset ";
+            out += name;
+            out += ";\n";
+            return;
         }
         default:
             RT_FAIL("Unsupported OpenQasm register mode");
         }
     }
+
+    [[nodiscard]] auto toOpenQASM2(RegisterMode mode) const -> std::string
+    {
+        std::string out;
+        toOpenQASM2(out, mode);
+        return out;
+    }
 };
 
 /**
@@ -178,30 +220,49 @@ class QASMGate {
     [[nodiscard]] auto getParams() const -> std::vector<double> { return params_val; }
     [[nodiscard]] auto getWires() const -> std::vector<size_t> { return wires; }
 
-    [[nodiscard]] auto toOpenQASM2(const QASMRegister &qregister, size_t precision = 5) const
-        -> std::string
+    auto operator==(const QASMGate &other) const -> bool
+    {
+        return name == other.name && params_val == other.params_val && wires == other.wires;
+    }
+
+    /**
+     * Append the gate instruction to `out`.
+     */
+    void toOpenQASM2(std::string &out, const QASMRegister &qregister, size_t precision = 5) const
     {
-        std::ostringstream oss;
         // name(param_1, ..., param_n) qubit_1, ..., qubit_m
-        oss << name;
+        out += name;
         if (!params_val.empty()) {
-            oss << "(";
-            auto iter = params_val.begin();
-            for (; iter != params_val.end() - 1; iter++) {
-                oss << std::setprecision(precision) << *iter << ", ";
+            out += "(";
+            for (size_t idx = 0; idx < params_val.size(); idx++) {
+                if (idx) {
+                    out += ", ";
+                }
+                appendNumber(out, params_val[idx], precision);
             }
-            oss << std::setprecision(precision) << *iter << ") ";
-        }
-        else {
-            oss << " ";
+            out += ")";
         }
-        auto iter = wires.begin();
-        for (; iter != wires.end() - 1; iter++) {
-            oss << qregister.getName() << "[" << *iter << "], ";
+        out += " ";
+
+        const auto &&qreg_name = qregister.getName();
+        for (size_t idx = 0; idx < wires.size(); idx++) {
+            if (idx) {
+                out += ", ";
+            }
+            out += qreg_name;
+            out += "[";
+            appendNumber(out, wires[idx]);
+            out += "]";
         }
-        oss << qregister.getName() << "[" << *iter << "]"
-            << ";\n";
-        return oss.str();
+        out += ";\n";
+    }
+
+    [[nodiscard]] auto toOpenQASM2(const QASMRegister &qregister, size_t precision = 5) const
+        -> std::string
+    {
+        std::string out;
+        toOpenQASM2(out, qregister, precision);
+        return out;
     }
 };
 
@@ -223,20 +284,43 @@ class QASMMeasure {
     [[nodiscard]] auto getQubit() const -> size_t { return qubit; }
     [[nodiscard]] auto getBit() const -> size_t { return qubit; }
 
+    auto operator==(const QASMMeasure &other) const -> bool
+    {
+        return qubit == other.qubit && bit == other.bit;
+    }
+
+    /**
+     * Append the measure instruction to `out`.
+     */
+    void toOpenQASM2(std::string &out, const QASMRegister &qregister,
+                     const QASMRegister &cregister) const
+    {
+        // measure wire
+        out += "measure ";
+        out += qregister.getName();
+        out += "[";
+        appendNumber(out, qubit);
+        out += "] -> ";
+        out += cregister.getName();
+        out += "[";
+        appendNumber(out, bit);
+        out += "];\n";
+    }
+
     [[nodiscard]] auto toOpenQASM2(const QASMRegister &qregister,
                                    const QASMRegister &cregister) const -> std::string
     {
-        // measure wire
-        std::ostringstream oss;
-        oss << "measure " << qregister.getName() << "[" << qubit << "] -> " << cregister.getName()
-            << "[" << bit << "];\n";
-        return oss.str();
+        std::string out;
+        toOpenQASM2(out, qregister, cregister);
+        return out;
     }
 };
 
 /**
  * The OpenQASM2 circuit builder interface.
  *
+ * The program is serialized into a single buffer, and memoized until the next instruction is
+ * added to the builder.
  *
  * @param qregs Quantum registers
  * @param cregs Measurement results registers
@@ -252,6 +336,10 @@ class OpenQASM2Builder {
     size_t num_qubits;
     bool measure_all = false;
 
+    // The memoized program and its precision
+    mutable std::optional<std::string> program{};
+    mutable size_t program_precision{0};
+
   public:
     explicit OpenQASM2Builder() : measure_all(false), num_qubits(0) {}
     virtual ~OpenQASM2Builder() = default;
@@ -262,47 +350,129 @@ class OpenQASM2Builder {
         qregs.emplace_back(RegisterType::Qubit, nameQreg, numQubits);
         num_qubits += numQubits;
         cregs.emplace_back(RegisterType::Bit, nameCreg, numCbits);
+        program.reset();
     }
     void AddGate(const std::string &name, const std::vector<double> &params_val,
                  const std::vector<size_t> &qubits)
     {
         gates.emplace_back(name, params_val, qubits);
+        program.reset();
+    }
+    void AddMeasurement(size_t bit, size_t qubit)
+    {
+        measurements.emplace_back(bit, qubit);
+        program.reset();
+    }
+    void AddMeasurements()
+    {
+        measure_all = true;
+        program.reset();
     }
-    void AddMeasurement(size_t bit, size_t qubit) { measurements.emplace_back(bit, qubit); }
-    void AddMeasurements() { measure_all = true; }
     size_t getNumQubits() { return num_qubits; }
+
+    /**
+     * Check whether the two builders serialize to the same program, without serializing them.
+     */
+    [[nodiscard]] auto isSameCircuit(const OpenQASM2Builder &other) const -> bool
+    {
+        return num_qubits == other.num_qubits && measure_all == other.measure_all &&
+               qregs == other.qregs && cregs == other.cregs && gates == other.gates &&
+               measurements == other.measurements;
+    }
+
     [[nodiscard]] virtual auto toOpenQASM2(size_t precision = 5) const -> std::string
     {
-        std::ostringstream oss;
+        if (program.has_value() && program_precision == precision) {
+            return program.value();
+        }
+
+        std::string out;
+        out.reserve(64 + 32 * (gates.size() + measurements.size()));
 
         // header
-        oss << "OPENQASM 2.0"
-            << ";\n";
-        oss << "include \"qelib1.inc\""
-            << ";\n";
+        out += "OPENQASM 2.0;\n";
+        out += "include \"qelib1.inc\";\n";
         // quantum registers
-        oss << qregs[0].toOpenQASM2(RegisterMode::Alloc);
+        qregs[0].toOpenQASM2(out, RegisterMode::Alloc);
 
         // measurement results registers
-        oss << cregs[0].toOpenQASM2(RegisterMode::Alloc);
+        cregs[0].toOpenQASM2(out, RegisterMode::Alloc);
 
         // quantum gates assuming qregs.size() == 1
         for (auto &gate : gates) {
-            oss << gate.toOpenQASM2(qregs[0], precision);
+            gate.toOpenQASM2(out, qregs[0], precision);
         }
 
         // quantum measures assuming qregs.size() == 1, cregs.size() <= 1
         if (!measure_all) {
             for (auto &m : measurements) {
-                oss << m.toOpenQASM2(qregs[0], cregs[0]);
+                m.toOpenQASM2(out, qregs[0], cregs[0]);
             }
         }
         else {
-            oss << "measure " << qregs[0].getName() << " -> " << cregs[0].getName() << ";\n";
+            out += "measure ";
+            out += qregs[0].getName();
+            out += " -> ";
+            out += cregs[0].getName();
+            out += ";\n";
         }
 
-        return oss.str();
+        program = out;
+        program_precision = precision;
+        return out;
     }
 };
 
+/**
+ * A cache of the serialized programs of the OQC device across executions.
+ *
+ * Executions that rebuild the same circuit (same registers, gates, parameters, and
+ * measurements) reuse the program serialized by the last execution. The circuits are compared
+ * instruction by instruction, which is cheaper than formatting them again.
+ */
+class OpenQASM2Cache {
+  private:
+    std::optional<OpenQASM2Builder> circuit{};
+    std::string text{};
+    size_t precision{0};
+
+    size_t hits{0};
+    size_t misses{0};
+
+  public:
+    OpenQASM2Cache() = default;
+    ~OpenQASM2Cache() = default;
+
+    /**
+     * Get the program of the given builder.
+     *
+     * @param builder The builder of the current execution
+     * @param _precision The precision of the parameter values
+     * @return const std::string& The program, valid until the next call
+     */
+    [[nodiscard]] auto get(const OpenQASM2Builder &builder, size_t _precision = 5)
+        -> const std::string &
+    {
+        if (circuit.has_value() && precision == _precision && circuit->isSameCircuit(builder)) {
+            hits++;
+            return text;
+        }
+
+        misses++;
+        text = builder.toOpenQASM2(_precision);
+        circuit.emplace(builder);
+        precision = _precision;
+        return text;
+    }
+
+    void clear()
+    {
+        circuit.reset();
+        text.clear();
+    }
+
+    [[nodiscard]] auto getHits() const -> size_t { return hits; }
+    [[nodiscard]] auto getMisses() const -> size_t { return misses; }
+};
+
 } // namespace Catalyst::Runtime::OpenQASM2
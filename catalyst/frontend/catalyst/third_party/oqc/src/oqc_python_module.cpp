@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <nanobind/eval.h>
@@ -79,4 +81,73 @@ except Exception as e:
     return;
 }
 
+std::string batch_program = R"(
+import os
+from qcaas_client.client import OQCClient, QPUTask, CompilerConfig
+from qcaas_client.config import QuantumResultsFormat, Tket, TketOptimizations
+optimisations = Tket()
+optimisations.tket_optimizations = TketOptimizations.DefaultMappingPass
+
+RES_FORMAT = QuantumResultsFormat().binary_count()
+
+try:
+    email = os.environ.get("OQC_EMAIL")
+    password = os.environ.get("OQC_PASSWORD")
+    url = os.environ.get("OQC_URL")
+    client = OQCClient(url=url, email=email, password=password)
+    client.authenticate()
+    oqc_config = CompilerConfig(repeats=shots, results_format=RES_FORMAT, optimizations=optimisations)
+    oqc_tasks = [QPUTask(circuit, oqc_config) for circuit in circuits]
+    res = client.execute_tasks(oqc_tasks)
+    # The bitstrings are ordered by classical bit: cbit 0 is the first character
+    counts = [
+        [(int(bits[::-1], 2), count) for bits, count in r.result["cbits"].items()] for r in res
+    ]
+
+except Exception as e:
+    print(f"circuits: {circuits}")
+    msg = str(e)
+)";
+
+[[gnu::visibility("default")]] void batch_counts(const char *const *_circuits, size_t num_circuits,
+                                                 const char *_device, size_t shots,
+                                                 size_t num_qubits, const char *_kwargs,
+                                                 void *_vector)
+{
+    namespace nb = nanobind;
+    using namespace nb::literals;
+
+    nb::gil_scoped_acquire lock;
+
+    nb::list circuits;
+    for (size_t idx = 0; idx < num_circuits; idx++) {
+        circuits.append(_circuits[idx]);
+    }
+
+    nb::dict locals;
+    locals["circuits"] = circuits;
+    locals["device"] = _device;
+    locals["kwargs"] = _kwargs;
+    locals["shots"] = shots;
+    locals["msg"] = "";
+
+    // Evaluate in scope of main module
+    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
+    nb::exec(nb::str(batch_program.c_str()), scope, locals);
+
+    auto msg = nb::cast<std::string>(locals["msg"]);
+    RT_FAIL_IF(!msg.empty(), msg.c_str());
+
+    using CountsT = std::vector<std::pair<uint64_t, size_t>>;
+    auto *counts_value = reinterpret_cast<std::vector<CountsT> *>(_vector);
+    for (auto circuit_counts : nb::list(locals["counts"])) {
+        CountsT &results = counts_value->emplace_back();
+        for (auto item : nb::list(circuit_counts)) {
+            nb::tuple entry = nb::cast<nb::tuple>(item);
+            results.emplace_back(nb::cast<uint64_t>(entry[0]), nb::cast<size_t>(entry[1]));
+        }
+    }
+    return;
+}
+
 NB_MODULE(oqc_python_module, m) { m.doc() = "oqc"; }
@@ -69,3 +69,122 @@ TEST_CASE("Test the bell pair circuit", "[openqasm]")
 
     CHECK(device->Circuit() == toqasmempty);
 }
+
+TEST_CASE("Test the OQCMockRunner", "[openqasm]")
+{
+    auto runner = OQCMockRunner(42);
+
+    auto &&counts = runner.Counts("OPENQASM 2.0;", "", 1000, 3);
+    CHECK(counts.size() == 8);
+    CHECK(std::accumulate(counts.begin(), counts.end(), size_t{0}) == 1000);
+    CHECK(runner.getNumJobs() == 1);
+
+    auto &&batch = runner.BatchCounts({"circuit 1", "circuit 2"}, "", 100, 2);
+    REQUIRE(batch.size() == 2);
+    for (const auto &circuit_counts : batch) {
+        size_t shots = 0;
+        for (auto &&[state, count] : circuit_counts) {
+            CHECK(state < 4);
+            shots += count;
+        }
+        CHECK(shots == 100);
+    }
+    CHECK(runner.getNumJobs() == 2);
+    CHECK(runner.getNumCircuits() == 3);
+    CHECK(runner.getLastCircuit() == "circuit 2");
+
+    // Equal seeds give equal counts
+    CHECK(OQCMockRunner(7).Counts("", "", 100, 2) == OQCMockRunner(7).Counts("", "", 100, 2));
+}
+
+TEST_CASE("Test the OQCDevice with the mock runner", "[openqasm]")
+{
+    auto device = OQCDevice("{backend : mock, seed : 42, shots : 100}");
+    auto wires = device.AllocateQubits(2);
+    device.NamedOperation("Hadamard", {}, {wires[0]}, false);
+
+    std::vector<double> eigvals(4);
+    std::vector<int64_t> counts(4);
+    DataView<double, 1> eigvals_view(eigvals);
+    DataView<int64_t, 1> counts_view(counts);
+    device.PartialCounts(eigvals_view, counts_view, wires);
+
+    CHECK(eigvals == std::vector<double>{0, 1, 2, 3});
+    CHECK(std::accumulate(counts.begin(), counts.end(), int64_t{0}) == 100);
+
+    const auto &runner = dynamic_cast<const OQCMockRunner &>(device.getRunner());
+    CHECK(runner.getNumJobs() == 1);
+    CHECK(runner.getLastCircuit() == "OPENQASM 2.0;\n"
+                                     "include \"qelib1.inc\";\n"
+                                     "qreg qubits[2];\n"
+                                     "creg cbits[2];\n"
+                                     "h qubits[0];\n"
+                                     "measure qubits[0] -> cbits[0];\n"
+                                     "measure qubits[1] -> cbits[1];\n");
+}
+
+TEST_CASE("Test the batched OQCDevice", "[openqasm]")
+{
+    auto device = OQCDevice("{backend : mock, seed : 42, shots : 1000, batch : True}");
+    const auto &runner = dynamic_cast<const OQCMockRunner &>(device.getRunner());
+
+    for (size_t execution = 0; execution < 3; execution++) {
+        auto wires = device.AllocateQubits(3);
+        device.NamedOperation("Hadamard", {}, {wires[0]}, false);
+        device.NamedOperation("CNOT", {}, {wires[0], wires[1]}, false);
+
+        // Counts of all wires, and of two subsets of wires
+        std::vector<double> eigvals(8);
+        std::vector<int64_t> counts(8);
+        DataView<double, 1> eigvals_view(eigvals);
+        DataView<int64_t, 1> counts_view(counts);
+        device.PartialCounts(eigvals_view, counts_view, wires);
+
+        std::vector<double> eigvals0(2);
+        std::vector<int64_t> counts0(2);
+        DataView<double, 1> eigvals0_view(eigvals0);
+        DataView<int64_t, 1> counts0_view(counts0);
+        device.PartialCounts(eigvals0_view, counts0_view, {wires[0]});
+
+        std::vector<double> eigvals21(4);
+        std::vector<int64_t> counts21(4);
+        DataView<double, 1> eigvals21_view(eigvals21);
+        DataView<int64_t, 1> counts21_view(counts21);
+        device.PartialCounts(eigvals21_view, counts21_view, {wires[2], wires[1]});
+
+        // All requests of an execution are computed from one job
+        CHECK(runner.getNumJobs() == execution + 1);
+        CHECK(runner.getNumCircuits() == execution + 1);
+        CHECK(runner.getLastCircuit() == "OPENQASM 2.0;\n"
+                                         "include \"qelib1.inc\";\n"
+                                         "qreg qubits[3];\n"
+                                         "creg cbits[3];\n"
+                                         "h qubits[0];\n"
+                                         "cx qubits[0], qubits[1];\n"
+                                         "measure qubits -> cbits;\n");
+
+        // The marginal counts agree with the counts of all wires
+        CHECK(std::accumulate(counts.begin(), counts.end(), int64_t{0}) == 1000);
+        CHECK(counts0[0] == counts[0] + counts[1] + counts[2] + counts[3]);
+        CHECK(counts0[1] == counts[4] + counts[5] + counts[6] + counts[7]);
+        CHECK(counts21[0] == counts[0] + counts[4]);
+        CHECK(counts21[1] == counts[2] + counts[6]);
+        CHECK(counts21[2] == counts[1] + counts[5]);
+        CHECK(counts21[3] == counts[3] + counts[7]);
+
+        device.ReleaseAllQubits();
+    }
+
+    // The program is serialized by the first execution only
+    CHECK(device.getCircuitCache().getMisses() == 1);
+    CHECK(device.getCircuitCache().getHits() == 2);
+
+    // Invalid size of the counts
+    device.AllocateQubits(2);
+    std::vector<double> eigvals(2);
+    std::vector<int64_t> counts(2);
+    DataView<double, 1> eigvals_view(eigvals);
+    DataView<int64_t, 1> counts_view(counts);
+    REQUIRE_THROWS_WITH(device.PartialCounts(eigvals_view, counts_view, {0, 1}),
+                        Catch::Contains("Invalid size for the pre-allocated counts"));
+}
@@ -229,4 +229,69 @@ TEST_CASE("Test OpenQasmBuilder with dumping the circuit header, gates, and meas
                   "measure q -> c;\n";
 
     CHECK(builder.toOpenQASM2() == toqasm);
-}
\ No newline at end of file
+}
+TEST_CASE("Test the memoized program of OpenQasmBuilder", "[openqasm]")
+{
+    auto builder = OpenQASM2Builder();
+    builder.AddRegisters("q", 2, "c", 2);
+    builder.AddGate("RX", {0.361731}, {0});
+
+    CHECK(builder.toOpenQASM2(2) == "OPENQASM 2.0;\ninclude \"qelib1.inc\";\n"
+                                    "qreg q[2];\ncreg c[2];\nrx(0.36) q[0];\n");
+    CHECK(builder.toOpenQASM2(4) == "OPENQASM 2.0;\ninclude \"qelib1.inc\";\n"
+                                    "qreg q[2];\ncreg c[2];\nrx(0.3617) q[0];\n");
+
+    // New instructions invalidate the memoized program
+    builder.AddGate("CNOT", {}, {0, 1});
+    CHECK(builder.toOpenQASM2(4) == "OPENQASM 2.0;\ninclude \"qelib1.inc\";\n"
+                                    "qreg q[2];\ncreg c[2];\nrx(0.3617) q[0];\ncx q[0], q[1];\n");
+
+    // Check the parameter format of large and small values
+    auto gate = QASMGate("RZ", {1234567.0, 1e-7}, {1});
+    CHECK(gate.toOpenQASM2(QASMRegister(RegisterType::Qubit, "q", 2)) ==
+          "rz(1.2346e+06, 1e-07) q[1];\n");
+}
+
+TEST_CASE("Test the OpenQASM2Cache across builders", "[openqasm]")
+{
+    auto build = [](double param) {
+        auto builder = std::make_unique<OpenQASM2Builder>();
+        builder->AddRegisters("q", 2, "c", 2);
+        builder->AddGate("Hadamard", {}, {0});
+        builder->AddGate("RY", {param}, {1});
+        builder->AddMeasurements();
+        return builder;
+    };
+
+    auto cache = OpenQASM2Cache();
+
+    auto builder1 = build(0.5);
+    const std::string program1 = cache.get(*builder1);
+    CHECK(program1 == builder1->toOpenQASM2());
+    CHECK(cache.getMisses() == 1);
+
+    // The same circuit built by another execution
+    auto builder2 = build(0.5);
+    CHECK(builder1->isSameCircuit(*builder2));
+    CHECK(cache.get(*builder2) == program1);
+    CHECK(cache.getHits() == 1);
+
+    // A different parameter value
+    auto builder3 = build(0.25);
+    CHECK(!builder1->isSameCircuit(*builder3));
+    CHECK(cache.get(*builder3) == builder3->toOpenQASM2());
+    CHECK(cache.getMisses() == 2);
+
+    // A different precision
+    CHECK(cache.get(*builder3, 2) == builder3->toOpenQASM2(2));
+    CHECK(cache.getMisses() == 3);
+
+    // A different measurement
+    auto builder4 = build(0.25);
+    builder4->AddMeasurement(0, 0);
+    CHECK(!builder3->isSameCircuit(*builder4));
+
+    cache.clear();
+    CHECK(cache.get(*builder3) == builder3->toOpenQASM2());
+    CHECK(cache.getMisses() == 4);
+}
@@ -15,8 +15,11 @@
 """
 Utility code for keeping paths
 """
+import glob
+import importlib.util
 import os
 import os.path
+import platform
 import sys
 import sysconfig
 
@@ -63,6 +66,19 @@ def get_bin_path(project, env_var):
     return os.getenv(env_var, DEFAULT_BIN_PATHS.get(project, ""))
 
 
+def get_lapack_lib_path():
+    """Return the path to the OpenBLAS library provided by scipy, which implements LAPACK, or
+    None if it can't be found."""
+    package_spec = importlib.util.find_spec("scipy_openblas32")
+    if package_spec is None:  # pragma: nocover
+        return None
+
+    file_extension = ".so" if platform.system() == "Linux" else ".dylib"  # pragma: no branch
+    lapack_lib_dir = os.path.join(os.path.dirname(package_spec.origin), "lib")
+    search_result = glob.glob(os.path.join(lapack_lib_dir, f"lib*openblas*{file_extension}"))
+    return search_result[0] if search_result else None
+
+
 def get_cli_path() -> str:  # pragma: nocover
     """Method to obtain the Catalyst CLI path packaged via the data_files mechanism."""
     catalyst_cli = "catalyst"
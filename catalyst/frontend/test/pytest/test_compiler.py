@@ -30,7 +30,13 @@ import pennylane as qml
 import pytest
 
 from catalyst import qjit
-from catalyst.compiler import CompileOptions, Compiler, LinkerDriver, _options_to_cli_flags
+from catalyst.compiler import (
+    CompileOptions,
+    Compiler,
+    LinkerDriver,
+    _options_to_cli_flags,
+    get_object_files,
+)
 from catalyst.debug import instrumentation
 from catalyst.pipelines import KeepIntermediateLevel
 from catalyst.utils.exceptions import CompileError
@@ -340,6 +346,33 @@ class TestCompilerState:
             assert observed_outfilename == expected_outfilename
             assert os.path.exists(observed_outfilename)
 
+    def test_compiler_driver_with_object_files(self):
+        """Test linking the object files of a split code generation."""
+
+        with tempfile.TemporaryDirectory() as workspace:
+            sources = {
+                "module.c": "int bar(void); int foo(void) { return bar(); }",
+                "module.1.c": "int bar(void) { return 0; }",
+            }
+            for name, source in sources.items():
+                filename = os.path.join(workspace, name)
+                with open(filename, "w", encoding="utf-8") as f:
+                    print(source, file=f)
+                object_file = filename.replace(".c", ".o")
+                subprocess.run(f"c99 -fPIC -c {filename} -o {object_file}".split(), check=True)
+
+            object_files = get_object_files(workspace, "module")
+            assert object_files == [
+                os.path.join(workspace, "module.o"),
+                os.path.join(workspace, "module.1.o"),
+            ]
+
+            # Undefined symbols are errors by default on macOS
+            flags = ["-shared"] + (["-Wl,-z,defs"] if platform.system() == "Linux" else [])
+            observed_outfilename = LinkerDriver.run(object_files, flags=flags)
+            assert observed_outfilename == os.path.join(workspace, "module.so")
+            assert os.path.exists(observed_outfilename)
+
     def test_pipeline_error(self):
         """Test pipeline error handling."""
 
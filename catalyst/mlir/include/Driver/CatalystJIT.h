@@ -0,0 +1,72 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "mlir/Support/LogicalResult.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ExecutionEngine/Orc/LLJIT.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Error.h"
+
+#include "CompilerDriver.h"
+
+namespace catalyst {
+namespace driver {
+
+/// An in-process JIT of the compiled program, as an alternative to emitting an object file that
+/// is then linked into a shared library and loaded.
+///
+/// The undefined symbols of the program, such as the runtime CAPI, are resolved from the current
+/// process and then from the libraries in `CompilerOptions::jitLibraries`. With
+/// `CompilerOptions::jitLazy`, each function is only compiled when it is first called.
+class CatalystJIT {
+  public:
+    static llvm::Expected<std::unique_ptr<CatalystJIT>> create(const CompilerOptions &options);
+    ~CatalystJIT();
+
+    CatalystJIT(const CatalystJIT &) = delete;
+    CatalystJIT &operator=(const CatalystJIT &) = delete;
+
+    /// Add a copy of the module to the JIT, and run its static constructors.
+    llvm::Error addModule(const llvm::Module &module);
+
+    /// The address of a symbol of the program, compiling it first if needed.
+    llvm::Expected<llvm::orc::ExecutorAddr> lookup(llvm::StringRef name);
+
+    /// The function of the program with the given name and function type `F`.
+    template <typename F> llvm::Expected<F *> lookupFunction(llvm::StringRef name)
+    {
+        auto address = lookup(name);
+        if (!address) {
+            return address.takeError();
+        }
+        return address->toPtr<F *>();
+    }
+
+  private:
+    std::unique_ptr<llvm::orc::LLJIT> jit;
+    bool lazy;
+
+    CatalystJIT(std::unique_ptr<llvm::orc::LLJIT> jit, bool lazy);
+};
+
+/// Materialize the module in a new JIT, stored in `output.jit`.
+mlir::LogicalResult compileJIT(const CompilerOptions &options, const llvm::Module &module,
+                               CompilerOutput &output);
+
+} // namespace driver
+} // namespace catalyst
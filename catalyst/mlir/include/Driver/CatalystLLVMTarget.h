@@ -14,8 +14,12 @@
 
 #pragma once
 
+#include <string>
+
 #include "mlir/IR/DialectRegistry.h"
 #include "mlir/Support/LogicalResult.h"
+#include "mlir/Support/Timing.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/IR/Module.h"
 
@@ -31,5 +35,13 @@ mlir::LogicalResult compileObjectFile(const CompilerOptions &options,
                                       std::shared_ptr<llvm::Module> module,
                                       llvm::TargetMachine *targetMachine, llvm::StringRef filename);
 
+/// Split the module into one partition per file name, and compile the partitions into these
+/// object files in parallel. The timing of each partition is nested under `timing`.
+mlir::LogicalResult compileObjectFiles(const CompilerOptions &options,
+                                       std::shared_ptr<llvm::Module> module,
+                                       llvm::TargetMachine *targetMachine,
+                                       llvm::ArrayRef<std::string> filenames,
+                                       mlir::TimingScope &timing);
+
 } // namespace driver
 } // namespace catalyst
@@ -0,0 +1,59 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "llvm/ADT/StringRef.h"
+
+#include "CompilerDriver.h"
+
+namespace catalyst {
+namespace driver {
+
+/// An on-disk cache of object files, addressed by a hash of everything the compilation depends
+/// on. It may be shared by concurrent processes: entries are written to unique temporary files
+/// and renamed into place, so that readers only ever see complete objects.
+///
+/// The cache is bounded by a size in bytes. When a new entry exceeds it, the least recently used
+/// entries are removed, where a hit counts as a use.
+class CompilationCache {
+  public:
+    CompilationCache(llvm::StringRef directory, uint64_t sizeLimit);
+
+    /// The key of a compilation, from its source, pipelines, command-line options and target,
+    /// and the versions of Catalyst and LLVM.
+    static std::string getKey(const CompilerOptions &options, llvm::StringRef targetTriple,
+                              llvm::StringRef cpu, llvm::StringRef features);
+
+    /// Copy the object of `key` to `filename`. Returns false if there is no such entry.
+    bool lookup(llvm::StringRef key, llvm::StringRef filename);
+
+    /// Store a copy of the object file `filename` under `key`, then evict the entries over the
+    /// size limit. Failures are reported to the diagnostic stream, but are not errors of the
+    /// compilation.
+    void store(const CompilerOptions &options, llvm::StringRef key, llvm::StringRef filename);
+
+  private:
+    std::string directory;
+    uint64_t sizeLimit;
+
+    std::string getEntry(llvm::StringRef key) const;
+    void evict(const CompilerOptions &options);
+};
+
+} // namespace driver
+} // namespace catalyst
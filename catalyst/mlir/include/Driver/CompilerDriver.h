@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -30,6 +33,8 @@
 namespace catalyst {
 namespace driver {
 
+class CatalystJIT;
+
 /// Verbosity level
 // TODO: Adjust the number of levels according to our needs. MLIR seems to print few really
 // low-level messages, we might want to hide these.
@@ -74,6 +79,31 @@ struct CompilerOptions {
     Action loweringAction;
     /// If true, the compiler will dump the pass pipeline that will be run.
     bool dumpPassPipeline;
+    /// The number of threads of the MLIR pass manager. Zero uses all hardware threads, and one
+    /// runs the passes on the calling thread.
+    unsigned numThreads = 0;
+    /// The optimization level of the LLVM stage, from 0 to 3. Levels above zero run the LLVM
+    /// optimization pipeline, and set the code generation level of the target machine.
+    unsigned optLevel = 0;
+    /// The CPU to generate code for. "native" selects the CPU and features of the host.
+    std::string targetCPU = "generic";
+    /// The directory of the compilation cache of object files. The cache is disabled if empty.
+    std::string cacheDir;
+    /// The maximum size of the compilation cache in bytes.
+    uint64_t cacheSizeLimit = 1 << 30;
+    /// The command-line arguments that may change the compiled object, beyond the other options.
+    /// They are part of the key of the compilation cache.
+    std::vector<std::string> cacheKeyArgs;
+    /// If true, the LLVM stage materializes the program in an in-process JIT instead of emitting
+    /// an object file. The JIT is returned in `CompilerOutput::jit`.
+    bool jit = false;
+    /// If true, the functions of the JIT are only compiled when they are first called.
+    bool jitLazy = false;
+    /// The shared libraries searched for the undefined symbols of the JIT, after the process.
+    std::vector<std::string> jitLibraries;
+    /// The number of partitions the LLVM module is split into for code generation, each compiled
+    /// on its own thread into its own object file (see `getObjectFiles`).
+    unsigned codegenThreads = 1;
 
     /// Get the destination of the object file at the end of compilation.
     std::string getObjectFile() const
@@ -81,6 +111,26 @@ struct CompilerOptions {
         using path = std::filesystem::path;
         return path(workspace.str()) / path(moduleName.str() + ".o");
     }
+
+    /// Get the destination of the object file of a partition of a split code generation, other
+    /// than the first one, numbered from one.
+    std::string getPartitionObjectFile(unsigned partition) const
+    {
+        using path = std::filesystem::path;
+        return path(workspace.str()) /
+               path(moduleName.str() + "." + std::to_string(partition) + ".o");
+    }
+
+    /// Get the destinations of the object files of a split code generation. The first one is the
+    /// object file of a single partition, and the others are numbered from one.
+    std::vector<std::string> getObjectFiles() const
+    {
+        std::vector<std::string> objectFiles = {getObjectFile()};
+        for (unsigned i = 1; i < codegenThreads; i++) {
+            objectFiles.push_back(getPartitionObjectFile(i));
+        }
+        return objectFiles;
+    }
 };
 
 struct CompilerOutput {
@@ -89,11 +139,14 @@ struct CompilerOutput {
     std::string outIR;
     std::string diagnosticMessages;
     PipelineOutputs pipelineOutputs;
-    size_t pipelineCounter = 0;
+    std::atomic<size_t> pipelineCounter = 0;
     /// if the compiler reach the pass specified by startAfterPass.
     bool isCheckpointFound;
+    /// The JIT of the program, if `CompilerOptions::jit` is set.
+    std::shared_ptr<CatalystJIT> jit;
 
-    // Gets the next pipeline dump file name, prefixed with number.
+    // Gets the next pipeline dump file name, prefixed with number. This may be called from the
+    // threads of the pass manager.
     std::string nextPipelineDumpFilename(std::string pipelineName, std::string ext = ".mlir")
     {
         return std::filesystem::path(std::to_string(this->pipelineCounter++) + "_" + pipelineName)
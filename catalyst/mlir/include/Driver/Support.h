@@ -15,6 +15,7 @@
 #pragma once
 
 #include <filesystem>
+#include <mutex>
 #include <string>
 
 #include "mlir/Support/LogicalResult.h"
@@ -25,9 +26,19 @@
 namespace catalyst {
 namespace driver {
 
+/// The lock serializing the messages and dumps of the driver, which are also emitted from the
+/// threads of the pass manager. It is recursive so that helpers like `dumpToFile` can be called
+/// while holding it.
+inline std::recursive_mutex &getOutputMutex()
+{
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
 template <typename Obj>
 void dumpToFile(const CompilerOptions &options, mlir::StringRef fileName, const Obj &obj)
 {
+    std::lock_guard<std::recursive_mutex> lock(getOutputMutex());
     using std::filesystem::path;
     std::error_code errCode;
     std::string outFileName = path(options.workspace.str()) / path(fileName.str());
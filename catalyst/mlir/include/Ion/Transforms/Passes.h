@@ -22,5 +22,6 @@ namespace catalyst {
 
 std::unique_ptr<mlir::Pass> createGatesToPulsesPass();
 std::unique_ptr<mlir::Pass> createIonConversionPass();
+std::unique_ptr<mlir::Pass> createSchedulePulsesPass();
 
 } // namespace catalyst
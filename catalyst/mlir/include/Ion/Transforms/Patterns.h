@@ -19,11 +19,13 @@
 #include "mlir/Transforms/DialectConversion.h"
 
 #include "Ion/Transforms/oqd_database_managers.hpp"
+#include "Quantum/Utils/QubitIndexAnalysis.h"
 
 namespace catalyst {
 namespace ion {
 
-void populateGatesToPulsesPatterns(mlir::RewritePatternSet &, const OQDDatabaseManager &);
+void populateGatesToPulsesPatterns(mlir::RewritePatternSet &, const OQDDatabaseManager &,
+                                   const catalyst::quantum::QubitIndexAnalysis &);
 void populateConversionPatterns(mlir::LLVMTypeConverter &typeConverter,
                                 mlir::RewritePatternSet &patterns);
 
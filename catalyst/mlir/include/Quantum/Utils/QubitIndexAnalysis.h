@@ -0,0 +1,66 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <optional>
+
+#include "llvm/ADT/DenseMap.h"
+
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/IR/Operation.h"
+#include "mlir/IR/Value.h"
+
+namespace catalyst {
+namespace quantum {
+
+/**
+ * @brief Assign static wire indices to the qubit values of an operation, e.g. a qnode function.
+ *
+ *        The analysis runs one forward pass over the operation. The qubits extracted with a
+ *        static (or constant) index get that index, which is then propagated from the operands
+ *        to the results of quantum operations, positionally, and across the region arguments
+ *        and results of `scf.for` and `scf.if`. Operations of other dialects whose operands and
+ *        results are all qubits, like `ion.parallelprotocol`, are also treated positionally.
+ *        A loop-carried qubit keeps the index of its initial value only if the loop yields it
+ *        back at the same position. Qubits whose wire depends on the control flow, or that come
+ *        from dynamic indices, have no index.
+ *
+ *        The indices are those of the extract ops, i.e. within their register. The analysis is
+ *        constructed from an operation, so that passes can cache it with `getAnalysis`.
+ */
+class QubitIndexAnalysis {
+  public:
+    explicit QubitIndexAnalysis(mlir::Operation *target);
+
+    /**
+     * @brief Return the static wire index of a qubit value, or std::nullopt if it is unknown.
+     */
+    std::optional<int64_t> getQubitIndex(mlir::Value qubit) const;
+
+  private:
+    llvm::DenseMap<mlir::Value, int64_t> indices;
+
+    void visitRegion(mlir::Region &region);
+    void visitOperation(mlir::Operation *op);
+    void visitForOp(mlir::scf::ForOp forOp);
+    void visitIfOp(mlir::scf::IfOp ifOp);
+
+    static bool isQubitMap(mlir::Operation *op);
+    void propagate(mlir::Value from, mlir::Value to);
+    void forget(mlir::Region &region);
+};
+
+} // namespace quantum
+} // namespace catalyst
@@ -0,0 +1,145 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/ExecutionEngine/Orc/ExecutionUtils.h"
+#include "llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h"
+#include "llvm/ExecutionEngine/Orc/ThreadSafeModule.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/Support/CodeGen.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "Driver/CatalystJIT.h"
+
+using namespace mlir;
+using namespace catalyst::driver;
+
+CatalystJIT::CatalystJIT(std::unique_ptr<llvm::orc::LLJIT> jit, bool lazy)
+    : jit(std::move(jit)), lazy(lazy)
+{
+}
+
+CatalystJIT::~CatalystJIT()
+{
+    // Run the static destructors of the program
+    if (auto err = jit->deinitialize(jit->getMainJITDylib())) {
+        llvm::logAllUnhandledErrors(std::move(err), llvm::errs(), "JIT deinitialization failed: ");
+    }
+}
+
+llvm::Expected<std::unique_ptr<CatalystJIT>> CatalystJIT::create(const CompilerOptions &options)
+{
+    using namespace llvm::orc;
+
+    // The program runs in this process, so it is always compiled for the host
+    auto targetMachineBuilder = JITTargetMachineBuilder::detectHost();
+    if (!targetMachineBuilder) {
+        return targetMachineBuilder.takeError();
+    }
+    targetMachineBuilder->setCodeGenOptLevel(
+        llvm::CodeGenOpt::getLevel(options.optLevel).value_or(llvm::CodeGenOptLevel::None));
+
+    std::unique_ptr<LLJIT> jit;
+    if (options.jitLazy) {
+        auto lazyJIT = LLLazyJITBuilder()
+                           .setJITTargetMachineBuilder(std::move(*targetMachineBuilder))
+                           .create();
+        if (!lazyJIT) {
+            return lazyJIT.takeError();
+        }
+        jit = std::move(*lazyJIT);
+    }
+    else {
+        auto eagerJIT =
+            LLJITBuilder().setJITTargetMachineBuilder(std::move(*targetMachineBuilder)).create();
+        if (!eagerJIT) {
+            return eagerJIT.takeError();
+        }
+        jit = std::move(*eagerJIT);
+    }
+
+    // Resolve the symbols of the runtime from the process first, in which it may already be
+    // loaded, and then from the given libraries
+    JITDylib &dylib = jit->getMainJITDylib();
+    char globalPrefix = jit->getDataLayout().getGlobalPrefix();
+    auto processSymbols = DynamicLibrarySearchGenerator::GetForCurrentProcess(globalPrefix);
+    if (!processSymbols) {
+        return processSymbols.takeError();
+    }
+    dylib.addGenerator(std::move(*processSymbols));
+    for (const auto &library : options.jitLibraries) {
+        auto librarySymbols = DynamicLibrarySearchGenerator::Load(library.c_str(), globalPrefix);
+        if (!librarySymbols) {
+            return librarySymbols.takeError();
+        }
+        dylib.addGenerator(std::move(*librarySymbols));
+    }
+
+    return std::unique_ptr<CatalystJIT>(new CatalystJIT(std::move(jit), options.jitLazy));
+}
+
+llvm::Error CatalystJIT::addModule(const llvm::Module &module)
+{
+    // The JIT owns its modules and their contexts, while the driver keeps the compiled module.
+    // Copy the module into a context of its own through an in-memory bitcode.
+    llvm::SmallVector<char, 0> bitcode;
+    llvm::raw_svector_ostream bitcodeStream(bitcode);
+    llvm::WriteBitcodeToFile(module, bitcodeStream);
+
+    auto context = std::make_unique<llvm::LLVMContext>();
+    llvm::MemoryBufferRef buffer(llvm::StringRef(bitcode.data(), bitcode.size()),
+                                 module.getModuleIdentifier());
+    auto copy = llvm::parseBitcodeFile(buffer, *context);
+    if (!copy) {
+        return copy.takeError();
+    }
+    (*copy)->setDataLayout(jit->getDataLayout());
+
+    llvm::orc::ThreadSafeModule threadSafeModule(std::move(*copy), std::move(context));
+    llvm::Error err = lazy ? static_cast<llvm::orc::LLLazyJIT &>(*jit).addLazyIRModule(
+                                 std::move(threadSafeModule))
+                           : jit->addIRModule(std::move(threadSafeModule));
+    if (err) {
+        return err;
+    }
+
+    // Run the static constructors of the program
+    return jit->initialize(jit->getMainJITDylib());
+}
+
+llvm::Expected<llvm::orc::ExecutorAddr> CatalystJIT::lookup(llvm::StringRef name)
+{
+    return jit->lookup(name);
+}
+
+LogicalResult catalyst::driver::compileJIT(const CompilerOptions &options,
+                                           const llvm::Module &module, CompilerOutput &output)
+{
+    auto jit = CatalystJIT::create(options);
+    if (!jit) {
+        CO_MSG(options, Verbosity::Urgent,
+               "Unable to create the JIT: " << llvm::toString(jit.takeError()) << "\n");
+        return failure();
+    }
+    if (auto err = (*jit)->addModule(module)) {
+        CO_MSG(options, Verbosity::Urgent,
+               "Unable to add the module to the JIT: " << llvm::toString(std::move(err)) << "\n");
+        return failure();
+    }
+    output.jit = std::move(*jit);
+    return success();
+}
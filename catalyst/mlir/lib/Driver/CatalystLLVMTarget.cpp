@@ -12,21 +12,33 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <mutex>
+#include <vector>
+
 #include "mlir/Interfaces/FunctionInterfaces.h"
 #include "mlir/Target/LLVMIR/Dialect/Builtin/BuiltinToLLVMIRTranslation.h"
 #include "mlir/Target/LLVMIR/Dialect/LLVMIR/LLVMToLLVMIRTranslation.h"
 #include "mlir/Target/LLVMIR/Export.h"
 #include "mlir/Target/LLVMIR/LLVMTranslationInterface.h"
 #include "mlir/Target/LLVMIR/ModuleTranslation.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/LegacyPassManager.h"
 #include "llvm/MC/TargetRegistry.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
 #include "llvm/TargetParser/Host.h"
+#include "llvm/Transforms/Utils/SplitModule.h"
 
 #include "Driver/CatalystLLVMTarget.h"
+#include "Driver/Support.h"
 #include "Gradient/IR/GradientDialect.h"
 
 using namespace mlir;
@@ -48,12 +60,14 @@ LogicalResult catalyst::driver::compileObjectFile(const CompilerOptions &options
     raw_fd_ostream dest(filename, errCode, sys::fs::OF_None);
 
     if (errCode) {
+        std::lock_guard<std::recursive_mutex> lock(getOutputMutex());
         CO_MSG(options, Verbosity::Urgent, "could not open file: " << errCode.message() << "\n");
         return failure();
     }
 
     legacy::PassManager pm;
     if (targetMachine->addPassesToEmitFile(pm, dest, nullptr, CodeGenFileType::ObjectFile)) {
+        std::lock_guard<std::recursive_mutex> lock(getOutputMutex());
         CO_MSG(options, Verbosity::Urgent, "TargetMachine can't emit an .o file\n");
         return failure();
     }
@@ -62,3 +76,54 @@ LogicalResult catalyst::driver::compileObjectFile(const CompilerOptions &options
     dest.flush();
     return success();
 }
+
+LogicalResult catalyst::driver::compileObjectFiles(const CompilerOptions &options,
+                                                   std::shared_ptr<llvm::Module> llvmModule,
+                                                   llvm::TargetMachine *targetMachine,
+                                                   llvm::ArrayRef<std::string> filenames,
+                                                   TimingScope &timing)
+{
+    using namespace llvm;
+
+    // Split the module, and serialize each partition so that it can be read into a context of
+    // its own: contexts and target machines can't be shared across threads.
+    TimingScope splitTiming = timing.nest("splitModule");
+    std::vector<SmallVector<char, 0>> partitions;
+    SplitModule(*llvmModule, filenames.size(), [&](std::unique_ptr<Module> partition) {
+        raw_svector_ostream bitcodeStream(partitions.emplace_back());
+        WriteBitcodeToFile(*partition, bitcodeStream);
+    });
+    splitTiming.stop();
+
+    std::vector<LogicalResult> results(partitions.size(), success());
+    DefaultThreadPool threadPool(hardware_concurrency(partitions.size()));
+    for (size_t i = 0; i < partitions.size(); i++) {
+        threadPool.async([&, i] {
+            TimingScope partitionTiming = timing.nest("partition " + std::to_string(i));
+
+            LLVMContext context;
+            MemoryBufferRef buffer(StringRef(partitions[i].data(), partitions[i].size()),
+                                   filenames[i]);
+            auto partition = parseBitcodeFile(buffer, context);
+            if (!partition) {
+                std::lock_guard<std::recursive_mutex> lock(getOutputMutex());
+                CO_MSG(options, Verbosity::Urgent,
+                       "could not read partition: " << toString(partition.takeError()) << "\n");
+                results[i] = failure();
+                return;
+            }
+
+            std::unique_ptr<TargetMachine> partitionTargetMachine(
+                targetMachine->getTarget().createTargetMachine(
+                    targetMachine->getTargetTriple(), targetMachine->getTargetCPU(),
+                    targetMachine->getTargetFeatureString(), targetMachine->Options,
+                    targetMachine->getRelocationModel(), targetMachine->getCodeModel(),
+                    targetMachine->getOptLevel()));
+            results[i] = compileObjectFile(options, std::move(*partition),
+                                           partitionTargetMachine.get(), filenames[i]);
+        });
+    }
+    threadPool.wait();
+
+    return success(llvm::all_of(results, [](LogicalResult result) { return succeeded(result); }));
+}
@@ -0,0 +1,189 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/SHA256.h"
+
+#include "Driver/CompilationCache.h"
+
+// Defined by the build from the version of the Python package
+#ifndef CATALYST_VERSION
+#define CATALYST_VERSION "unknown"
+#endif
+
+using namespace catalyst::driver;
+namespace fs = std::filesystem;
+
+namespace {
+
+/// Bumped whenever the layout of the entries or the contents of the key change
+constexpr llvm::StringLiteral cacheFormat = "1";
+
+/// Temporary files older than this were left by processes that died while storing an entry
+constexpr auto staleTemporaryAge = std::chrono::hours(1);
+
+void hashField(llvm::SHA256 &hasher, llvm::StringRef field)
+{
+    // Prefix each field by its size, so that the boundaries of the fields are part of the key
+    std::string size = std::to_string(field.size());
+    hasher.update(size);
+    hasher.update(":");
+    hasher.update(field);
+}
+
+} // namespace
+
+CompilationCache::CompilationCache(llvm::StringRef directory, uint64_t sizeLimit)
+    : directory(directory.str()), sizeLimit(sizeLimit)
+{
+}
+
+std::string CompilationCache::getKey(const CompilerOptions &options,
+                                     llvm::StringRef targetTriple, llvm::StringRef cpu,
+                                     llvm::StringRef features)
+{
+    llvm::SHA256 hasher;
+    hashField(hasher, cacheFormat);
+    hashField(hasher, CATALYST_VERSION);
+    hashField(hasher, LLVM_VERSION_STRING);
+    hashField(hasher, options.source);
+    hashField(hasher, options.moduleName);
+    for (const auto &pipeline : options.pipelinesCfg) {
+        hashField(hasher, pipeline.getName());
+        for (const auto &pass : pipeline.getPasses()) {
+            hashField(hasher, pass);
+        }
+    }
+    for (const auto &arg : options.cacheKeyArgs) {
+        hashField(hasher, arg);
+    }
+    hashField(hasher, options.asyncQnodes ? "async" : "sync");
+    hashField(hasher, std::to_string(options.optLevel));
+    hashField(hasher, targetTriple);
+    hashField(hasher, cpu);
+    hashField(hasher, features);
+    return llvm::toHex(hasher.final(), /*LowerCase=*/true);
+}
+
+std::string CompilationCache::getEntry(llvm::StringRef key) const
+{
+    return fs::path(directory) / (key.str() + ".o");
+}
+
+bool CompilationCache::lookup(llvm::StringRef key, llvm::StringRef filename)
+{
+    std::error_code errCode;
+    std::string entry = getEntry(key);
+    if (!fs::copy_file(entry, filename.str(), fs::copy_options::overwrite_existing, errCode)) {
+        return false;
+    }
+
+    // Mark the entry as recently used. It may have been evicted in the meantime, which is fine.
+    fs::last_write_time(entry, fs::file_time_type::clock::now(), errCode);
+    return true;
+}
+
+void CompilationCache::store(const CompilerOptions &options, llvm::StringRef key,
+                             llvm::StringRef filename)
+{
+    std::error_code errCode;
+    fs::create_directories(directory, errCode);
+    if (errCode) {
+        CO_MSG(options, Verbosity::Urgent,
+               "Unable to create the compilation cache: " << errCode.message() << "\n");
+        return;
+    }
+
+    // Copy into a unique file first, as the rename into the entry is atomic while the copy is
+    // not. Concurrent processes storing the same key replace each other's identical entry.
+    llvm::SmallString<128> model(directory);
+    llvm::sys::path::append(model, "%%%%%%%%%%%%%%%%.tmp");
+    llvm::SmallString<128> temporary;
+    llvm::sys::fs::createUniquePath(model, temporary, /*MakeAbsolute=*/false);
+
+    fs::copy_file(filename.str(), temporary.str().str(), errCode);
+    if (!errCode) {
+        fs::rename(temporary.str().str(), getEntry(key), errCode);
+    }
+    if (errCode) {
+        CO_MSG(options, Verbosity::Urgent,
+               "Unable to store in the compilation cache: " << errCode.message() << "\n");
+        std::error_code removeErrCode;
+        fs::remove(temporary.str().str(), removeErrCode);
+        return;
+    }
+
+    evict(options);
+}
+
+void CompilationCache::evict(const CompilerOptions &options)
+{
+    struct Entry {
+        fs::path path;
+        uint64_t size;
+        fs::file_time_type lastUse;
+    };
+
+    std::error_code errCode;
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    auto now = fs::file_time_type::clock::now();
+    for (const auto &file : fs::directory_iterator(directory, errCode)) {
+        std::error_code fileErrCode;
+        uint64_t size = file.file_size(fileErrCode);
+        auto lastUse = file.last_write_time(fileErrCode);
+        if (fileErrCode) {
+            // Removed by another process
+            continue;
+        }
+
+        if (file.path().extension() == ".tmp") {
+            if (now - lastUse > staleTemporaryAge) {
+                fs::remove(file.path(), fileErrCode);
+            }
+            continue;
+        }
+        if (file.path().extension() == ".o") {
+            entries.push_back({file.path(), size, lastUse});
+            totalSize += size;
+        }
+    }
+
+    if (totalSize <= sizeLimit) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry &a, const Entry &b) { return a.lastUse < b.lastUse; });
+    for (const auto &entry : entries) {
+        if (totalSize <= sizeLimit) {
+            break;
+        }
+        // Another process may be evicting the same entry, in which case it is already gone
+        fs::remove(entry.path, errCode);
+        totalSize -= entry.size;
+        CO_MSG(options, Verbosity::Debug,
+               "Evicted '" << entry.path.string() << "' from the compilation cache\n");
+    }
+}
@@ -19,10 +19,13 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <unordered_map>
+#include <utility>
 
 #include "mhlo/IR/register.h"
 #include "mhlo/transforms/passes.h"
@@ -35,6 +38,7 @@
 #include "mlir/Support/FileUtilities.h"
 #include "mlir/Target/LLVMIR/Export.h"
 #include "stablehlo/dialect/Register.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Analysis/CGSCCPassManager.h"
 #include "llvm/Analysis/LoopAnalysisManager.h"
 #include "llvm/IR/LegacyPassManager.h"
@@ -45,10 +49,13 @@
 #include "llvm/Support/InitLLVM.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
 #include "llvm/TargetParser/Host.h"
+#include "llvm/TargetParser/SubtargetFeature.h"
 #include "llvm/Transforms/Coroutines/CoroCleanup.h"
 #include "llvm/Transforms/Coroutines/CoroConditionalWrapper.h"
 #include "llvm/Transforms/Coroutines/CoroEarly.h"
@@ -58,7 +65,9 @@
 #include "Catalyst/IR/CatalystDialect.h"
 #include "Catalyst/Transforms/BufferizableOpInterfaceImpl.h"
 #include "Catalyst/Transforms/Passes.h"
+#include "Driver/CatalystJIT.h"
 #include "Driver/CatalystLLVMTarget.h"
+#include "Driver/CompilationCache.h"
 #include "Driver/CompilerDriver.h"
 #include "Driver/Pipelines.h"
 #include "Driver/Support.h"
@@ -161,9 +170,11 @@ class LinesCount {
             return;
         }
 
+        // Number the values within the operation only, as the passes nested under a multithreaded
+        // pass manager may be modifying its siblings
         std::string opStrBuf;
         llvm::raw_string_ostream rawStrBef{opStrBuf};
-        rawStrBef << *op;
+        op->print(rawStrBef, OpPrintingFlags().useLocalScope());
 
         dump(opStrBuf, name);
     }
@@ -306,6 +317,34 @@ void registerAllCatalystDialects(DialectRegistry &registry)
     registry.insert<gradient::GradientDialect>();
     registry.insert<mitigation::MitigationDialect>();
 }
+
+/// Return whether the IR printing of the pass manager, set up from the command line by
+/// `applyPassManagerCLOptions`, prints the whole module. MLIR doesn't support it together with
+/// multithreading.
+bool isIRPrintingAtModuleScope()
+{
+    auto &registeredOptions = llvm::cl::getRegisteredOptions();
+    auto it = registeredOptions.find("mlir-print-ir-module-scope");
+    if (it == registeredOptions.end()) {
+        return false;
+    }
+    return static_cast<llvm::cl::opt<bool> *>(it->second)->getValue();
+}
+
+/// A handler of the diagnostics of a source, which serializes them with the other outputs of the
+/// driver, as diagnostics may be emitted by the passes running on several threads.
+class SerializedSourceMgrDiagnosticHandler : public SourceMgrDiagnosticHandler {
+  public:
+    SerializedSourceMgrDiagnosticHandler(llvm::SourceMgr &mgr, MLIRContext *ctx,
+                                         raw_ostream &os)
+        : SourceMgrDiagnosticHandler(mgr, ctx, os)
+    {
+        setHandler([this](Diagnostic &diag) {
+            std::lock_guard<std::recursive_mutex> lock(getOutputMutex());
+            emitDiagnostic(diag);
+        });
+    }
+};
 } // namespace
 
 // Determines if the compilation stage should be executed if a checkpointStage is given
@@ -417,6 +456,80 @@ LogicalResult runO2LLVMPasses(const CompilerOptions &options,
     return success();
 }
 
+LogicalResult runOptLLVMPasses(const CompilerOptions &options,
+                               std::shared_ptr<llvm::Module> llvmModule,
+                               llvm::TargetMachine *targetMachine, CompilerOutput &output)
+{
+    if (!shouldRunStage(options, output, "LLVMOpt")) {
+        return success();
+    }
+
+    // As in clang, the loop and SLP vectorizers run from -O2 on. The target machine provides
+    // them the cost model of the target CPU.
+    llvm::PipelineTuningOptions PTO;
+    PTO.LoopVectorization = options.optLevel > 1;
+    PTO.SLPVectorization = options.optLevel > 1;
+    llvm::PassBuilder PB(targetMachine, PTO);
+
+    llvm::LoopAnalysisManager LAM;
+    llvm::FunctionAnalysisManager FAM;
+    llvm::CGSCCAnalysisManager CGAM;
+    llvm::ModuleAnalysisManager MAM;
+
+    PB.registerModuleAnalyses(MAM);
+    PB.registerCGSCCAnalyses(CGAM);
+    PB.registerFunctionAnalyses(FAM);
+    PB.registerLoopAnalyses(LAM);
+    PB.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+
+    const llvm::OptimizationLevel levels[] = {llvm::OptimizationLevel::O1,
+                                              llvm::OptimizationLevel::O2,
+                                              llvm::OptimizationLevel::O3};
+    llvm::ModulePassManager MPM =
+        PB.buildPerModuleDefaultPipeline(levels[std::min(options.optLevel, 3u) - 1]);
+
+    MPM.run(*llvmModule.get(), MAM);
+
+    if (options.keepIntermediate) {
+        std::string tmp;
+        llvm::raw_string_ostream rawStringOstream{tmp};
+        llvmModule->print(rawStringOstream, nullptr);
+        auto outFile = output.nextPipelineDumpFilename("LLVMOpt", ".ll");
+        dumpToFile(options, outFile, tmp);
+    }
+
+    return success();
+}
+
+/// The CPU and features of the target machine. The "native" CPU is replaced by the CPU of the
+/// host, with the features it supports.
+std::pair<std::string, std::string> getTargetCPUAndFeatures(const CompilerOptions &options)
+{
+    if (options.targetCPU != "native") {
+        return {options.targetCPU, ""};
+    }
+
+    llvm::SubtargetFeatures features;
+    for (const auto &feature : llvm::sys::getHostCPUFeatures()) {
+        features.AddFeature(feature.first(), feature.second);
+    }
+    return {llvm::sys::getHostCPUName().str(), features.getString()};
+}
+
+/// Remove the numbered object files left in the workspace by an earlier split code generation
+/// into more partitions, so that the partitions found on disk are the ones of this compilation.
+void removeStaleObjectFiles(const CompilerOptions &options)
+{
+    std::error_code errCode;
+    for (unsigned i = std::max(options.codegenThreads, 1u);; i++) {
+        if (!std::filesystem::remove(options.getPartitionObjectFile(i), errCode)) {
+            return;
+        }
+        CO_MSG(options, Verbosity::Debug,
+               "Removed the stale object file '" << options.getPartitionObjectFile(i) << "'\n");
+    }
+}
+
 LogicalResult runEnzymePasses(const CompilerOptions &options,
                               std::shared_ptr<llvm::Module> llvmModule, CompilerOutput &output)
 {
@@ -483,10 +596,14 @@ std::string readInputFile(const std::string &filename)
 }
 
 LogicalResult preparePassManager(PassManager &pm, const CompilerOptions &options,
-                                 CompilerOutput &output, catalyst::utils::Timer &timer,
+                                 CompilerOutput &output, catalyst::utils::ThreadTimers &timers,
                                  TimingScope &timing)
 {
+    // The callbacks run on the threads of the pass manager, with the operation of the pass being
+    // modified concurrently to its siblings. Each thread times its own passes, the operation is
+    // printed in its local scope and the output is serialized.
     auto beforePassCallback = [&](Pass *pass, Operation *op) {
+        catalyst::utils::Timer &timer = timers.get();
         if (options.verbosity >= Verbosity::Debug && !timer.is_active()) {
             timer.start();
         }
@@ -497,6 +614,8 @@ LogicalResult preparePassManager(PassManager &pm, const CompilerOptions &options
     auto afterPassCallback = [&](Pass *pass, Operation *op) {
         auto pipelineName = pass->getName();
         if (options.verbosity >= Verbosity::Debug) {
+            catalyst::utils::Timer &timer = timers.get();
+            std::lock_guard<std::recursive_mutex> lock(getOutputMutex());
             timer.dump(pipelineName.str(), /*add_endl */ false);
             catalyst::utils::LinesCount::Operation(op);
         }
@@ -504,7 +623,7 @@ LogicalResult preparePassManager(PassManager &pm, const CompilerOptions &options
         if (options.keepIntermediate >= SaveTemps::AfterPass) {
             std::string tmp;
             llvm::raw_string_ostream s{tmp};
-            s << *op;
+            op->print(s, OpPrintingFlags().useLocalScope());
             std::string fileName = pipelineName.str();
             if (auto funcOp = dyn_cast<mlir::func::FuncOp>(op)) {
                 fileName += std::string("_") + funcOp.getName().str();
@@ -515,10 +634,11 @@ LogicalResult preparePassManager(PassManager &pm, const CompilerOptions &options
 
     // For each failed pass, print the owner pipeline name into a diagnostic stream.
     auto afterPassFailedCallback = [&](Pass *pass, Operation *op) {
+        std::lock_guard<std::recursive_mutex> lock(getOutputMutex());
         options.diagnosticStream << "While processing '" << pass->getName().str() << "' pass ";
         std::string tmp;
         llvm::raw_string_ostream s{tmp};
-        s << *op;
+        op->print(s, OpPrintingFlags().useLocalScope());
         if (options.keepIntermediate) {
             dumpToFile(options, output.nextPipelineDumpFilename(pass->getName().str() + "_FAILED"),
                        tmp);
@@ -591,10 +711,10 @@ LogicalResult runLowering(const CompilerOptions &options, MLIRContext *ctx, Modu
                    tmp);
     }
 
-    catalyst::utils::Timer timer{};
+    catalyst::utils::ThreadTimers timers{};
 
     auto pm = PassManager::on<ModuleOp>(ctx, PassManager::Nesting::Implicit);
-    if (failed(preparePassManager(pm, options, output, timer, timing))) {
+    if (failed(preparePassManager(pm, options, output, timers, timing))) {
         llvm::errs() << "Failed to setup pass manager\n";
         return failure();
     }
@@ -652,18 +772,51 @@ LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOutput &
 {
     using timer = catalyst::utils::Timer;
 
-    MLIRContext ctx(registry);
+    // The object files of whole compilations are cached, which skips the compilation entirely
+    // on a hit. Intermediate files and partial compilations are not cached.
+    std::optional<CompilationCache> cache;
+    std::string cacheKey;
+    if (!options.cacheDir.empty() && options.loweringAction == Action::All && !options.jit &&
+        options.codegenThreads <= 1 && !options.keepIntermediate &&
+        options.checkpointStage.empty() && output.outputFilename != "-") {
+        auto [cpu, features] = getTargetCPUAndFeatures(options);
+        cache.emplace(options.cacheDir, options.cacheSizeLimit);
+        cacheKey = CompilationCache::getKey(options, llvm::sys::getDefaultTargetTriple(), cpu,
+                                            features);
+        if (cache->lookup(cacheKey, options.getObjectFile())) {
+            removeStaleObjectFiles(options);
+            CO_MSG(options, Verbosity::Debug, "Compilation cache hit: " << cacheKey << "\n");
+            return success();
+        }
+        CO_MSG(options, Verbosity::Debug, "Compilation cache miss: " << cacheKey << "\n");
+    }
+
+    // The pool runs the passes nested under the module, e.g. on each function. It is created
+    // before the context, which must release it first. Printing the whole module after a pass
+    // and numbering the dumps of every pass require the passes to run in order.
+    unsigned numThreads = options.numThreads;
+    if (numThreads != 1 &&
+        (isIRPrintingAtModuleScope() || options.keepIntermediate >= SaveTemps::AfterPass)) {
+        CO_MSG(options, Verbosity::Debug,
+               "Running the passes on a single thread for the IR printing or dumps\n");
+        numThreads = 1;
+    }
+    std::optional<llvm::DefaultThreadPool> threadPool;
+    MLIRContext ctx(registry, MLIRContext::Threading::DISABLED);
+    if (numThreads != 1) {
+        threadPool.emplace(llvm::hardware_concurrency(numThreads));
+        ctx.setThreadPool(*threadPool);
+    }
     ctx.printOpOnDiagnostic(true);
     ctx.printStackTraceOnDiagnostic(options.verbosity >= Verbosity::Debug);
-    // TODO: FIXME:
-    // Let's try to enable multithreading. Do not forget to protect the printing.
-    ctx.disableMultithreading();
     // The transform dialect doesn't appear to load dependent dialects
     // fpr named passes.
     ctx.loadAllAvailableDialects();
 
-    ScopedDiagnosticHandler scopedHandler(
-        &ctx, [&](Diagnostic &diag) { diag.print(options.diagnosticStream); });
+    ScopedDiagnosticHandler scopedHandler(&ctx, [&](Diagnostic &diag) {
+        std::lock_guard<std::recursive_mutex> lock(getOutputMutex());
+        diag.print(options.diagnosticStream);
+    });
 
     llvm::LLVMContext llvmContext;
     std::shared_ptr<llvm::Module> llvmModule;
@@ -673,7 +826,8 @@ LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOutput &
     auto moduleBuffer = llvm::MemoryBuffer::getMemBufferCopy(options.source, options.moduleName);
     auto sourceMgr = std::make_shared<llvm::SourceMgr>();
     sourceMgr->AddNewSourceBuffer(std::move(moduleBuffer), SMLoc());
-    SourceMgrDiagnosticHandler sourceMgrHandler(*sourceMgr, &ctx, options.diagnosticStream);
+    SerializedSourceMgrDiagnosticHandler sourceMgrHandler(*sourceMgr, &ctx,
+                                                          options.diagnosticStream);
 
     DefaultTimingManager tm;
     applyDefaultTimingManagerCLOptions(tm);
@@ -776,11 +930,11 @@ LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOutput &
         std::string err;
         auto target = llvm::TargetRegistry::lookupTarget(targetTriple, err);
         llvm::TargetOptions opt;
-        const char *cpu = "generic";
-        const char *features = "";
+        auto [cpu, features] = getTargetCPUAndFeatures(options);
         auto targetMachine =
             target->createTargetMachine(targetTriple, cpu, features, opt, llvm::Reloc::Model::PIC_);
-        targetMachine->setOptLevel(llvm::CodeGenOptLevel::None);
+        targetMachine->setOptLevel(
+            llvm::CodeGenOpt::getLevel(options.optLevel).value_or(llvm::CodeGenOptLevel::None));
         llvmModule->setDataLayout(targetMachine->createDataLayout());
         llvmModule->setTargetTriple(targetTriple);
 
@@ -812,6 +966,27 @@ LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOutput &
             catalyst::utils::LinesCount::Module(*llvmModule.get());
         }
 
+        if (options.optLevel > 0) {
+            TimingScope optPassesTiming = llcTiming.nest("LLVM optimization passes");
+            if (failed(timer::timer(runOptLLVMPasses, "runOptLLVMPasses", /* add_endl */ false,
+                                    options, llvmModule, targetMachine, output))) {
+                return failure();
+            }
+            optPassesTiming.stop();
+            catalyst::utils::LinesCount::Module(*llvmModule.get());
+        }
+
+        if (options.jit) {
+            TimingScope jitTiming = llcTiming.nest("JIT");
+            if (failed(timer::timer(compileJIT, "compileJIT", /* add_endl */ true, options,
+                                    *llvmModule, output))) {
+                return failure();
+            }
+            jitTiming.stop();
+            llcTiming.stop();
+            return success();
+        }
+
         std::string errorMessage;
         auto outfile = openOutputFile(output.outputFilename, &errorMessage);
         if (output.outputFilename == "-" && llvmModule) {
@@ -828,10 +1003,22 @@ LogicalResult QuantumDriverMain(const CompilerOptions &options, CompilerOutput &
             outIRStream << *llvmModule;
         }
 
-        if (failed(timer::timer(compileObjectFile, "compileObjFile", /* add_endl */ true, options,
-                                llvmModule, targetMachine, options.getObjectFile()))) {
+        removeStaleObjectFiles(options);
+        if (options.codegenThreads > 1) {
+            if (failed(timer::timer(compileObjectFiles, "compileObjFiles", /* add_endl */ true,
+                                    options, llvmModule, targetMachine, options.getObjectFiles(),
+                                    outputTiming))) {
+                return failure();
+            }
+        }
+        else if (failed(timer::timer(compileObjectFile, "compileObjFile", /* add_endl */ true,
+                                     options, llvmModule, targetMachine,
+                                     options.getObjectFile()))) {
             return failure();
         }
+        if (cache) {
+            cache->store(options, cacheKey, options.getObjectFile());
+        }
         outputTiming.stop();
         llcTiming.stop();
     }
@@ -912,6 +1099,68 @@ std::vector<Pipeline> parsePipelines(const cl::list<std::string> &catalystPipeli
     return allPipelines;
 }
 
+/// Whether a command-line option doesn't change the compiled object: the output locations, the
+/// options of the compilation cache, and the diagnostic, timing, and threading options.
+bool isCacheNeutralOption(llvm::StringRef name)
+{
+    static const llvm::StringSet<> neutralOptions = {
+        "o",
+        "workspace",
+        "cache-dir",
+        "cache-size-limit",
+        "verbose",
+        "dump-catalyst-pipeline",
+        "keep-intermediate",
+        "save-ir-after-each",
+        "num-threads",
+        "jit-run",
+        "debug",
+        "debug-only",
+        "dump-pass-pipeline",
+        "verify-each",
+        "log-actions-to",
+        "log-mlir-actions-filter",
+        "profile-actions-to",
+        "mlir-enable-debugger-hook",
+        "mlir-disable-threading",
+        "mlir-output-format",
+        "mlir-pass-statistics",
+        "mlir-pass-statistics-display",
+        "mlir-timing",
+        "mlir-timing-display",
+    };
+    // The IR printing, and the crash reproducers of the pass manager
+    return neutralOptions.contains(name) || name.starts_with("mlir-print-") ||
+           name.starts_with("mlir-elide-") || name.starts_with("mlir-pass-pipeline-");
+}
+
+/// The command-line arguments that may change the compiled object, i.e. all of them except the
+/// input file and the options that don't (see `isCacheNeutralOption`).
+std::vector<std::string> getCacheKeyArgs(int argc, char **argv, llvm::StringRef inputFilename)
+{
+    const auto &registeredOptions = llvm::cl::getRegisteredOptions();
+
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; i++) {
+        llvm::StringRef arg = argv[i];
+        if (arg == inputFilename) {
+            continue;
+        }
+        auto [name, value] = arg.ltrim('-').split('=');
+        if (arg.starts_with("-") && isCacheNeutralOption(name)) {
+            // Also skip the value of the option if it is the next argument
+            auto it = registeredOptions.find(name);
+            if (!arg.contains('=') && it != registeredOptions.end() &&
+                it->second->getValueExpectedFlag() == llvm::cl::ValueRequired) {
+                i++;
+            }
+            continue;
+        }
+        args.push_back(arg.str());
+    }
+    return args;
+}
+
 int QuantumDriverMainFromCL(int argc, char **argv)
 {
     // Command-line options
@@ -956,6 +1205,39 @@ int QuantumDriverMainFromCL(int argc, char **argv)
     cl::opt<bool> DumpPassPipeline("dump-catalyst-pipeline",
                                    cl::desc("Print the pipeline that will be run"), cl::init(false),
                                    cl::cat(CatalystCat));
+    cl::opt<char> OptLevel("O",
+                           cl::desc("Optimization level of the LLVM stage: [-O0, -O1, -O2, -O3]"),
+                           cl::Prefix, cl::init('0'), cl::cat(CatalystCat));
+    cl::opt<std::string> TargetCPU("mcpu",
+                                   cl::desc("Target CPU, or 'native' for the CPU of the host"),
+                                   cl::init("generic"), cl::cat(CatalystCat));
+    cl::alias TargetArch("march", cl::desc("Alias for --mcpu"), cl::aliasopt(TargetCPU),
+                         cl::cat(CatalystCat));
+    cl::opt<std::string> CacheDir(
+        "cache-dir", cl::desc("Directory of the compilation cache (disabled if empty)"),
+        cl::init(""), cl::cat(CatalystCat));
+    cl::opt<unsigned> CacheSizeLimit("cache-size-limit",
+                                     cl::desc("Maximum size of the compilation cache in MiB"),
+                                     cl::init(1024), cl::cat(CatalystCat));
+    cl::opt<bool> JIT("jit", cl::desc("Run the program in an in-process JIT"), cl::init(false),
+                      cl::cat(CatalystCat));
+    cl::opt<bool> JITLazy("jit-lazy", cl::desc("Compile the functions of the JIT on first call"),
+                          cl::init(false), cl::cat(CatalystCat));
+    cl::list<std::string> JITLibraries(
+        "jit-lib", cl::desc("Shared library to resolve the symbols of the JIT from"),
+        cl::ZeroOrMore, cl::cat(CatalystCat));
+    cl::opt<std::string> JITRun("jit-run",
+                                cl::desc("Function of the JIT to call, of type 'int ()', whose "
+                                         "result is the exit code"),
+                                cl::init(""), cl::cat(CatalystCat));
+    cl::opt<unsigned> CodegenThreads(
+        "codegen-threads",
+        cl::desc("Number of partitions of the LLVM module compiled in parallel to object files"),
+        cl::init(1), cl::cat(CatalystCat));
+    cl::opt<unsigned> NumThreads(
+        "num-threads",
+        cl::desc("Number of threads of the pass manager (0 uses all hardware threads)"),
+        cl::init(0), cl::cat(CatalystCat));
 
     // Create dialect registry
     DialectRegistry registry;
@@ -983,6 +1265,11 @@ int QuantumDriverMainFromCL(int argc, char **argv)
     llvm::InitLLVM y(argc, argv);
     MlirOptMainConfig config = MlirOptMainConfig::createFromCLOptions();
 
+    if (OptLevel.getValue() < '0' || OptLevel.getValue() > '3') {
+        llvm::errs() << "Error: Invalid optimization level: -O" << OptLevel.getValue() << "\n";
+        return 1;
+    }
+
     // Read the input IR file
     std::string source = readInputFile(inputFilename);
     if (source.empty()) {
@@ -1005,7 +1292,17 @@ int QuantumDriverMainFromCL(int argc, char **argv)
                             .pipelinesCfg = parsePipelines(CatalystPipeline),
                             .checkpointStage = CheckpointStage,
                             .loweringAction = LoweringAction,
-                            .dumpPassPipeline = DumpPassPipeline};
+                            .dumpPassPipeline = DumpPassPipeline,
+                            .numThreads = NumThreads,
+                            .optLevel = static_cast<unsigned>(OptLevel.getValue() - '0'),
+                            .targetCPU = TargetCPU,
+                            .cacheDir = CacheDir,
+                            .cacheSizeLimit = static_cast<uint64_t>(CacheSizeLimit) << 20,
+                            .cacheKeyArgs = getCacheKeyArgs(argc, argv, inputFilename),
+                            .jit = JIT || JITLazy,
+                            .jitLazy = JITLazy,
+                            .jitLibraries = JITLibraries,
+                            .codegenThreads = CodegenThreads};
 
     mlir::LogicalResult result = QuantumDriverMain(options, *output, registry);
 
@@ -1018,5 +1315,19 @@ int QuantumDriverMainFromCL(int argc, char **argv)
 
     if (Verbose)
         llvm::outs() << "Compilation successful:\n" << output->diagnosticMessages << "\n";
+
+    if (!JITRun.empty()) {
+        if (!output->jit) {
+            llvm::errs() << "Error: --jit-run requires the LLVM stage to run with --jit\n";
+            return 1;
+        }
+        auto entry = output->jit->lookupFunction<int()>(JITRun);
+        if (!entry) {
+            llvm::errs() << "Error: " << llvm::toString(entry.takeError()) << "\n";
+            return 1;
+        }
+        llvm::outs().flush();
+        return (*entry)();
+    }
     return 0;
 }
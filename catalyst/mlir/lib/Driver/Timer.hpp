@@ -22,9 +22,11 @@
 #include <iomanip>
 #include <ios>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
 #include <utility> // std::forward
 
 #include <ctime>
@@ -181,4 +183,22 @@ class Timer {
         return result;
     }
 };
+
+/**
+ * ThreadTimers: One `Timer` per thread, for code blocks that run concurrently such as the
+ * passes nested under a multithreaded pass manager.
+ */
+class ThreadTimers {
+  private:
+    std::mutex mutex;
+    std::unordered_map<std::thread::id, Timer> timers;
+
+  public:
+    // The timer of the calling thread. References to the timers stay valid when others are added.
+    [[nodiscard]] Timer &get()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return timers[std::this_thread::get_id()];
+    }
+};
 } // namespace catalyst::utils
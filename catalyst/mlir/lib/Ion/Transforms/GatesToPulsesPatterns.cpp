@@ -26,6 +26,7 @@
 #include "Ion/Transforms/Patterns.h"
 #include "Ion/Transforms/oqd_database_managers.hpp"
 #include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Utils/QubitIndexAnalysis.h"
 
 using namespace mlir;
 using namespace catalyst::ion;
@@ -43,50 +44,6 @@ enum LevelTransition {
     UP_E2 = 3,
 };
 
-/**
- * @brief Walk back the qubit SSA until we reach an ExtractOp that has an idxAttr set, or until we
- *        reach the root of the SSA.
- *
- *        TODO (backlog): This function will likely not scale well as circuit depth increases.
- *        Is there a more efficient way to get the index of the qubit SSA?
- *
- * @param gate The gate that uses the qubit SSA.
- * @param position The position of the qubit SSA in the gate.
- * @return The index of the qubit SSA if it is known, otherwise std::nullopt.
- */
-std::optional<int64_t> walkBackQubitSSA(quantum::CustomOp gate, int64_t position)
-{
-    // TODO (backlog): make that function able to cross control flow op (for, while, ...)
-    auto qubit = gate.getInQubits()[position];
-    auto definingOp = qubit.getDefiningOp();
-
-    if (auto extractOp = dyn_cast<quantum::ExtractOp>(definingOp)) {
-        if (extractOp.getIdxAttr().has_value()) {
-            return extractOp.getIdxAttr().value();
-        }
-        return std::nullopt;
-    }
-    else {
-        // TODO (backlog): if a pass on one operation fails, there may be a mixture of quantum ops
-        // and parallel protocol ops in the IR. Since MLIR will continue processing other ops after
-        // a failure, we may end up in a situation in which we attempt to cast a parallel protocol
-        // op to a quantum op, which will raise an incompatible-type assertion error. It would be
-        // best if we can immediately and gracefully exit after an emitError() call before this
-        // happens, or modify this function to handle this case.
-        auto customOp = cast<quantum::CustomOp>(definingOp);
-        auto outQubits = customOp.getOutQubits();
-        int64_t index = 0;
-        for (const auto &outQubit : outQubits) {
-            if (qubit == outQubit) {
-                position = index;
-                break;
-            }
-            ++index;
-        }
-        return walkBackQubitSSA(customOp, position);
-    }
-}
-
 /**
  * @brief Returns the index of the two-qubit combination in the set of all possible combinations of
  *        two qubits in an n-qubit system.
@@ -206,9 +163,10 @@ mlir::Value computePulseDuration(mlir::PatternRewriter &rewriter, mlir::Location
 }
 
 mlir::LogicalResult oneQubitGateToPulse(CustomOp op, mlir::PatternRewriter &rewriter, double phase1,
-                                        double phase2, const std::vector<Beam> &beams1)
+                                        double phase2, const std::vector<Beam> &beams1,
+                                        const QubitIndexAnalysis &qubitIndices)
 {
-    auto qubitIndex = walkBackQubitSSA(op, 0);
+    auto qubitIndex = qubitIndices.getQubitIndex(op.getInQubits()[0]);
     if (qubitIndex.has_value()) {
         // Set the optional transition index now
         auto qubitIndexValue = qubitIndex.value();
@@ -257,13 +215,14 @@ mlir::LogicalResult oneQubitGateToPulse(CustomOp op, mlir::PatternRewriter &rewr
 
 mlir::LogicalResult MSGateToPulse(CustomOp op, mlir::PatternRewriter &rewriter,
                                   const std::vector<Beam> &beams2,
-                                  const std::vector<Phonon> &phonons)
+                                  const std::vector<Phonon> &phonons,
+                                  const QubitIndexAnalysis &qubitIndices)
 {
     auto qnode = op->getParentOfType<func::FuncOp>();
     MLIRContext *ctx = op.getContext();
 
-    auto qubitIndex0 = walkBackQubitSSA(op, 0);
-    auto qubitIndex1 = walkBackQubitSSA(op, 1);
+    auto qubitIndex0 = qubitIndices.getQubitIndex(op.getInQubits()[0]);
+    auto qubitIndex1 = qubitIndices.getQubitIndex(op.getInQubits()[1]);
 
     if (qubitIndex0.has_value() && qubitIndex1.has_value()) {
         quantum::AllocOp allocOp;
@@ -491,9 +450,11 @@ struct GatesToPulsesRewritePattern : public mlir::OpConversionPattern<CustomOp>
     std::vector<Beam> beams1;
     std::vector<Beam> beams2;
     std::vector<Phonon> phonons;
+    const QubitIndexAnalysis &qubitIndices;
 
-    GatesToPulsesRewritePattern(mlir::MLIRContext *ctx, const OQDDatabaseManager &dataManager)
-        : mlir::OpConversionPattern<CustomOp>::OpConversionPattern(ctx)
+    GatesToPulsesRewritePattern(mlir::MLIRContext *ctx, const OQDDatabaseManager &dataManager,
+                                const QubitIndexAnalysis &qubitIndices)
+        : mlir::OpConversionPattern<CustomOp>::OpConversionPattern(ctx), qubitIndices(qubitIndices)
     {
         beams1 = dataManager.getBeams1Params();
         beams2 = dataManager.getBeams2Params();
@@ -507,17 +468,18 @@ struct GatesToPulsesRewritePattern : public mlir::OpConversionPattern<CustomOp>
         // Assume ions are in the same funcop as the operations
         // RX case -> PP(P1, P2)
         if (op.getGateName() == "RX") {
-            auto result = oneQubitGateToPulse(op, rewriter, 0.0, 0.0, beams1);
+            auto result = oneQubitGateToPulse(op, rewriter, 0.0, 0.0, beams1, qubitIndices);
             return result;
         }
         // RY case -> PP(P1, P2)
         else if (op.getGateName() == "RY") {
-            auto result = oneQubitGateToPulse(op, rewriter, llvm::numbers::pi / 2, 0, beams1);
+            auto result = oneQubitGateToPulse(op, rewriter, llvm::numbers::pi / 2, 0, beams1,
+                                              qubitIndices);
             return result;
         }
         // MS case -> PP(P1, P2, P3, P4, P5, P6)
         else if (op.getGateName() == "MS") {
-            auto result = MSGateToPulse(op, rewriter, beams2, phonons);
+            auto result = MSGateToPulse(op, rewriter, beams2, phonons, qubitIndices);
             return result;
         }
         return failure();
@@ -525,9 +487,10 @@ struct GatesToPulsesRewritePattern : public mlir::OpConversionPattern<CustomOp>
 };
 
 void populateGatesToPulsesPatterns(RewritePatternSet &patterns,
-                                   const OQDDatabaseManager &dataManager)
+                                   const OQDDatabaseManager &dataManager,
+                                   const QubitIndexAnalysis &qubitIndices)
 {
-    patterns.add<GatesToPulsesRewritePattern>(patterns.getContext(), dataManager);
+    patterns.add<GatesToPulsesRewritePattern>(patterns.getContext(), dataManager, qubitIndices);
 }
 
 } // namespace ion
@@ -28,6 +28,7 @@
 #include "Ion/Transforms/oqd_database_managers.hpp"
 #include "Ion/Transforms/oqd_database_types.hpp"
 #include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Utils/QubitIndexAnalysis.h"
 
 using namespace mlir;
 
@@ -121,8 +122,11 @@ struct GatesToPulsesPass : impl::GatesToPulsesPassBase<GatesToPulsesPass> {
             builder.create<ion::ModesOp>(op->getLoc(), builder.getArrayAttr(phonons[0]));
         }
 
+        // The static wire of every qubit value is computed once, before the gates are lowered.
+        const auto &qubitIndices = getAnalysis<quantum::QubitIndexAnalysis>();
+
         RewritePatternSet ionPatterns(&getContext());
-        populateGatesToPulsesPatterns(ionPatterns, dataManager);
+        populateGatesToPulsesPatterns(ionPatterns, dataManager, qubitIndices);
 
         if (failed(applyPartialConversion(op, target, std::move(ionPatterns)))) {
             return signalPassFailure();
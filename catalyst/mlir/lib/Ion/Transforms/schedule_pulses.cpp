@@ -0,0 +1,597 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/TypeSwitch.h"
+
+#include "mlir/Dialect/Arith/IR/Arith.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Pass/Pass.h"
+
+#include "Ion/IR/IonOps.h"
+#include "Ion/Transforms/Passes.h"
+#include "Quantum/Utils/QubitIndexAnalysis.h"
+
+using namespace mlir;
+
+namespace catalyst {
+namespace ion {
+
+#define GEN_PASS_DECL_SCHEDULEPULSESPASS
+#define GEN_PASS_DEF_SCHEDULEPULSESPASS
+#include "Ion/Transforms/Passes.h.inc"
+
+namespace {
+
+// Number of existing layers considered for a protocol, from the earliest one its dependencies
+// allow. This bounds the scheduling time of a segment to be linear in its number of operations.
+constexpr size_t LayerWindow = 8;
+
+// Depth of the operations followed to bound a pulse duration
+constexpr unsigned BoundsDepth = 16;
+
+// Whether a protocol merged by this pass includes an entangling protocol. Merged protocols act
+// on several ions whether or not they entangle them, so a later run can't tell from the ions.
+constexpr llvm::StringLiteral EntanglingAttrName = "ion.entangling";
+
+// The resources and duration of a parallel protocol
+struct Protocol {
+    ParallelProtocolOp op;
+    SmallVector<int64_t> wires;
+    // Protocols on unknown ions are never packed with other protocols.
+    bool exclusive = false;
+    // Entangling protocols drive the phonon modes shared by all the ions.
+    bool entangling = false;
+    // An upper bound of the longest pulse duration, if all pulse durations are bounded
+    std::optional<double> duration;
+};
+
+// A set of protocols that run in parallel
+struct Layer {
+    SmallVector<size_t> members;
+    llvm::SmallDenseSet<int64_t, 8> wires;
+    bool exclusive = false;
+    bool entangling = false;
+    double duration = 0.0;
+
+    bool accepts(const Protocol &protocol) const
+    {
+        if (members.empty()) {
+            return true;
+        }
+        if (exclusive || protocol.exclusive || (entangling && protocol.entangling)) {
+            return false;
+        }
+        return llvm::none_of(protocol.wires, [&](int64_t wire) { return wires.contains(wire); });
+    }
+
+    // The increase of the duration of the layer if the protocol joins it
+    double cost(const Protocol &protocol) const
+    {
+        return std::max(duration, protocol.duration.value_or(0.0)) - duration;
+    }
+
+    void add(size_t index, const Protocol &protocol)
+    {
+        members.push_back(index);
+        wires.insert(protocol.wires.begin(), protocol.wires.end());
+        exclusive |= protocol.exclusive;
+        entangling |= protocol.entangling;
+        duration = std::max(duration, protocol.duration.value_or(0.0));
+    }
+};
+
+// A closed interval of values
+struct Bounds {
+    double lower;
+    double upper;
+
+    static Bounds join(Bounds a, Bounds b)
+    {
+        return {std::min(a.lower, b.lower), std::max(a.upper, b.upper)};
+    }
+};
+
+/**
+ * @brief Bound a floating-point value computed from constants.
+ *
+ *        The arithmetic operations, the remainder by a constant and the conditionals of the
+ *        normalized angles of the gates-to-pulses lowering are followed. A remainder by a constant
+ *        is bounded even if its dividend is a runtime value, e.g. the angle of a gate.
+ */
+std::optional<Bounds> getBounds(Value value, unsigned depth = 0)
+{
+    FloatAttr constant;
+    if (matchPattern(value, m_Constant(&constant))) {
+        double c = constant.getValueAsDouble();
+        return Bounds{c, c};
+    }
+    Operation *op = value.getDefiningOp();
+    if (!op || depth == BoundsDepth) {
+        return std::nullopt;
+    }
+
+    auto operandBounds = [&](Value operand) { return getBounds(operand, depth + 1); };
+    auto binary = [&](Operation *binaryOp, auto combine) -> std::optional<Bounds> {
+        auto lhs = operandBounds(binaryOp->getOperand(0));
+        auto rhs = operandBounds(binaryOp->getOperand(1));
+        if (!lhs || !rhs) {
+            return std::nullopt;
+        }
+        return combine(lhs.value(), rhs.value());
+    };
+    // The bounds of a product or quotient are reached at the corners of the operand bounds.
+    auto corners = [](Bounds lhs, Bounds rhs, auto apply) {
+        double values[] = {apply(lhs.lower, rhs.lower), apply(lhs.lower, rhs.upper),
+                           apply(lhs.upper, rhs.lower), apply(lhs.upper, rhs.upper)};
+        return Bounds{*std::min_element(std::begin(values), std::end(values)),
+                      *std::max_element(std::begin(values), std::end(values))};
+    };
+
+    return llvm::TypeSwitch<Operation *, std::optional<Bounds>>(op)
+        .Case([&](arith::AddFOp addOp) {
+            return binary(addOp, [](Bounds lhs, Bounds rhs) {
+                return Bounds{lhs.lower + rhs.lower, lhs.upper + rhs.upper};
+            });
+        })
+        .Case([&](arith::SubFOp subOp) {
+            return binary(subOp, [](Bounds lhs, Bounds rhs) {
+                return Bounds{lhs.lower - rhs.upper, lhs.upper - rhs.lower};
+            });
+        })
+        .Case([&](arith::MulFOp mulOp) {
+            return binary(mulOp, [&](Bounds lhs, Bounds rhs) {
+                return corners(lhs, rhs, [](double a, double b) { return a * b; });
+            });
+        })
+        .Case([&](arith::DivFOp divOp) -> std::optional<Bounds> {
+            auto rhs = operandBounds(divOp.getRhs());
+            auto lhs = operandBounds(divOp.getLhs());
+            if (!lhs || !rhs || (rhs->lower <= 0.0 && rhs->upper >= 0.0)) {
+                return std::nullopt;
+            }
+            return corners(lhs.value(), rhs.value(), [](double a, double b) { return a / b; });
+        })
+        .Case([&](arith::NegFOp negOp) -> std::optional<Bounds> {
+            auto operand = operandBounds(negOp.getOperand());
+            if (!operand) {
+                return std::nullopt;
+            }
+            return Bounds{-operand->upper, -operand->lower};
+        })
+        .Case([&](arith::RemFOp remOp) -> std::optional<Bounds> {
+            // The remainder has the sign of the dividend, and a smaller magnitude than the divisor
+            auto rhs = operandBounds(remOp.getRhs());
+            if (!rhs || rhs->lower != rhs->upper || rhs->lower == 0.0) {
+                return std::nullopt;
+            }
+            const double divisor = std::abs(rhs->lower);
+            auto lhs = operandBounds(remOp.getLhs());
+            if (lhs && lhs->lower == lhs->upper) {
+                double remainder = std::fmod(lhs->lower, divisor);
+                return Bounds{remainder, remainder};
+            }
+            double lower = lhs && lhs->lower >= 0.0 ? 0.0 : -divisor;
+            double upper = lhs && lhs->upper <= 0.0 ? 0.0 : divisor;
+            return Bounds{lower, upper};
+        })
+        .Case([&](arith::SelectOp selectOp) -> std::optional<Bounds> {
+            auto trueBounds = operandBounds(selectOp.getTrueValue());
+            auto falseBounds = operandBounds(selectOp.getFalseValue());
+            if (!trueBounds || !falseBounds) {
+                return std::nullopt;
+            }
+            return Bounds::join(trueBounds.value(), falseBounds.value());
+        })
+        .Case([&](scf::IfOp ifOp) -> std::optional<Bounds> {
+            if (ifOp.getElseRegion().empty()) {
+                return std::nullopt;
+            }
+            const unsigned index = cast<OpResult>(value).getResultNumber();
+            auto thenBounds = operandBounds(ifOp.thenYield().getOperand(index));
+            auto elseBounds = operandBounds(ifOp.elseYield().getOperand(index));
+            if (!thenBounds || !elseBounds) {
+                return std::nullopt;
+            }
+            return Bounds::join(thenBounds.value(), elseBounds.value());
+        })
+        .Default([](Operation *) { return std::nullopt; });
+}
+
+// An upper bound of the longest pulse of the protocol, if all its pulse durations are bounded
+std::optional<double> getDurationBound(ParallelProtocolOp op)
+{
+    std::optional<double> duration = 0.0;
+    op.getBodyRegion().walk([&](PulseOp pulse) {
+        std::optional<Bounds> time = getBounds(pulse.getTime());
+        if (!time) {
+            duration = std::nullopt;
+            return WalkResult::interrupt();
+        }
+        duration = std::max(duration.value(), time->upper);
+        return WalkResult::advance();
+    });
+    return duration;
+}
+
+// Statistics are integers, so durations are reported in thousandths of the time unit.
+uint64_t toStatistic(double duration)
+{
+    return static_cast<uint64_t>(std::llround(duration * 1e3));
+}
+
+/**
+ * @brief Schedule the parallel protocols of a segment of a block into layers.
+ *
+ *        A segment is a range of operations of a block that may be reordered freely, as long as
+ *        the SSA dependencies are respected: the parallel protocols and the operations without
+ *        memory effects. The protocols of a layer are merged into a single protocol.
+ */
+class SegmentScheduler {
+  public:
+    SegmentScheduler(ArrayRef<Operation *> segment, ArrayRef<Protocol> protocols,
+                     const DenseMap<Operation *, size_t> &protocolIndices)
+        : segment(segment), protocols(protocols), protocolOf(segment.size())
+    {
+        DenseMap<Operation *, size_t> positions;
+        for (auto [i, op] : llvm::enumerate(segment)) {
+            positions[op] = i;
+            auto it = protocolIndices.find(op);
+            if (it != protocolIndices.end()) {
+                protocolOf[i] = it->second;
+            }
+        }
+
+        // The values used in an operation, or in its nested regions, that are defined by earlier
+        // operations of the segment.
+        preds.resize(segment.size());
+        succs.resize(segment.size());
+        Block *block = segment.front()->getBlock();
+        for (auto [i, op] : llvm::enumerate(segment)) {
+            op->walk([&, i = i, op = op](Operation *nested) {
+                for (Value operand : nested->getOperands()) {
+                    Operation *def = operand.getDefiningOp();
+                    if (!def) {
+                        def = operand.getParentBlock()->getParentOp();
+                    }
+                    Operation *ancestor = def ? block->findAncestorOpInBlock(*def) : nullptr;
+                    if (!ancestor || ancestor == op) {
+                        continue;
+                    }
+                    auto it = positions.find(ancestor);
+                    if (it != positions.end()) {
+                        preds[i].push_back(it->second);
+                        succs[it->second].push_back(i);
+                    }
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Assign a layer to every protocol.
+     *
+     * @param latest Whether to schedule the protocols as late as possible.
+     * @return The layer of each protocol, and the number of layers.
+     */
+    std::pair<SmallVector<size_t>, size_t> assignLayers(bool latest) const
+    {
+        // As late as possible is as soon as possible on the reversed dependencies.
+        const auto &deps = latest ? succs : preds;
+        const size_t n = segment.size();
+
+        SmallVector<size_t> layerOf(protocols.size());
+        SmallVector<size_t> ready(n, 0);
+        SmallVector<Layer> layers;
+        for (size_t step = 0; step < n; step++) {
+            const size_t i = latest ? n - 1 - step : step;
+
+            size_t lower = 0;
+            for (size_t j : deps[i]) {
+                lower = std::max(lower, ready[j]);
+            }
+
+            if (!protocolOf[i].has_value()) {
+                ready[i] = lower;
+                continue;
+            }
+
+            const size_t p = protocolOf[i].value();
+            const size_t layer = chooseLayer(layers, protocols[p], lower);
+            if (layer == layers.size()) {
+                layers.emplace_back();
+            }
+            layers[layer].add(p, protocols[p]);
+            layerOf[p] = layer;
+            ready[i] = layer + 1;
+        }
+
+        if (latest) {
+            for (size_t &layer : layerOf) {
+                layer = layers.size() - 1 - layer;
+            }
+        }
+        return {layerOf, layers.size()};
+    }
+
+    /**
+     * @brief Reorder the segment before `anchor`, and merge the protocols of each layer.
+     *
+     * @return The number of protocols after merging, and the bound of their total duration.
+     */
+    std::pair<size_t, double> emit(ArrayRef<size_t> layerOf, size_t numLayers, Operation *anchor)
+    {
+        SmallVector<SmallVector<size_t>> layers(numLayers);
+        for (size_t i = 0; i < segment.size(); i++) {
+            if (protocolOf[i].has_value()) {
+                layers[layerOf[protocolOf[i].value()]].push_back(protocolOf[i].value());
+            }
+        }
+
+        // The first layer whose protocols may use the results of each operation. The other
+        // operations are moved right before that layer, in their original order.
+        SmallVector<size_t> ready(segment.size(), 0);
+        SmallVector<SmallVector<Operation *>> readyOps(numLayers + 1);
+        for (size_t i = 0; i < segment.size(); i++) {
+            for (size_t j : preds[i]) {
+                ready[i] = std::max(ready[i], ready[j]);
+            }
+            if (protocolOf[i].has_value()) {
+                ready[i] = layerOf[protocolOf[i].value()] + 1;
+            }
+            else {
+                readyOps[ready[i]].push_back(segment[i]);
+            }
+        }
+
+        auto moveReadyOps = [&](size_t layer) {
+            for (Operation *op : readyOps[layer]) {
+                op->moveBefore(anchor);
+            }
+        };
+
+        double duration = 0.0;
+        for (size_t layer = 0; layer < numLayers; layer++) {
+            moveReadyOps(layer);
+
+            double layerDuration = 0.0;
+            bool entangling = false;
+            SmallVector<ParallelProtocolOp> members;
+            for (size_t p : layers[layer]) {
+                members.push_back(protocols[p].op);
+                layerDuration = std::max(layerDuration, protocols[p].duration.value_or(0.0));
+                entangling |= protocols[p].entangling;
+            }
+            duration += layerDuration;
+
+            if (members.size() == 1) {
+                members.front()->moveBefore(anchor);
+            }
+            else {
+                mergeProtocols(members, entangling, anchor);
+            }
+        }
+        moveReadyOps(numLayers);
+
+        return {numLayers, duration};
+    }
+
+  private:
+    ArrayRef<Operation *> segment;
+    ArrayRef<Protocol> protocols;
+    SmallVector<std::optional<size_t>> protocolOf;
+    SmallVector<SmallVector<size_t>> preds;
+    SmallVector<SmallVector<size_t>> succs;
+
+    static size_t chooseLayer(ArrayRef<Layer> layers, const Protocol &protocol, size_t lower)
+    {
+        // A new layer costs the whole duration of the protocol.
+        size_t best = layers.size();
+        double bestCost = protocol.duration.value_or(0.0);
+
+        const size_t end = std::min(layers.size(), lower + LayerWindow);
+        for (size_t layer = lower; layer < end; layer++) {
+            if (!layers[layer].accepts(protocol)) {
+                continue;
+            }
+            double cost = layers[layer].cost(protocol);
+            if (cost < bestCost || (cost == bestCost && best == layers.size())) {
+                best = layer;
+                bestCost = cost;
+            }
+        }
+        return best;
+    }
+
+    static void mergeProtocols(ArrayRef<ParallelProtocolOp> members, bool entangling,
+                               Operation *anchor)
+    {
+        SmallVector<Value> inQubits;
+        SmallVector<Location> locs;
+        for (ParallelProtocolOp member : members) {
+            inQubits.append(member.getInQubits().begin(), member.getInQubits().end());
+            locs.push_back(member.getLoc());
+        }
+
+        OpBuilder builder(anchor);
+        SmallVector<Value> yielded;
+        auto merged = builder.create<ParallelProtocolOp>(
+            builder.getFusedLoc(locs), inQubits,
+            [&](OpBuilder &bodyBuilder, Location loc, ValueRange args) {
+                size_t offset = 0;
+                for (ParallelProtocolOp member : members) {
+                    Block &body = member.getBodyRegion().front();
+                    IRMapping mapping;
+                    mapping.map(body.getArguments(), args.slice(offset, body.getNumArguments()));
+                    for (Operation &op : body.without_terminator()) {
+                        bodyBuilder.clone(op, mapping);
+                    }
+                    for (Value value : body.getTerminator()->getOperands()) {
+                        yielded.push_back(mapping.lookupOrDefault(value));
+                    }
+                    offset += body.getNumArguments();
+                }
+            });
+        merged.getBodyRegion().front().getTerminator()->setOperands(yielded);
+        merged->setAttr(EntanglingAttrName, builder.getBoolAttr(entangling));
+
+        size_t offset = 0;
+        for (ParallelProtocolOp member : members) {
+            const size_t numResults = member->getNumResults();
+            member->replaceAllUsesWith(merged->getResults().slice(offset, numResults));
+            member->erase();
+            offset += numResults;
+        }
+    }
+};
+
+} // namespace
+
+struct SchedulePulsesPass : impl::SchedulePulsesPassBase<SchedulePulsesPass> {
+    using SchedulePulsesPassBase::SchedulePulsesPassBase;
+
+    bool canScheduleOn(RegisteredOperationName opInfo) const override
+    {
+        return opInfo.hasInterface<FunctionOpInterface>();
+    }
+
+    // The static wire of a qubit, following the protocols merged by this pass
+    std::optional<int64_t> getWire(Value qubit, const quantum::QubitIndexAnalysis &qubitIndices)
+    {
+        while (true) {
+            if (std::optional<int64_t> wire = qubitIndices.getQubitIndex(qubit)) {
+                return wire;
+            }
+            auto protocol = qubit.getDefiningOp<ParallelProtocolOp>();
+            if (!protocol) {
+                return std::nullopt;
+            }
+            qubit = protocol.getInQubits()[cast<OpResult>(qubit).getResultNumber()];
+        }
+    }
+
+    Protocol getProtocol(ParallelProtocolOp op, const quantum::QubitIndexAnalysis &qubitIndices)
+    {
+        Protocol protocol{op};
+        for (Value qubit : op.getInQubits()) {
+            std::optional<int64_t> wire = getWire(qubit, qubitIndices);
+            if (!wire.has_value()) {
+                protocol.exclusive = true;
+                continue;
+            }
+            if (!llvm::is_contained(protocol.wires, wire.value())) {
+                protocol.wires.push_back(wire.value());
+            }
+        }
+        // The protocols of the gates-to-pulses lowering are entangling if they act on several ions.
+        if (auto entangling = op->getAttrOfType<BoolAttr>(EntanglingAttrName)) {
+            protocol.entangling = entangling.getValue();
+        }
+        else {
+            protocol.entangling = op.getInQubits().size() > 1;
+        }
+        protocol.duration = getDurationBound(op);
+        return protocol;
+    }
+
+    void scheduleSegment(ArrayRef<Operation *> segment, Operation *anchor,
+                         const quantum::QubitIndexAnalysis &qubitIndices)
+    {
+        SmallVector<Protocol> protocols;
+        DenseMap<Operation *, size_t> protocolIndices;
+        double duration = 0.0;
+        for (Operation *op : segment) {
+            if (auto protocolOp = dyn_cast<ParallelProtocolOp>(op)) {
+                protocolIndices[op] = protocols.size();
+                protocols.push_back(getProtocol(protocolOp, qubitIndices));
+                duration += protocols.back().duration.value_or(0.0);
+                numUnboundedProtocols += !protocols.back().duration.has_value();
+            }
+        }
+
+        numProtocolsIn += protocols.size();
+        durationIn += toStatistic(duration);
+
+        if (protocols.size() < 2) {
+            numProtocolsOut += protocols.size();
+            durationOut += toStatistic(duration);
+            return;
+        }
+
+        SegmentScheduler scheduler(segment, protocols, protocolIndices);
+        auto [layerOf, numLayers] = scheduler.assignLayers(Strategy == "alap");
+        auto [numProtocols, scheduledDuration] = scheduler.emit(layerOf, numLayers, anchor);
+
+        numProtocolsOut += numProtocols;
+        durationOut += toStatistic(scheduledDuration);
+    }
+
+    void scheduleBlock(Block &block, const quantum::QubitIndexAnalysis &qubitIndices)
+    {
+        // Operations with memory effects (and terminators) end a segment, and stay in place.
+        SmallVector<Operation *> segment;
+        for (Operation &op : llvm::make_early_inc_range(block)) {
+            bool movable = isa<ParallelProtocolOp>(op) ||
+                           (!op.hasTrait<OpTrait::IsTerminator>() && isMemoryEffectFree(&op));
+            if (movable) {
+                segment.push_back(&op);
+                continue;
+            }
+            if (!segment.empty()) {
+                scheduleSegment(segment, &op, qubitIndices);
+                segment.clear();
+            }
+        }
+    }
+
+    void runOnOperation() final
+    {
+        if (Strategy != "asap" && Strategy != "alap") {
+            getOperation()->emitError() << "Unknown pulse scheduling strategy: " << Strategy;
+            return signalPassFailure();
+        }
+
+        const auto &qubitIndices = getAnalysis<quantum::QubitIndexAnalysis>();
+
+        // The bodies of the protocols are not scheduled, and may be erased by merging.
+        SmallVector<Block *> blocks;
+        getOperation()->walk([&](Block *block) {
+            if (!isa_and_nonnull<ParallelProtocolOp>(block->getParentOp())) {
+                blocks.push_back(block);
+            }
+        });
+        for (Block *block : blocks) {
+            scheduleBlock(*block, qubitIndices);
+        }
+    }
+};
+
+} // namespace ion
+
+std::unique_ptr<Pass> createSchedulePulsesPass()
+{
+    return std::make_unique<ion::SchedulePulsesPass>();
+}
+
+} // namespace catalyst
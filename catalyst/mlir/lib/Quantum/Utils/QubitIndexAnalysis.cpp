@@ -0,0 +1,202 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "llvm/ADT/STLExtras.h"
+
+#include "mlir/Dialect/Utils/StaticValueUtils.h"
+
+#include "Quantum/IR/QuantumInterfaces.h"
+#include "Quantum/IR/QuantumOps.h"
+#include "Quantum/Utils/QubitIndexAnalysis.h"
+
+using namespace mlir;
+
+namespace catalyst {
+namespace quantum {
+
+QubitIndexAnalysis::QubitIndexAnalysis(Operation *target)
+{
+    for (Region &region : target->getRegions()) {
+        visitRegion(region);
+    }
+}
+
+std::optional<int64_t> QubitIndexAnalysis::getQubitIndex(Value qubit) const
+{
+    auto it = indices.find(qubit);
+    if (it == indices.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void QubitIndexAnalysis::visitRegion(Region &region)
+{
+    // Blocks are visited in their order in the region, which is a forward order for the
+    // structured control flow. Values flowing through unstructured block arguments are unknown.
+    for (Block &block : region) {
+        for (Operation &op : block) {
+            visitOperation(&op);
+        }
+    }
+}
+
+void QubitIndexAnalysis::visitOperation(Operation *op)
+{
+    if (auto extractOp = dyn_cast<ExtractOp>(op)) {
+        std::optional<int64_t> index;
+        if (extractOp.getIdxAttr().has_value()) {
+            index = extractOp.getIdxAttr().value();
+        }
+        else if (Value idx = extractOp.getIdx()) {
+            index = getConstantIntValue(idx);
+        }
+        if (index.has_value()) {
+            indices[extractOp.getQubit()] = index.value();
+        }
+        return;
+    }
+
+    if (auto measureOp = dyn_cast<MeasureOp>(op)) {
+        propagate(measureOp.getInQubit(), measureOp.getOutQubit());
+        return;
+    }
+
+    if (auto forOp = dyn_cast<scf::ForOp>(op)) {
+        visitForOp(forOp);
+        return;
+    }
+
+    if (auto ifOp = dyn_cast<scf::IfOp>(op)) {
+        visitIfOp(ifOp);
+        return;
+    }
+
+    if (auto quantumOp = dyn_cast<QuantumOperation>(op)) {
+        std::vector<Value> operands = quantumOp.getQubitOperands();
+        std::vector<OpResult> results = quantumOp.getQubitResults();
+        if (operands.size() == results.size()) {
+            for (auto [operand, result] : llvm::zip(operands, results)) {
+                propagate(operand, result);
+            }
+        }
+    }
+    else if (isQubitMap(op)) {
+        // Operations of other dialects that map qubits to qubits positionally, e.g. the parallel
+        // protocols of the ion dialect. The arguments of their regions are the same qubits.
+        for (auto [operand, result] : llvm::zip(op->getOperands(), op->getResults())) {
+            propagate(operand, result);
+        }
+        for (Region &region : op->getRegions()) {
+            if (!region.empty() && region.getNumArguments() == op->getNumOperands()) {
+                for (auto [operand, arg] : llvm::zip(op->getOperands(), region.getArguments())) {
+                    propagate(operand, arg);
+                }
+            }
+        }
+    }
+
+    // The nested regions of other operations are analyzed, but the values flowing out of them
+    // are unknown.
+    for (Region &region : op->getRegions()) {
+        visitRegion(region);
+    }
+}
+
+void QubitIndexAnalysis::visitForOp(scf::ForOp forOp)
+{
+    // Assume that the loop-carried qubits keep their wires, and check it on the yielded values.
+    for (auto [init, iterArg] : llvm::zip(forOp.getInitArgs(), forOp.getRegionIterArgs())) {
+        propagate(init, iterArg);
+    }
+    visitRegion(forOp.getRegion());
+
+    auto yieldOp = cast<scf::YieldOp>(forOp.getBody()->getTerminator());
+    bool consistent = true;
+    for (auto [iterArg, yielded] : llvm::zip(forOp.getRegionIterArgs(), yieldOp.getResults())) {
+        if (getQubitIndex(iterArg) != getQubitIndex(yielded)) {
+            consistent = false;
+            break;
+        }
+    }
+
+    if (!consistent) {
+        forget(forOp.getRegion());
+        return;
+    }
+
+    for (auto [init, result] : llvm::zip(forOp.getInitArgs(), forOp.getResults())) {
+        propagate(init, result);
+    }
+}
+
+void QubitIndexAnalysis::visitIfOp(scf::IfOp ifOp)
+{
+    visitRegion(ifOp.getThenRegion());
+    visitRegion(ifOp.getElseRegion());
+
+    if (ifOp.getElseRegion().empty()) {
+        return;
+    }
+
+    // A result has a static wire only if both branches agree on it.
+    ValueRange thenResults = ifOp.thenYield().getResults();
+    ValueRange elseResults = ifOp.elseYield().getResults();
+    for (auto [result, thenValue, elseValue] :
+         llvm::zip(ifOp.getResults(), thenResults, elseResults)) {
+        std::optional<int64_t> index = getQubitIndex(thenValue);
+        if (index.has_value() && index == getQubitIndex(elseValue)) {
+            indices[result] = index.value();
+        }
+    }
+}
+
+bool QubitIndexAnalysis::isQubitMap(Operation *op)
+{
+    auto isQubit = [](Type type) { return isa<QubitType>(type); };
+    return op->getNumOperands() > 0 && op->getNumOperands() == op->getNumResults() &&
+           llvm::all_of(op->getOperandTypes(), isQubit) &&
+           llvm::all_of(op->getResultTypes(), isQubit);
+}
+
+void QubitIndexAnalysis::propagate(Value from, Value to)
+{
+    if (std::optional<int64_t> index = getQubitIndex(from)) {
+        indices[to] = index.value();
+    }
+}
+
+void QubitIndexAnalysis::forget(Region &region)
+{
+    region.walk([&](Operation *op) {
+        for (Value result : op->getResults()) {
+            indices.erase(result);
+        }
+        for (Region &nested : op->getRegions()) {
+            for (Block &block : nested) {
+                for (Value arg : block.getArguments()) {
+                    indices.erase(arg);
+                }
+            }
+        }
+    });
+    for (Block &block : region) {
+        for (Value arg : block.getArguments()) {
+            indices.erase(arg);
+        }
+    }
+}
+
+} // namespace quantum
+} // namespace catalyst
@@ -523,3 +523,72 @@ func.func @example_ion_three_qubit(%arg0: f64) -> (!quantum.bit, !quantum.bit, !
     %7:2 = quantum.custom "MS"(%arg0) %5#1, %6#1 : !quantum.bit, !quantum.bit
     return %6#0, %7#0, %7#1: !quantum.bit, !quantum.bit, !quantum.bit
 }
+
+// -----
+
+
+// CHECK-LABEL: example_ion_control_flow
+func.func @example_ion_control_flow(%arg0: f64, %arg1: i1) -> (!quantum.bit, !quantum.bit) attributes {qnode} {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c5 = arith.constant 5 : index
+    %idx = arith.constant 1 : i64
+
+    %1 = quantum.alloc( 2) : !quantum.reg
+    %2 = quantum.extract %1[ 0] : !quantum.reg -> !quantum.bit
+    %3 = quantum.extract %1[%idx] : !quantum.reg -> !quantum.bit
+
+    // The wires of loop-carried qubits are known inside and after the loop
+    // CHECK: scf.for
+    // CHECK: ion.parallelprotocol
+    // CHECK: ion.pulse
+    // CHECK-SAME: rabi = 4.400000e+00
+    // CHECK: ion.yield
+    // CHECK: scf.yield
+    %4:2 = scf.for %i = %c0 to %c5 step %c1 iter_args(%q0 = %2, %q1 = %3) -> (!quantum.bit, !quantum.bit) {
+        %5 = quantum.custom "RX"(%arg0) %q1 : !quantum.bit
+        scf.yield %q0, %5 : !quantum.bit, !quantum.bit
+    }
+
+    // CHECK: ion.parallelprotocol
+    // CHECK: ion.pulse
+    // CHECK-SAME: rabi = 4.400000e+00
+    %6 = quantum.custom "RY"(%arg0) %4#1 : !quantum.bit
+
+    // The wires of the results of an scf.if are known when both branches agree
+    // CHECK: scf.if
+    %7 = scf.if %arg1 -> (!quantum.bit) {
+        %8 = quantum.custom "RX"(%arg0) %4#0 : !quantum.bit
+        scf.yield %8 : !quantum.bit
+    } else {
+        scf.yield %4#0 : !quantum.bit
+    }
+
+    // CHECK: ion.parallelprotocol
+    // CHECK: ion.pulse
+    // CHECK-SAME: rabi = 1.100000e+00
+    %9 = quantum.custom "RX"(%arg0) %7 : !quantum.bit
+    return %9, %6 : !quantum.bit, !quantum.bit
+}
+
+// -----
+
+
+func.func @example_ion_loop_permutes_qubits(%arg0: f64) -> !quantum.bit attributes {qnode} {
+    %c0 = arith.constant 0 : index
+    %c1 = arith.constant 1 : index
+    %c5 = arith.constant 5 : index
+
+    %1 = quantum.alloc( 2) : !quantum.reg
+    %2 = quantum.extract %1[ 0] : !quantum.reg -> !quantum.bit
+    %3 = quantum.extract %1[ 1] : !quantum.reg -> !quantum.bit
+
+    // The loop exchanges the qubits, so their wires depend on the iteration
+    %4:2 = scf.for %i = %c0 to %c5 step %c1 iter_args(%q0 = %2, %q1 = %3) -> (!quantum.bit, !quantum.bit) {
+        // expected-error@+2 {{Impossible to determine the original qubit because of dynamism.}}
+        // expected-error@+1 {{failed to legalize operation 'quantum.custom'}}
+        %5 = quantum.custom "RX"(%arg0) %q0 : !quantum.bit
+        scf.yield %q1, %5 : !quantum.bit, !quantum.bit
+    }
+    return %4#0 : !quantum.bit
+}
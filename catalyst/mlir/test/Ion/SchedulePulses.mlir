@@ -0,0 +1,295 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(func.func(schedule-pulses))" \
+// RUN: --split-input-file -verify-diagnostics | FileCheck %s
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(func.func(schedule-pulses{strategy=alap}))" \
+// RUN: --split-input-file -verify-diagnostics | FileCheck %s --check-prefix=ALAP
+// RUN: quantum-opt %s --pass-pipeline="builtin.module(func.func(schedule-pulses))" \
+// RUN: --mlir-pass-statistics -verify-diagnostics -o /dev/null 2>&1 | FileCheck %s --check-prefix=STATS
+
+// The statistics of all the functions below, with the durations in 1/1000 time units. The
+// durations that depend on the arguments of the functions are unbounded, except in
+// @bounded_durations.
+
+// STATS: SchedulePulsesPass
+// STATS-DAG: (S) {{ *}}12000 duration-in
+// STATS-DAG: (S) {{ *}}8000 duration-out
+// STATS-DAG: (S) {{ *}}15 num-protocols-in
+// STATS-DAG: (S) {{ *}}11 num-protocols-out
+// STATS-DAG: (S) {{ *}}6 num-unbounded-protocols
+
+// CHECK-LABEL: pack_disjoint_ions
+// ALAP-LABEL: pack_disjoint_ions
+func.func @pack_disjoint_ions() -> (!quantum.bit, !quantum.bit, !quantum.bit) {
+    %t1 = arith.constant 1.0 : f64
+    %t2 = arith.constant 2.0 : f64
+    %r = quantum.alloc( 3) : !quantum.reg
+    %q0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r[ 1] : !quantum.reg -> !quantum.bit
+    %q2 = quantum.extract %r[ 2] : !quantum.reg -> !quantum.bit
+
+    // The single-qubit protocols on ions 0 and 1 run together, and the second protocol on ion 0
+    // runs together with the one on ion 2.
+
+    // CHECK: [[pp0:%.+]]:2 = ion.parallelprotocol(%{{.+}}, %{{.+}}) {ion.entangling = false} : !quantum.bit, !quantum.bit {
+    // CHECK-NEXT: ^{{.*}}([[a0:%.+]]: !quantum.bit, [[a1:%.+]]: !quantum.bit):
+    // CHECK-NEXT:   ion.pulse({{.+}}) [[a0]] {{.+}}transition_index = 0
+    // CHECK-NEXT:   ion.pulse({{.+}}) [[a1]] {{.+}}transition_index = 1
+    // CHECK-NEXT:   ion.yield [[a0]], [[a1]]
+    // CHECK: [[pp1:%.+]]:2 = ion.parallelprotocol([[pp0]]#0, %{{.+}}) {ion.entangling = false} : !quantum.bit, !quantum.bit {
+    // CHECK:        transition_index = 2
+    // CHECK:        transition_index = 3
+    // CHECK-NOT: ion.parallelprotocol
+    // CHECK: return [[pp1]]#0, [[pp0]]#1, [[pp1]]#1
+
+    // As late as possible, the protocol on ion 1 also joins the last layer.
+
+    // ALAP: [[pp0:%.+]] = ion.parallelprotocol(%{{.+}}) : !quantum.bit {
+    // ALAP:        transition_index = 0
+    // ALAP: [[pp1:%.+]]:3 = ion.parallelprotocol(%{{.+}}, [[pp0]], %{{.+}}) {ion.entangling = false} : !quantum.bit, !quantum.bit, !quantum.bit {
+    // ALAP:        transition_index = 1
+    // ALAP:        transition_index = 2
+    // ALAP:        transition_index = 3
+    // ALAP-NOT: ion.parallelprotocol
+    // ALAP: return [[pp1]]#1, [[pp1]]#0, [[pp1]]#2
+    %0 = ion.parallelprotocol(%q0) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p = ion.pulse(%t1 : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+    %1 = ion.parallelprotocol(%q1) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p = ion.pulse(%t1 : f64) %arg0 {
+                beam = #ion.beam<transition_index = 1, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+    %2 = ion.parallelprotocol(%0) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p = ion.pulse(%t2 : f64) %arg0 {
+                beam = #ion.beam<transition_index = 2, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+    %3 = ion.parallelprotocol(%q2) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p = ion.pulse(%t2 : f64) %arg0 {
+                beam = #ion.beam<transition_index = 3, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+    return %2, %1, %3 : !quantum.bit, !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CHECK-LABEL: shared_phonon_modes
+func.func @shared_phonon_modes(%t: f64) -> (!quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit) {
+    %r = quantum.alloc( 4) : !quantum.reg
+    %q0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r[ 1] : !quantum.reg -> !quantum.bit
+    %q2 = quantum.extract %r[ 2] : !quantum.reg -> !quantum.bit
+    %q3 = quantum.extract %r[ 3] : !quantum.reg -> !quantum.bit
+
+    // Entangling protocols on disjoint ions still use the same phonon modes
+    // CHECK: ion.parallelprotocol(%{{.+}}, %{{.+}}) : !quantum.bit, !quantum.bit {
+    // CHECK: ion.parallelprotocol(%{{.+}}, %{{.+}}) : !quantum.bit, !quantum.bit {
+    %0:2 = ion.parallelprotocol(%q0, %q1) : !quantum.bit, !quantum.bit {
+        ^bb0(%arg0: !quantum.bit, %arg1: !quantum.bit):
+            %p0 = ion.pulse(%t : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            %p1 = ion.pulse(%t : f64) %arg1 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0, %arg1 : !quantum.bit, !quantum.bit
+    }
+    %1:2 = ion.parallelprotocol(%q2, %q3) : !quantum.bit, !quantum.bit {
+        ^bb0(%arg0: !quantum.bit, %arg1: !quantum.bit):
+            %p0 = ion.pulse(%t : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            %p1 = ion.pulse(%t : f64) %arg1 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0, %arg1 : !quantum.bit, !quantum.bit
+    }
+    return %0#0, %0#1, %1#0, %1#1 : !quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CHECK-LABEL: barriers_and_unknown_ions
+func.func @barriers_and_unknown_ions(%t: f64, %i: i64) -> (!quantum.bit, !quantum.bit, !quantum.bit) {
+    %r = quantum.alloc( 3) : !quantum.reg
+    %q0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r[%i] : !quantum.reg -> !quantum.bit
+
+    // The ion of %q1 is unknown, so its protocol is not packed
+    // CHECK: ion.parallelprotocol(%{{.+}}) : !quantum.bit {
+    // CHECK: ion.parallelprotocol(%{{.+}}) : !quantum.bit {
+    %0 = ion.parallelprotocol(%q0) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p = ion.pulse(%t : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+    %1 = ion.parallelprotocol(%q1) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p = ion.pulse(%t : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+
+    // Protocols are not moved across operations with side effects
+    // CHECK: quantum.measure
+    // CHECK: ion.parallelprotocol(%{{.+}}) : !quantum.bit {
+    %m, %2 = quantum.measure %0 : i1, !quantum.bit
+    %q2 = quantum.extract %r[ 2] : !quantum.reg -> !quantum.bit
+    %3 = ion.parallelprotocol(%q2) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p = ion.pulse(%t : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+    return %2, %1, %3 : !quantum.bit, !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CHECK-LABEL: rescheduled_protocols
+func.func @rescheduled_protocols() -> (!quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit) {
+    %t = arith.constant 1.0 : f64
+    %r = quantum.alloc( 6) : !quantum.reg
+    %q0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r[ 1] : !quantum.reg -> !quantum.bit
+    %q2 = quantum.extract %r[ 2] : !quantum.reg -> !quantum.bit
+    %q3 = quantum.extract %r[ 3] : !quantum.reg -> !quantum.bit
+    %q4 = quantum.extract %r[ 4] : !quantum.reg -> !quantum.bit
+    %q5 = quantum.extract %r[ 5] : !quantum.reg -> !quantum.bit
+
+    // Protocols merged by an earlier run keep their classification: single-qubit protocols merged
+    // together may join an entangling protocol, while merged entangling protocols may not.
+    // CHECK: ion.parallelprotocol(%{{.+}}, %{{.+}}, %{{.+}}, %{{.+}}) {ion.entangling = true} : !quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit {
+    // CHECK: ion.parallelprotocol(%{{.+}}, %{{.+}}) {ion.entangling = true} : !quantum.bit, !quantum.bit {
+    // CHECK-NOT: ion.parallelprotocol
+    %0:2 = ion.parallelprotocol(%q0, %q1) {ion.entangling = false} : !quantum.bit, !quantum.bit {
+        ^bb0(%arg0: !quantum.bit, %arg1: !quantum.bit):
+            %p0 = ion.pulse(%t : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            %p1 = ion.pulse(%t : f64) %arg1 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0, %arg1 : !quantum.bit, !quantum.bit
+    }
+    %1:2 = ion.parallelprotocol(%q2, %q3) : !quantum.bit, !quantum.bit {
+        ^bb0(%arg0: !quantum.bit, %arg1: !quantum.bit):
+            %p0 = ion.pulse(%t : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            %p1 = ion.pulse(%t : f64) %arg1 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0, %arg1 : !quantum.bit, !quantum.bit
+    }
+    %2:2 = ion.parallelprotocol(%q4, %q5) {ion.entangling = true} : !quantum.bit, !quantum.bit {
+        ^bb0(%arg0: !quantum.bit, %arg1: !quantum.bit):
+            %p0 = ion.pulse(%t : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            %p1 = ion.pulse(%t : f64) %arg1 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0, %arg1 : !quantum.bit, !quantum.bit
+    }
+    return %0#0, %0#1, %1#0, %1#1, %2#0, %2#1 : !quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit, !quantum.bit
+}
+
+// -----
+
+// CHECK-LABEL: bounded_durations
+func.func @bounded_durations(%angle: f64) -> (!quantum.bit, !quantum.bit) {
+    // The normalized angle of the gates-to-pulses lowering is within [-2, 4] for a divisor of 2,
+    // which bounds the first pulse by 2. The second pulse is unbounded, and counts as zero.
+    %c0 = arith.constant 0.0 : f64
+    %c2 = arith.constant 2.0 : f64
+    %half = arith.constant 0.5 : f64
+    %rem = arith.remf %angle, %c2 : f64
+    %negative = arith.cmpf olt, %rem, %c0 : f64
+    %normalized = scf.if %negative -> (f64) {
+        %shifted = arith.addf %rem, %c2 : f64
+        scf.yield %shifted : f64
+    } else {
+        scf.yield %rem : f64
+    }
+    %t0 = arith.mulf %normalized, %half : f64
+    %t2 = arith.addf %half, %half : f64
+
+    %r = quantum.alloc( 2) : !quantum.reg
+    %q0 = quantum.extract %r[ 0] : !quantum.reg -> !quantum.bit
+    %q1 = quantum.extract %r[ 1] : !quantum.reg -> !quantum.bit
+
+    // CHECK: ion.parallelprotocol(%{{.+}}, %{{.+}}) {ion.entangling = false} : !quantum.bit, !quantum.bit {
+    // CHECK: ion.parallelprotocol(%{{.+}}) : !quantum.bit {
+    // CHECK-NOT: ion.parallelprotocol
+    %0 = ion.parallelprotocol(%q0) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p0 = ion.pulse(%t0 : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+    %1 = ion.parallelprotocol(%q1) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p0 = ion.pulse(%angle : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+    %2 = ion.parallelprotocol(%0) : !quantum.bit {
+        ^bb0(%arg0: !quantum.bit):
+            %p0 = ion.pulse(%t2 : f64) %arg0 {
+                beam = #ion.beam<transition_index = 0, rabi = 1.0, detuning = 2.0,
+                                 polarization = [0, 1, 2], wavevector = [-2, 3, 4]>,
+                phase = 0.0} : !ion.pulse
+            ion.yield %arg0 : !quantum.bit
+    }
+    return %2, %1 : !quantum.bit, !quantum.bit
+}
@@ -0,0 +1,32 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: catalyst %s -o %t/out.ll --workspace=%t --cache-dir=%t/cache --verbose | FileCheck %s --check-prefix=CHECK-MISS
+// RUN: rm %t/catalyst_module.o
+// RUN: catalyst %s -o %t/out.ll --workspace=%t --cache-dir=%t/cache --verbose | FileCheck %s --check-prefix=CHECK-HIT
+// RUN: test -f %t/catalyst_module.o
+// RUN: catalyst %s -o %t/out.ll --workspace=%t --cache-dir=%t/cache --verbose -O2 | FileCheck %s --check-prefix=CHECK-MISS
+
+// Options that don't change the object file share the entries of the cache
+// RUN: rm -rf %t/cache
+// RUN: catalyst %s -o %t/out.ll --workspace=%t --cache-dir=%t/cache
+// RUN: catalyst %s -o %t/out.ll --workspace=%t --cache-dir=%t/cache --verbose --mlir-timing --num-threads 2 | FileCheck %s --check-prefix=CHECK-HIT
+
+func.func @foo() {
+    return
+}
+
+// CHECK-MISS: Compilation cache miss
+// CHECK-HIT: Compilation cache hit
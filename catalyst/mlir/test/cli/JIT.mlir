@@ -0,0 +1,34 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The exit code of catalyst is the result of the function called in the JIT.
+
+// RUN: catalyst %s --jit --jit-run=zero
+// RUN: catalyst %s --jit-lazy --jit-run=zero
+// RUN: not catalyst %s --jit --jit-run=one
+// RUN: not catalyst %s --jit --jit-run=missing 2>&1 | FileCheck %s --check-prefix=CHECK-MISSING
+// RUN: not catalyst %s --jit-run=zero 2>&1 | FileCheck %s --check-prefix=CHECK-NO-JIT
+
+func.func @zero() -> i32 {
+    %0 = arith.constant 0 : i32
+    return %0 : i32
+}
+
+func.func @one() -> i32 {
+    %0 = arith.constant 1 : i32
+    return %0 : i32
+}
+
+// CHECK-MISSING: Error: {{.*}}missing
+// CHECK-NO-JIT: --jit-run requires the LLVM stage to run with --jit
@@ -0,0 +1,50 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The LLVMOpt stage only runs above -O0
+// RUN: catalyst %s -o %t.ll --mlir-timing --verify-diagnostics 2>&1 | FileCheck %s --check-prefix=CHECK-O0
+// RUN: catalyst %s -o %t.ll -O1 --mlir-timing --verify-diagnostics 2>&1 | FileCheck %s --check-prefix=CHECK-OPT
+// RUN: catalyst %s -o %t.ll -O2 --mlir-timing --verify-diagnostics 2>&1 | FileCheck %s --check-prefix=CHECK-OPT
+// RUN: catalyst %s -o %t.ll -O3 --mlir-timing --verify-diagnostics 2>&1 | FileCheck %s --check-prefix=CHECK-OPT
+
+// The target CPU of the host, under both spellings of the option
+// RUN: catalyst %s -o %t.ll -O3 --mcpu=native --mlir-timing --verify-diagnostics 2>&1 | FileCheck %s --check-prefix=CHECK-OPT
+// RUN: catalyst %s -o %t.ll -O2 --march=native --mlir-timing --verify-diagnostics 2>&1 | FileCheck %s --check-prefix=CHECK-OPT
+
+// The optimized module is dumped by the LLVMOpt stage
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: catalyst %s -o %t/out.ll -O2 --keep-intermediate --workspace=%t --verify-diagnostics
+// RUN: ls %t | FileCheck %s --check-prefix=CHECK-DUMPS
+// RUN: cat %t/*_LLVMOpt.ll | FileCheck %s --check-prefix=CHECK-LLVMOPT
+
+// RUN: not catalyst %s -o %t.ll -O4 2>&1 | FileCheck %s --check-prefix=CHECK-INVALID
+
+func.func @foo(%arg0: i64) -> i64 {
+    %0 = arith.addi %arg0, %arg0 : i64
+    return %0 : i64
+}
+
+// CHECK-O0: Execution time report
+// CHECK-O0: llc
+// CHECK-O0-NOT: LLVM optimization passes
+
+// CHECK-OPT: Execution time report
+// CHECK-OPT: llc
+// CHECK-OPT: LLVM optimization passes
+
+// CHECK-DUMPS: LLVMOpt.ll
+
+// CHECK-LLVMOPT: define {{.*}}@foo
+
+// CHECK-INVALID: Error: Invalid optimization level: -O4
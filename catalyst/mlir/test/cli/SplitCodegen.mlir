@@ -0,0 +1,59 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: catalyst %s -o %t/out.ll --workspace=%t --codegen-threads=3 --mlir-timing 2>&1 | FileCheck %s
+// RUN: test -f %t/catalyst_module.o
+// RUN: test -f %t/catalyst_module.1.o
+// RUN: test -f %t/catalyst_module.2.o
+
+// The partitions link together, with the calls across partitions resolved
+// RUN: ld -r %t/catalyst_module.o %t/catalyst_module.1.o %t/catalyst_module.2.o -o %t/linked.o
+// RUN: llvm-nm --defined-only %t/linked.o | FileCheck %s --check-prefix=CHECK-DEFINED
+// RUN: llvm-nm --undefined-only %t/linked.o | FileCheck %s --check-prefix=CHECK-UNDEFINED --allow-empty
+
+// Compiling again into fewer partitions removes the stale ones from the workspace
+// RUN: catalyst %s -o %t/out.ll --workspace=%t --codegen-threads=2
+// RUN: test -f %t/catalyst_module.1.o
+// RUN: not test -e %t/catalyst_module.2.o
+// RUN: catalyst %s -o %t/out.ll --workspace=%t
+// RUN: test -f %t/catalyst_module.o
+// RUN: not test -e %t/catalyst_module.1.o
+
+func.func @foo() -> i64 {
+    %0 = func.call @bar() : () -> i64
+    %1 = func.call @baz() : () -> i64
+    %2 = arith.addi %0, %1 : i64
+    return %2 : i64
+}
+
+func.func @bar() -> i64 {
+    %0 = arith.constant 1 : i64
+    return %0 : i64
+}
+
+func.func @baz() -> i64 {
+    %0 = arith.constant 2 : i64
+    return %0 : i64
+}
+
+// CHECK: compileObject
+// CHECK: splitModule
+
+// CHECK-DEFINED-DAG: T {{_?}}bar
+// CHECK-DEFINED-DAG: T {{_?}}baz
+// CHECK-DEFINED-DAG: T {{_?}}foo
+
+// CHECK-UNDEFINED-NOT: {{ _?}}bar{{$}}
+// CHECK-UNDEFINED-NOT: {{ _?}}baz{{$}}
@@ -0,0 +1,54 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe1(canonicalize;cse)" --num-threads=1 --verify-diagnostics 2>&1 | FileCheck %s
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe1(canonicalize;cse)" --verify-diagnostics 2>&1 | FileCheck %s
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe1(canonicalize;cse)" --num-threads=4 --verify-diagnostics 2>&1 | FileCheck %s
+
+// Printing the whole module falls back to a single thread
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe1(canonicalize;cse)" --mlir-print-ir-after-all --mlir-print-ir-module-scope --verify-diagnostics 2>&1 | FileCheck %s --check-prefix=CHECK-MODULE-SCOPE
+
+// The dumps after each pass are numbered in the same order on every run
+// RUN: rm -rf %t && mkdir -p %t/first %t/second
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe1(canonicalize;cse)" --keep-intermediate=pass --workspace=%t/first --verify-diagnostics
+// RUN: catalyst --tool=opt %s --catalyst-pipeline="pipe1(canonicalize;cse)" --keep-intermediate=pass --workspace=%t/second --verify-diagnostics
+// RUN: ls %t/first > %t/first.txt && ls %t/second > %t/second.txt && diff %t/first.txt %t/second.txt
+// RUN: cat %t/first.txt | FileCheck %s --check-prefix=CHECK-DUMPS
+
+func.func @foo(%arg0: i64) -> i64 {
+    %0 = arith.addi %arg0, %arg0 : i64
+    %1 = arith.addi %arg0, %arg0 : i64
+    %2 = arith.muli %0, %1 : i64
+    return %2 : i64
+}
+
+func.func @bar(%arg0: i64) -> i64 {
+    %c0 = arith.constant 0 : i64
+    %0 = arith.addi %arg0, %c0 : i64
+    return %0 : i64
+}
+
+// CHECK-LABEL: func.func @foo
+// CHECK: [[SUM:%.+]] = arith.addi %arg0, %arg0
+// CHECK-NEXT: arith.muli [[SUM]], [[SUM]]
+// CHECK-LABEL: func.func @bar
+// CHECK-NEXT: return %arg0
+
+// CHECK-MODULE-SCOPE: IR Dump After Canonicalizer
+// CHECK-MODULE-SCOPE: module
+// CHECK-MODULE-SCOPE: IR Dump After CSE
+// CHECK-MODULE-SCOPE: module
+
+// CHECK-DUMPS: Canonicalizer
+// CHECK-DUMPS: CSE
@@ -130,6 +130,24 @@ template <typename T, size_t R> class DataView {
         return tsize;
     }
 
+    /**
+     * Check whether the elements are stored contiguously in the row-major order of the
+     * iterator, in which case they can be accessed in bulk through `data()`.
+     */
+    [[nodiscard]] auto isContiguous() const -> bool
+    {
+        size_t stride = 1;
+        for (size_t i = R; i > 0; --i) {
+            if (sizes[i - 1] > 1 && strides[i - 1] != stride) {
+                return false;
+            }
+            stride *= sizes[i - 1];
+        }
+        return true;
+    }
+
+    [[nodiscard]] auto data() const -> T * { return data_aligned + offset; }
+
     template <typename... I> T &operator()(I... idxs) const
     {
         static_assert(sizeof...(idxs) == R,
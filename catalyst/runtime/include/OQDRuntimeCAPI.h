@@ -42,11 +42,27 @@ struct Pulse {
 };
 
 // OQD Runtime Instructions
-void __catalyst__oqd__rt__initialize();
-void __catalyst__oqd__rt__finalize(const std::string &openapl_file_name);
+void __catalyst__oqd__rt__initialize(const std::string &openapl_file_name);
+void __catalyst__oqd__rt__finalize();
 void __catalyst__oqd__ion(const std::string &ion_specs);
 void __catalyst__oqd__modes(const std::vector<std::string> &phonon_specs);
+
+/**
+ * Create a pulse on the ion of `qubit`. The beam is copied, so it only needs to live until this
+ * call returns.
+ *
+ * The returned pulse and its copy of the beam are owned by the runtime. They are only valid
+ * until the next call to `__catalyst__oqd__ParallelProtocol`, which recycles all the pulse
+ * records, whether the pulse is part of that protocol or not. A pulse must thus be created again
+ * for each protocol it is used in.
+ */
 Pulse *__catalyst__oqd__pulse(QUBIT *qubit, double duration, double phase, Beam *beam);
+
+/**
+ * Record a protocol of the `n` given pulses played in parallel, and invalidate all the pulses
+ * created by `__catalyst__oqd__pulse` so far. Passing such a pulse created before the previous
+ * protocol is an error. Pulses and beams owned by the caller are only read during this call.
+ */
 void __catalyst__oqd__ParallelProtocol(Pulse **pulses, size_t n);
 
 #ifdef __cplusplus
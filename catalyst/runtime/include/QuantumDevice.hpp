@@ -228,6 +228,31 @@ struct QuantumDevice {
      */
     virtual auto Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result = 0;
 
+    /**
+     * @brief (Optional) Perform a measurement on one qubit in an arbitrary basis.
+     *
+     * The basis is parameterized by a plane (0 for XY, 1 for YZ, and 2 for ZX) and a rotation
+     * angle about that plane, following the `mbqc.measure_in_basis` op of the MBQC dialect. The
+     * result is 0 (false) for the state |+_angle> of the basis, and 1 (true) for |-_angle>.
+     *
+     * Devices without a native support for these measurements fall back to a computational-basis
+     * `Measure` of the qubit.
+     *
+     * @param wire The qubit to measure.
+     * @param plane The plane of the measurement basis.
+     * @param angle The rotation angle of the measurement basis about the plane.
+     * @param postselect Optional parameter to force the result to the provided state (roughly
+     *                   equivalent to post-selection).
+     *
+     * @return `Result` The measurement result.
+     */
+    virtual auto MeasureInBasis(QubitIdType wire, [[maybe_unused]] uint32_t plane,
+                                [[maybe_unused]] double angle, std::optional<int32_t> postselect)
+        -> Result
+    {
+        return Measure(wire, postselect);
+    }
+
     /**
      * @brief (Optional) Apply an arbitrary unitary matrix to the device.
      *
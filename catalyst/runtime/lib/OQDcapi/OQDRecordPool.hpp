@@ -0,0 +1,114 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Catalyst::Runtime::OQD {
+
+/**
+ * A slab allocator for the plain records (`Pulse`, `Beam`) of the OQD runtime.
+ *
+ * Records are carved out of fixed-size slabs and never move, so the returned pointers can be
+ * handed over the C API. There is no per-record deallocation: `reset` recycles all records at
+ * once while keeping the slabs for reuse, and `release` returns the slabs to the system.
+ *
+ * @tparam T The trivial record type
+ * @tparam SlabSize The number of records per slab
+ */
+template <typename T, size_t SlabSize = 4096> class RecordPool {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "RecordPool only supports trivial records");
+    static_assert(SlabSize > 0, "Invalid slab size");
+
+  private:
+    std::vector<std::unique_ptr<T[]>> slabs{};
+
+    // The next free record is `slabs[slab][offset]`
+    size_t slab{0};
+    size_t offset{0};
+
+  public:
+    RecordPool() = default;
+    ~RecordPool() = default;
+
+    RecordPool(const RecordPool &) = delete;
+    RecordPool &operator=(const RecordPool &) = delete;
+    RecordPool(RecordPool &&) = default;
+    RecordPool &operator=(RecordPool &&) = default;
+
+    template <typename... Args> [[nodiscard]] auto allocate(Args &&...args) -> T *
+    {
+        if (offset == SlabSize) {
+            slab++;
+            offset = 0;
+        }
+        if (slab == slabs.size()) {
+            slabs.push_back(std::make_unique_for_overwrite<T[]>(SlabSize));
+        }
+        T *record = &slabs[slab][offset++];
+        *record = T{std::forward<Args>(args)...};
+        return record;
+    }
+
+    /**
+     * Recycle all records. The pointers returned before are invalidated.
+     */
+    void reset()
+    {
+        slab = 0;
+        offset = 0;
+    }
+
+    /**
+     * Recycle all records and free the slabs.
+     */
+    void release()
+    {
+        reset();
+        slabs.clear();
+    }
+
+    /**
+     * Check whether a pointer is a record of this pool that was recycled by a `reset`, and not
+     * allocated again since. Pointers that are not in the slabs of the pool are not recycled.
+     */
+    [[nodiscard]] auto isRecycled(const T *record) const -> bool
+    {
+        std::less_equal<const T *> le;
+        std::less<const T *> lt;
+        for (size_t s = 0; s < slabs.size(); s++) {
+            const T *begin = slabs[s].get();
+            if (le(begin, record) && lt(record, begin + SlabSize)) {
+                return s > slab || (s == slab && static_cast<size_t>(record - begin) >= offset);
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] auto getNumRecords() const -> size_t
+    {
+        return slabs.empty() ? 0 : slab * SlabSize + offset;
+    }
+
+    [[nodiscard]] auto getCapacity() const -> size_t { return slabs.size() * SlabSize; }
+};
+
+} // namespace Catalyst::Runtime::OQD
@@ -12,98 +12,319 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <charconv>
+#include <cmath>
+#include <cstdint>
 #include <fstream>
-#include <functional> // std::reference_wrapper
-#include <iostream>
-#include <unordered_map>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 
+#include "OQDRecordPool.hpp"
 #include "OQDRuntimeCAPI.h"
 
 using json = nlohmann::json;
 
-static std::unique_ptr<json> JSON = nullptr;
-static std::unique_ptr<std::vector<Pulse *>> PulseGarbageCan = nullptr;
+namespace {
 
-template <typename T> json &numerical_json_factory(T value)
-{
-    static json j;
-    j["class_"] = "MathNum";
-    j["value"] = value;
-    return j;
-}
+/**
+ * A SAX-style JSON writer that streams the OpenAPL program into the output file.
+ *
+ * Tokens are serialized into a small buffer, which is handed to the file stream with
+ * `flush()` once a complete protocol entry is written. The memory use is thus bounded by the
+ * largest protocol entry instead of the whole program.
+ */
+class OpenAPLWriter {
+  private:
+    std::ofstream out;
+    std::string buffer{};
+
+    // Whether the innermost object or array is still empty
+    std::vector<bool> empty_scopes{};
+    bool after_key{false};
+
+    void separate()
+    {
+        if (after_key) {
+            after_key = false;
+            return;
+        }
+        if (!empty_scopes.empty()) {
+            if (!empty_scopes.back()) {
+                buffer.push_back(',');
+            }
+            empty_scopes.back() = false;
+        }
+    }
+
+    void quote(std::string_view str)
+    {
+        buffer.push_back('"');
+        for (char c : str) {
+            if (c == '"' || c == '\\') {
+                buffer.push_back('\\');
+                buffer.push_back(c);
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                constexpr char hex[] = "0123456789abcdef";
+                buffer.append("\\u00");
+                buffer.push_back(hex[(c >> 4) & 0xf]);
+                buffer.push_back(hex[c & 0xf]);
+            }
+            else {
+                buffer.push_back(c);
+            }
+        }
+        buffer.push_back('"');
+    }
+
+  public:
+    explicit OpenAPLWriter(const std::string &file_name) : out(file_name)
+    {
+        RT_FAIL_IF(!out.is_open(), "Unable to open the OpenAPL output file");
+    }
+
+    void beginObject()
+    {
+        separate();
+        buffer.push_back('{');
+        empty_scopes.push_back(true);
+    }
+
+    void endObject()
+    {
+        buffer.push_back('}');
+        empty_scopes.pop_back();
+    }
+
+    void beginArray()
+    {
+        separate();
+        buffer.push_back('[');
+        empty_scopes.push_back(true);
+    }
+
+    void endArray()
+    {
+        buffer.push_back(']');
+        empty_scopes.pop_back();
+    }
+
+    void key(std::string_view name)
+    {
+        separate();
+        quote(name);
+        buffer.push_back(':');
+        after_key = true;
+    }
+
+    void string(std::string_view str)
+    {
+        separate();
+        quote(str);
+    }
+
+    void number(int64_t value)
+    {
+        separate();
+        char buf[24];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+        buffer.append(buf, end);
+    }
+
+    // Shortest round-trip representation, which keeps a fractional part as nlohmann does.
+    void number(double value)
+    {
+        separate();
+        if (!std::isfinite(value)) {
+            buffer.append("null");
+            return;
+        }
+        char buf[32];
+        auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+        std::string_view str(buf, end - buf);
+        buffer.append(str);
+        if (str.find_first_of(".e") == std::string_view::npos) {
+            buffer.append(".0");
+        }
+    }
+
+    // Append an already serialized JSON value
+    void raw(std::string_view serialized)
+    {
+        separate();
+        buffer.append(serialized);
+    }
+
+    void flush()
+    {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+};
+
+/**
+ * The state of the OpenAPL program being emitted.
+ *
+ * The protocol sequence is streamed as it is recorded, while the system (ions and modes) is kept
+ * in memory, serialized, and written after the protocol at finalization. The transitions of every
+ * ion are serialized once when the ion is added, so that each pulse only looks up its transition
+ * by index.
+ *
+ * The pulses of a parallel protocol are created right before it, and are consumed by it. Their
+ * records (and copies of their beams) are thus allocated from pools that are recycled after every
+ * protocol entry, and freed in bulk at finalization.
+ */
+struct OpenAPLProgram {
+    OpenAPLWriter writer;
+    std::vector<std::string> ions{};
+    std::vector<std::string> modes{};
+    std::vector<std::vector<std::string>> transition_tables{};
+
+    Catalyst::Runtime::OQD::RecordPool<Pulse> pulse_pool{};
+    Catalyst::Runtime::OQD::RecordPool<Beam> beam_pool{};
+
+    explicit OpenAPLProgram(const std::string &file_name) : writer(file_name) {}
+};
+
+std::unique_ptr<OpenAPLProgram> Program = nullptr;
 
-void to_json(json &j, const Pulse &p)
+auto getTransition(const Pulse &p) -> const std::string &
 {
-    RT_FAIL_IF(p.target >= (*JSON)["system"]["ions"].size(), "ion index out of range");
+    RT_FAIL_IF(p.target >= Program->transition_tables.size(), "ion index out of range");
 
-    const auto &transitions = (*JSON)["system"]["ions"][p.target]["transitions"];
+    const auto &transitions = Program->transition_tables[p.target];
     RT_FAIL_IF(p.beam->transition_index < 0 ||
                    static_cast<size_t>(p.beam->transition_index) >= transitions.size(),
                "transition index out of range");
 
-    j = json{{"class_", "Pulse"}, {"duration", p.duration}};
+    return transitions[p.beam->transition_index];
+}
 
-    json j_beam;
-    j_beam["class_"] = "Beam";
-    j_beam["target"] = p.target;
-    j_beam["polarization"] = p.beam->polarization;
-    j_beam["wavevector"] = p.beam->wavevector;
-    j_beam["rabi"] = numerical_json_factory<double>(p.beam->rabi);
-    j_beam["detuning"] = numerical_json_factory<double>(p.beam->detuning);
-    j_beam["phase"] = numerical_json_factory<double>(p.phase);
-    j_beam["transition"] = transitions[p.beam->transition_index];
+void writeMathNum(OpenAPLWriter &writer, double value)
+{
+    writer.beginObject();
+    writer.key("class_");
+    writer.string("MathNum");
+    writer.key("value");
+    writer.number(value);
+    writer.endObject();
+}
 
-    j["beam"] = j_beam;
+void writeVector(OpenAPLWriter &writer, const std::array<int64_t, 3> &vec)
+{
+    writer.beginArray();
+    for (int64_t v : vec) {
+        writer.number(v);
+    }
+    writer.endArray();
 }
 
-extern "C" {
+void writePulse(OpenAPLWriter &writer, const Pulse &p, const std::string &transition)
+{
+    writer.beginObject();
+    writer.key("beam");
+    writer.beginObject();
+    writer.key("class_");
+    writer.string("Beam");
+    writer.key("detuning");
+    writeMathNum(writer, p.beam->detuning);
+    writer.key("phase");
+    writeMathNum(writer, p.phase);
+    writer.key("polarization");
+    writeVector(writer, p.beam->polarization);
+    writer.key("rabi");
+    writeMathNum(writer, p.beam->rabi);
+    writer.key("target");
+    writer.number(static_cast<int64_t>(p.target));
+    writer.key("transition");
+    writer.raw(transition);
+    writer.key("wavevector");
+    writeVector(writer, p.beam->wavevector);
+    writer.endObject();
+    writer.key("class_");
+    writer.string("Pulse");
+    writer.key("duration");
+    writer.number(p.duration);
+    writer.endObject();
+}
 
-void __catalyst__oqd__rt__initialize()
+void writeArray(OpenAPLWriter &writer, const std::vector<std::string> &elements)
 {
-    PulseGarbageCan = std::make_unique<std::vector<Pulse *>>();
+    writer.beginArray();
+    for (const auto &element : elements) {
+        writer.raw(element);
+    }
+    writer.endArray();
+}
 
-    JSON = std::make_unique<json>();
-    (*JSON)["class_"] = "AtomicCircuit";
+} // namespace
 
-    json system = R"({
-  "class_": "System",
-  "ions": [],
-  "modes": []
-})"_json;
-    (*JSON)["system"] = system;
+extern "C" {
+
+void __catalyst__oqd__rt__initialize(const std::string &openapl_file_name)
+{
+    Program = std::make_unique<OpenAPLProgram>(openapl_file_name);
 
     // The main openapl program is a sequential protocol
     // Each gate is a parallel protocol in the main sequential protocol
-    json protocol = R"({
-  "class_": "SequentialProtocol",
-  "sequence": []
-})"_json;
-    (*JSON)["protocol"] = protocol;
+    // The keys are written in the sorted order of nlohmann::json objects
+    auto &writer = Program->writer;
+    writer.beginObject();
+    writer.key("class_");
+    writer.string("AtomicCircuit");
+    writer.key("protocol");
+    writer.beginObject();
+    writer.key("class_");
+    writer.string("SequentialProtocol");
+    writer.key("sequence");
+    writer.beginArray();
+    writer.flush();
 }
 
-void __catalyst__oqd__rt__finalize(const std::string &openapl_file_name)
+void __catalyst__oqd__rt__finalize()
 {
-    for (auto pulse : *PulseGarbageCan) {
-        delete pulse;
-    }
-
-    std::ofstream out_json(openapl_file_name);
-    out_json << JSON->dump(2);
-    JSON = nullptr;
+    auto &writer = Program->writer;
+    writer.endArray();
+    writer.endObject();
+    writer.key("system");
+    writer.beginObject();
+    writer.key("class_");
+    writer.string("System");
+    writer.key("ions");
+    writeArray(writer, Program->ions);
+    writer.key("modes");
+    writeArray(writer, Program->modes);
+    writer.endObject();
+    writer.endObject();
+    writer.flush();
+    Program = nullptr;
 }
 
 void __catalyst__oqd__ion(const std::string &ion_specs)
 {
-    (*JSON)["system"]["ions"].push_back(json::parse(ion_specs));
+    json ion = json::parse(ion_specs);
+
+    std::vector<std::string> transitions;
+    auto it = ion.find("transitions");
+    if (it != ion.end() && it->is_array()) {
+        transitions.reserve(it->size());
+        for (const auto &transition : *it) {
+            transitions.push_back(transition.dump());
+        }
+    }
+
+    Program->ions.push_back(ion.dump());
+    Program->transition_tables.push_back(std::move(transitions));
 }
 
 void __catalyst__oqd__modes(const std::vector<std::string> &phonon_specs)
 {
-    for (auto phonon_spec : phonon_specs) {
-        (*JSON)["system"]["modes"].push_back(json::parse(phonon_spec));
+    for (const auto &phonon_spec : phonon_specs) {
+        Program->modes.push_back(json::parse(phonon_spec).dump());
     }
 }
 
@@ -111,25 +332,36 @@ Pulse *__catalyst__oqd__pulse(QUBIT *qubit, double duration, double phase, Beam
 {
     size_t wire = reinterpret_cast<QubitIdType>(qubit);
 
-    // Since this is CAPI, we cannot return smart pointer.
-    // This means we have to new and delete manually.
-    Pulse *pulse = new Pulse({beam, wire, duration, phase});
-    PulseGarbageCan->push_back(pulse);
-    return pulse;
+    // The beam is copied, as the caller may only keep it alive until the call returns.
+    Beam *beam_record = Program->beam_pool.allocate(*beam);
+    return Program->pulse_pool.allocate(beam_record, wire, duration, phase);
 }
 
 void __catalyst__oqd__ParallelProtocol(Pulse **pulses, size_t num_of_pulses)
 {
-    json j;
-    j["class_"] = "ParallelProtocol";
+    // Resolve all transitions first, so that invalid pulses don't leave a partial entry.
+    std::vector<const std::string *> transitions(num_of_pulses);
+    for (size_t i = 0; i < num_of_pulses; i++) {
+        RT_FAIL_IF(Program->pulse_pool.isRecycled(pulses[i]),
+                   "Invalid pulse: pulses are only valid until the next parallel protocol");
+        transitions[i] = &getTransition(*pulses[i]);
+    }
 
-    std::vector<std::reference_wrapper<Pulse>> pulses_json;
-    for (std::size_t i = 0; i < num_of_pulses; i++) {
-        pulses_json.push_back(std::ref(*(pulses[i])));
+    auto &writer = Program->writer;
+    writer.beginObject();
+    writer.key("class_");
+    writer.string("ParallelProtocol");
+    writer.key("sequence");
+    writer.beginArray();
+    for (size_t i = 0; i < num_of_pulses; i++) {
+        writePulse(writer, *pulses[i], *transitions[i]);
     }
-    j["sequence"] = pulses_json;
+    writer.endArray();
+    writer.endObject();
+    writer.flush();
 
-    (*JSON)["protocol"]["sequence"].push_back(j);
+    Program->pulse_pool.reset();
+    Program->beam_pool.reset();
 }
 
 } // extern "C"
@@ -0,0 +1,232 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+
+/**
+ * The matrices of the named gates of the simulators of the runtime.
+ *
+ * All matrices are dense and in row-major order, where the first wire is the most significant
+ * one.
+ */
+namespace Catalyst::Runtime::Devices::GateMatrices {
+
+using ComplexT = std::complex<double>;
+using MatrixT = std::vector<ComplexT>;
+
+/**
+ * The matrix of a rotation about the X, Y, or Z axis.
+ */
+inline auto getRotationMatrix(char axis, double angle) -> MatrixT
+{
+    const double c = std::cos(angle / 2);
+    const double s = std::sin(angle / 2);
+
+    switch (axis) {
+    case 'X':
+        return {ComplexT{c, 0}, ComplexT{0, -s}, ComplexT{0, -s}, ComplexT{c, 0}};
+    case 'Y':
+        return {ComplexT{c, 0}, ComplexT{-s, 0}, ComplexT{s, 0}, ComplexT{c, 0}};
+    default:
+        return {ComplexT{c, -s}, 0, 0, ComplexT{c, s}};
+    }
+}
+
+/**
+ * The matrix exp(-i angle/2 P P) of an Ising coupling along the X, Y, or Z axis.
+ */
+inline auto getIsingMatrix(char axis, double angle) -> MatrixT
+{
+    const ComplexT c{std::cos(angle / 2), 0};
+    const ComplexT is{0, std::sin(angle / 2)};
+
+    switch (axis) {
+    case 'X':
+        return {c, 0, 0, -is, 0, c, -is, 0, 0, -is, c, 0, -is, 0, 0, c};
+    case 'Y':
+        return {c, 0, 0, is, 0, c, -is, 0, 0, -is, c, 0, is, 0, 0, c};
+    default:
+        return {c - is, 0, 0, 0, 0, c + is, 0, 0, 0, 0, c + is, 0, 0, 0, 0, c - is};
+    }
+}
+
+/**
+ * The matrix of a gate on `num_wires` wires, controlled by the wires preceding them. The gate
+ * applies when the control wires are in the basis state `controlled_values`.
+ */
+inline auto getControlledMatrix(const MatrixT &matrix, size_t num_wires = 1,
+                                const std::vector<bool> &controlled_values = {true}) -> MatrixT
+{
+    const size_t dim = 1UL << num_wires;
+    const size_t full_dim = dim << controlled_values.size();
+
+    size_t active = 0;
+    for (bool value : controlled_values) {
+        active = (active << 1) | static_cast<size_t>(value);
+    }
+    active *= dim;
+
+    MatrixT controlled(full_dim * full_dim, ComplexT{0});
+    for (size_t index = 0; index < full_dim; index++) {
+        if (index < active || index >= active + dim) {
+            controlled[index * full_dim + index] = 1.0;
+        }
+    }
+    for (size_t row = 0; row < dim; row++) {
+        for (size_t col = 0; col < dim; col++) {
+            controlled[(active + row) * full_dim + active + col] = matrix[row * dim + col];
+        }
+    }
+    return controlled;
+}
+
+/**
+ * The conjugate transpose of a square matrix.
+ */
+inline auto getAdjointMatrix(const MatrixT &matrix) -> MatrixT
+{
+    const auto dim = static_cast<size_t>(std::lround(std::sqrt(matrix.size())));
+    MatrixT adjoint(matrix.size());
+    for (size_t row = 0; row < dim; row++) {
+        for (size_t col = 0; col < dim; col++) {
+            adjoint[col * dim + row] = std::conj(matrix[row * dim + col]);
+        }
+    }
+    return adjoint;
+}
+
+/**
+ * The matrix of a named gate, and its number of wires.
+ */
+inline auto getGateMatrix(const std::string &name, const std::vector<double> &params)
+    -> std::pair<MatrixT, size_t>
+{
+    const ComplexT one{1.0, 0.0};
+    const ComplexT i{0.0, 1.0};
+    const ComplexT h{1.0 / std::numbers::sqrt2, 0.0};
+
+    const MatrixT pauli_x{0, one, one, 0};
+    const MatrixT pauli_y{0, -i, i, 0};
+    const MatrixT pauli_z{one, 0, 0, -one};
+
+    auto param = [&params](size_t expected) {
+        RT_FAIL_IF(params.size() != expected, "Invalid number of parameters");
+        return params[0];
+    };
+    auto phase = [](double angle) { return std::exp(ComplexT{0, angle}); };
+
+    if (name == "Identity") {
+        return {{one, 0, 0, one}, 1};
+    }
+    if (name == "PauliX") {
+        return {pauli_x, 1};
+    }
+    if (name == "PauliY") {
+        return {pauli_y, 1};
+    }
+    if (name == "PauliZ") {
+        return {pauli_z, 1};
+    }
+    if (name == "Hadamard") {
+        return {{h, h, h, -h}, 1};
+    }
+    if (name == "S") {
+        return {{one, 0, 0, i}, 1};
+    }
+    if (name == "T") {
+        return {{one, 0, 0, phase(std::numbers::pi / 4)}, 1};
+    }
+    if (name == "SX") {
+        return {{(one + i) / 2.0, (one - i) / 2.0, (one - i) / 2.0, (one + i) / 2.0}, 1};
+    }
+    if (name == "RX") {
+        return {getRotationMatrix('X', param(1)), 1};
+    }
+    if (name == "RY") {
+        return {getRotationMatrix('Y', param(1)), 1};
+    }
+    if (name == "RZ") {
+        return {getRotationMatrix('Z', param(1)), 1};
+    }
+    if (name == "PhaseShift") {
+        return {{one, 0, 0, phase(param(1))}, 1};
+    }
+    if (name == "Rot") {
+        // Rot(phi, theta, omega) = RZ(omega) RY(theta) RZ(phi)
+        RT_FAIL_IF(params.size() != 3, "Invalid number of parameters");
+        const double c = std::cos(params[1] / 2);
+        const double s = std::sin(params[1] / 2);
+        const double sum = (params[0] + params[2]) / 2;
+        const double diff = (params[0] - params[2]) / 2;
+        return {{phase(-sum) * c, -phase(diff) * s, phase(-diff) * s, phase(sum) * c}, 1};
+    }
+
+    if (name == "CNOT") {
+        return {getControlledMatrix(pauli_x), 2};
+    }
+    if (name == "CY") {
+        return {getControlledMatrix(pauli_y), 2};
+    }
+    if (name == "CZ") {
+        return {getControlledMatrix(pauli_z), 2};
+    }
+    if (name == "SWAP") {
+        return {{one, 0, 0, 0, 0, 0, one, 0, 0, one, 0, 0, 0, 0, 0, one}, 2};
+    }
+    if (name == "ISWAP") {
+        return {{one, 0, 0, 0, 0, 0, i, 0, 0, i, 0, 0, 0, 0, 0, one}, 2};
+    }
+    if (name == "CRX") {
+        return {getControlledMatrix(getRotationMatrix('X', param(1))), 2};
+    }
+    if (name == "CRY") {
+        return {getControlledMatrix(getRotationMatrix('Y', param(1))), 2};
+    }
+    if (name == "CRZ") {
+        return {getControlledMatrix(getRotationMatrix('Z', param(1))), 2};
+    }
+    if (name == "ControlledPhaseShift") {
+        return {getControlledMatrix({one, 0, 0, phase(param(1))}), 2};
+    }
+    if (name == "IsingXX") {
+        return {getIsingMatrix('X', param(1)), 2};
+    }
+    if (name == "IsingYY") {
+        return {getIsingMatrix('Y', param(1)), 2};
+    }
+    if (name == "IsingZZ") {
+        return {getIsingMatrix('Z', param(1)), 2};
+    }
+
+    if (name == "Toffoli") {
+        return {getControlledMatrix(pauli_x, 1, {true, true}), 3};
+    }
+    if (name == "CSWAP") {
+        return {getControlledMatrix({one, 0, 0, 0, 0, 0, one, 0, 0, one, 0, 0, 0, 0, 0, one}, 2),
+                3};
+    }
+
+    RT_FAIL("Unsupported gate");
+}
+
+} // namespace Catalyst::Runtime::Devices::GateMatrices
@@ -0,0 +1,486 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * Return `k` in [0, 4) if the angle is `k` quarter turns, i.e. if a rotation of this angle is a
+ * Clifford gate.
+ */
+[[nodiscard]] inline auto getCliffordPower(double angle, double tol = 1e-12) -> std::optional<int>
+{
+    const double quarters = angle / (std::numbers::pi / 2);
+    const double k = std::round(quarters);
+    if (std::abs(quarters - k) > tol) {
+        return std::nullopt;
+    }
+    return static_cast<int>(((static_cast<int64_t>(k) % 4) + 4) % 4);
+}
+
+/**
+ * A bit-packed stabilizer tableau of `n` qubits, following Aaronson and Gottesman, "Improved
+ * simulation of stabilizer circuits", Phys. Rev. A 70, 052328 (2004).
+ *
+ * Rows `0..n-1` are the destabilizers, rows `n..2n-1` the stabilizers, and row `2n` is a scratch
+ * row. Each row stores the X and Z bits of its Pauli string in 64-bit words, where the bits
+ * `(x, z) = (1, 1)` denote a Y factor, and a sign bit. Products of rows, and their phases, are
+ * computed a word at a time.
+ *
+ * Gates cost O(n) and measurements O(n^2 / 64) operations. The tableau is initialized in the
+ * |0...0> state.
+ *
+ * @param num_qubits The number of qubits
+ */
+class StabilizerTableau {
+  public:
+    using WordT = uint64_t;
+    static constexpr size_t word_bits = 64;
+
+  private:
+    size_t num_qubits;
+    size_t num_words;
+
+    // The X and Z bits of the `2n + 1` rows, `num_words` words per row
+    std::vector<WordT> xs;
+    std::vector<WordT> zs;
+    std::vector<uint8_t> signs;
+
+    [[nodiscard]] static auto getWord(size_t qubit) -> size_t { return qubit / word_bits; }
+    [[nodiscard]] static auto getMask(size_t qubit) -> WordT
+    {
+        return WordT{1} << (qubit % word_bits);
+    }
+
+    [[nodiscard]] auto getNumRows() const -> size_t { return 2 * num_qubits + 1; }
+    [[nodiscard]] auto getScratchRow() const -> size_t { return 2 * num_qubits; }
+
+    [[nodiscard]] auto rowX(size_t row) -> WordT * { return xs.data() + row * num_words; }
+    [[nodiscard]] auto rowZ(size_t row) -> WordT * { return zs.data() + row * num_words; }
+
+    void setIdentity(size_t row)
+    {
+        std::fill_n(rowX(row), num_words, 0);
+        std::fill_n(rowZ(row), num_words, 0);
+        signs[row] = 0;
+    }
+
+    void copyRow(size_t dst, size_t src)
+    {
+        std::copy_n(rowX(src), num_words, rowX(dst));
+        std::copy_n(rowZ(src), num_words, rowZ(dst));
+        signs[dst] = signs[src];
+    }
+
+    /**
+     * Multiply row `dst` by row `src` (`dst = src * dst`), tracking the sign of the product.
+     *
+     * The phase `i^g` of the product of two Pauli factors is `+i` for (Y, Z), (X, Y), and
+     * (Z, X), `-i` for (Y, X), (X, Z), and (Z, Y), and `1` otherwise. The factors of each kind
+     * are counted with one popcount per word.
+     */
+    void multiplyRow(size_t dst, size_t src)
+    {
+        WordT *dx = rowX(dst);
+        WordT *dz = rowZ(dst);
+        const WordT *sx = rowX(src);
+        const WordT *sz = rowZ(src);
+
+        int64_t phase = 2 * static_cast<int64_t>(signs[dst] + signs[src]);
+        for (size_t w = 0; w < num_words; w++) {
+            const WordT x1 = sx[w];
+            const WordT z1 = sz[w];
+            const WordT x2 = dx[w];
+            const WordT z2 = dz[w];
+
+            const WordT plus = (x1 & z1 & ~x2 & z2) | (x1 & ~z1 & x2 & z2) | (~x1 & z1 & x2 & ~z2);
+            const WordT minus = (x1 & z1 & x2 & ~z2) | (x1 & ~z1 & ~x2 & z2) | (~x1 & z1 & x2 & z2);
+            phase += std::popcount(plus) - std::popcount(minus);
+
+            dx[w] = x2 ^ x1;
+            dz[w] = z2 ^ z1;
+        }
+        signs[dst] = static_cast<uint8_t>(((phase % 4) + 4) % 4 == 2);
+    }
+
+    /**
+     * Apply `update(x_bits, z_bits, sign)` to every row, where `x_bits` and `z_bits` reference
+     * the words holding the bits of the given qubits.
+     */
+    template <typename UpdateFn> void forEachRow(UpdateFn &&update)
+    {
+        for (size_t row = 0; row < getNumRows(); row++) {
+            update(rowX(row), rowZ(row), signs[row]);
+        }
+    }
+
+  public:
+    explicit StabilizerTableau(size_t _num_qubits = 0)
+        : num_qubits(_num_qubits), num_words((_num_qubits + word_bits - 1) / word_bits),
+          xs(getNumRows() * num_words, 0), zs(getNumRows() * num_words, 0), signs(getNumRows(), 0)
+    {
+        for (size_t qubit = 0; qubit < num_qubits; qubit++) {
+            rowX(qubit)[getWord(qubit)] |= getMask(qubit);
+            rowZ(num_qubits + qubit)[getWord(qubit)] |= getMask(qubit);
+        }
+    }
+    ~StabilizerTableau() = default;
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits; }
+    [[nodiscard]] auto getNumWords() const -> size_t { return num_words; }
+
+    /**
+     * Add `count` qubits in the |0> state.
+     */
+    void addQubits(size_t count)
+    {
+        StabilizerTableau extended(num_qubits + count);
+        const size_t n = extended.num_qubits;
+        for (size_t row = 0; row < num_qubits; row++) {
+            for (auto [src, dst] : {std::pair{row, row}, std::pair{num_qubits + row, n + row}}) {
+                std::copy_n(rowX(src), num_words, extended.rowX(dst));
+                std::copy_n(rowZ(src), num_words, extended.rowZ(dst));
+                extended.signs[dst] = signs[src];
+            }
+        }
+        *this = std::move(extended);
+    }
+
+    // ----------------------------------------
+    //  CLIFFORD GATES
+    // ----------------------------------------
+
+    void H(size_t qubit)
+    {
+        const size_t w = getWord(qubit);
+        const WordT m = getMask(qubit);
+        forEachRow([w, m](WordT *x, WordT *z, uint8_t &sign) {
+            const bool xb = x[w] & m;
+            const bool zb = z[w] & m;
+            sign ^= static_cast<uint8_t>(xb && zb);
+            x[w] = zb ? (x[w] | m) : (x[w] & ~m);
+            z[w] = xb ? (z[w] | m) : (z[w] & ~m);
+        });
+    }
+
+    void S(size_t qubit)
+    {
+        const size_t w = getWord(qubit);
+        const WordT m = getMask(qubit);
+        forEachRow([w, m](WordT *x, WordT *z, uint8_t &sign) {
+            sign ^= static_cast<uint8_t>((x[w] & m) && (z[w] & m));
+            z[w] ^= x[w] & m;
+        });
+    }
+
+    void Sdg(size_t qubit)
+    {
+        const size_t w = getWord(qubit);
+        const WordT m = getMask(qubit);
+        forEachRow([w, m](WordT *x, WordT *z, uint8_t &sign) {
+            sign ^= static_cast<uint8_t>((x[w] & m) && !(z[w] & m));
+            z[w] ^= x[w] & m;
+        });
+    }
+
+    void X(size_t qubit)
+    {
+        const size_t w = getWord(qubit);
+        const WordT m = getMask(qubit);
+        forEachRow([w, m](WordT *, WordT *z, uint8_t &sign) {
+            sign ^= static_cast<uint8_t>((z[w] & m) != 0);
+        });
+    }
+
+    void Y(size_t qubit)
+    {
+        const size_t w = getWord(qubit);
+        const WordT m = getMask(qubit);
+        forEachRow([w, m](WordT *x, WordT *z, uint8_t &sign) {
+            sign ^= static_cast<uint8_t>(((x[w] ^ z[w]) & m) != 0);
+        });
+    }
+
+    void Z(size_t qubit)
+    {
+        const size_t w = getWord(qubit);
+        const WordT m = getMask(qubit);
+        forEachRow([w, m](WordT *x, WordT *, uint8_t &sign) {
+            sign ^= static_cast<uint8_t>((x[w] & m) != 0);
+        });
+    }
+
+    void CNOT(size_t control, size_t target)
+    {
+        RT_FAIL_IF(control == target, "Invalid wires of a two-qubit gate");
+        const size_t cw = getWord(control);
+        const WordT cm = getMask(control);
+        const size_t tw = getWord(target);
+        const WordT tm = getMask(target);
+        forEachRow([=](WordT *x, WordT *z, uint8_t &sign) {
+            const bool xc = x[cw] & cm;
+            const bool zc = z[cw] & cm;
+            const bool xt = x[tw] & tm;
+            const bool zt = z[tw] & tm;
+            sign ^= static_cast<uint8_t>(xc && zt && (xt == zc));
+            if (xc) {
+                x[tw] ^= tm;
+            }
+            if (zt) {
+                z[cw] ^= cm;
+            }
+        });
+    }
+
+    void CZ(size_t qubit0, size_t qubit1)
+    {
+        RT_FAIL_IF(qubit0 == qubit1, "Invalid wires of a two-qubit gate");
+        const size_t w0 = getWord(qubit0);
+        const WordT m0 = getMask(qubit0);
+        const size_t w1 = getWord(qubit1);
+        const WordT m1 = getMask(qubit1);
+        forEachRow([=](WordT *x, WordT *z, uint8_t &sign) {
+            const bool x0 = x[w0] & m0;
+            const bool z0 = z[w0] & m0;
+            const bool x1 = x[w1] & m1;
+            const bool z1 = z[w1] & m1;
+            sign ^= static_cast<uint8_t>(x0 && x1 && (z0 != z1));
+            if (x1) {
+                z[w0] ^= m0;
+            }
+            if (x0) {
+                z[w1] ^= m1;
+            }
+        });
+    }
+
+    void SWAP(size_t qubit0, size_t qubit1)
+    {
+        RT_FAIL_IF(qubit0 == qubit1, "Invalid wires of a two-qubit gate");
+        const size_t w0 = getWord(qubit0);
+        const WordT m0 = getMask(qubit0);
+        const size_t w1 = getWord(qubit1);
+        const WordT m1 = getMask(qubit1);
+        auto swapBits = [=](WordT *bits) {
+            const bool b0 = bits[w0] & m0;
+            const bool b1 = bits[w1] & m1;
+            if (b0 != b1) {
+                bits[w0] ^= m0;
+                bits[w1] ^= m1;
+            }
+        };
+        forEachRow([&](WordT *x, WordT *z, uint8_t &) {
+            swapBits(x);
+            swapBits(z);
+        });
+    }
+
+    // ----------------------------------------
+    //  MEASUREMENTS
+    // ----------------------------------------
+
+    /**
+     * Measure a qubit in the computational basis.
+     *
+     * @param qubit The qubit to measure
+     * @param random_outcome The outcome if it is random
+     * @return The outcome, and whether it was random
+     */
+    auto Measure(size_t qubit, bool random_outcome) -> std::pair<bool, bool>
+    {
+        const size_t n = num_qubits;
+        const size_t w = getWord(qubit);
+        const WordT m = getMask(qubit);
+
+        // The outcome is random iff a stabilizer anticommutes with Z.
+        size_t pivot = n;
+        while (pivot < 2 * n && !(rowX(pivot)[w] & m)) {
+            pivot++;
+        }
+
+        if (pivot < 2 * n) {
+            for (size_t row = 0; row < 2 * n; row++) {
+                if (row != pivot && (rowX(row)[w] & m)) {
+                    multiplyRow(row, pivot);
+                }
+            }
+            copyRow(pivot - n, pivot);
+            setIdentity(pivot);
+            rowZ(pivot)[w] |= m;
+            signs[pivot] = static_cast<uint8_t>(random_outcome);
+            return {random_outcome, true};
+        }
+
+        // Otherwise, Z is the product of the stabilizers paired with the destabilizers that
+        // anticommute with it.
+        const size_t scratch = getScratchRow();
+        setIdentity(scratch);
+        for (size_t row = 0; row < n; row++) {
+            if (rowX(row)[w] & m) {
+                multiplyRow(scratch, n + row);
+            }
+        }
+        return {signs[scratch] != 0, false};
+    }
+
+    /**
+     * Draw samples of a measurement of all qubits in the computational basis, without changing
+     * the state.
+     *
+     * The outcomes of a stabilizer state are uniformly distributed over an affine space: one
+     * outcome, found by measuring a copy of the tableau, plus the span of the X parts of the
+     * stabilizers. After an O(n^3 / 64) setup, each shot costs O(rank * n / 64) operations,
+     * where `rank` is the dimension of the span.
+     *
+     * @param shots The number of samples
+     * @param gen The random number generator
+     * @return The outcomes, in `num_words` words per shot where bit `q` of the outcome is the
+     *         qubit `q`
+     */
+    template <typename GeneratorT>
+    [[nodiscard]] auto Sample(size_t shots, GeneratorT &gen) const -> std::vector<WordT>
+    {
+        const size_t n = num_qubits;
+
+        StabilizerTableau copy(*this);
+        std::vector<WordT> offset(num_words, 0);
+        for (size_t qubit = 0; qubit < n; qubit++) {
+            if (copy.Measure(qubit, false).first) {
+                offset[getWord(qubit)] |= getMask(qubit);
+            }
+        }
+
+        // A basis of the X parts of the stabilizers, by Gaussian elimination
+        std::vector<WordT> basis(xs.begin() + static_cast<std::ptrdiff_t>(n * num_words),
+                                 xs.begin() + static_cast<std::ptrdiff_t>(2 * n * num_words));
+        auto basisRow = [&](size_t row) { return basis.data() + row * num_words; };
+        size_t rank = 0;
+        for (size_t qubit = 0; qubit < n && rank < n; qubit++) {
+            const size_t w = getWord(qubit);
+            const WordT m = getMask(qubit);
+
+            size_t pivot = rank;
+            while (pivot < n && !(basisRow(pivot)[w] & m)) {
+                pivot++;
+            }
+            if (pivot == n) {
+                continue;
+            }
+            std::swap_ranges(basisRow(pivot), basisRow(pivot) + num_words, basisRow(rank));
+            for (size_t row = rank + 1; row < n; row++) {
+                if (basisRow(row)[w] & m) {
+                    for (size_t k = 0; k < num_words; k++) {
+                        basisRow(row)[k] ^= basisRow(rank)[k];
+                    }
+                }
+            }
+            rank++;
+        }
+
+        std::uniform_int_distribution<WordT> dist;
+        std::vector<WordT> samples(shots * num_words);
+        for (size_t shot = 0; shot < shots; shot++) {
+            WordT *sample = samples.data() + shot * num_words;
+            std::copy(offset.begin(), offset.end(), sample);
+            for (size_t row = 0; row < rank; row += word_bits) {
+                WordT bits = dist(gen);
+                for (size_t k = row; k < std::min(rank, row + word_bits); k++, bits >>= 1) {
+                    if (bits & 1U) {
+                        for (size_t word = 0; word < num_words; word++) {
+                            sample[word] ^= basisRow(k)[word];
+                        }
+                    }
+                }
+            }
+        }
+        return samples;
+    }
+
+    /**
+     * Compute the expectation value of a Pauli word, which is 0, 1, or -1 for a stabilizer state.
+     *
+     * @param qubits The qubits of the Pauli word
+     * @param paulis The Pauli operators on these qubits, as characters in "IXYZ"
+     */
+    [[nodiscard]] auto ExpectationValue(const std::vector<size_t> &qubits, std::string_view paulis)
+        -> int
+    {
+        RT_FAIL_IF(qubits.size() != paulis.size(), "Invalid Pauli word");
+
+        struct Factor {
+            size_t word;
+            WordT mask;
+            bool x;
+            bool z;
+        };
+        std::vector<Factor> factors;
+        factors.reserve(qubits.size());
+        std::vector<bool> seen(num_qubits, false);
+        for (size_t k = 0; k < qubits.size(); k++) {
+            const size_t qubit = qubits[k];
+            RT_FAIL_IF(qubit >= num_qubits || seen[qubit], "Invalid wires of the Pauli word");
+            RT_FAIL_IF(paulis[k] != 'I' && paulis[k] != 'X' && paulis[k] != 'Y' && paulis[k] != 'Z',
+                       "Invalid Pauli word");
+            seen[qubit] = true;
+            if (paulis[k] != 'I') {
+                factors.push_back(
+                    {getWord(qubit), getMask(qubit), paulis[k] != 'Z', paulis[k] != 'X'});
+            }
+        }
+
+        auto anticommutes = [&](size_t row) {
+            bool odd = false;
+            for (const auto &f : factors) {
+                const bool xz = f.x && (rowZ(row)[f.word] & f.mask);
+                const bool zx = f.z && (rowX(row)[f.word] & f.mask);
+                odd ^= xz != zx;
+            }
+            return odd;
+        };
+
+        const size_t n = num_qubits;
+        for (size_t row = n; row < 2 * n; row++) {
+            if (anticommutes(row)) {
+                return 0;
+            }
+        }
+
+        // Otherwise, the word is, up to a sign, the product of the stabilizers paired with the
+        // destabilizers that anticommute with it.
+        const size_t scratch = getScratchRow();
+        setIdentity(scratch);
+        for (size_t row = 0; row < n; row++) {
+            if (anticommutes(row)) {
+                multiplyRow(scratch, n + row);
+            }
+        }
+        return signs[scratch] ? -1 : 1;
+    }
+};
+
+} // namespace Catalyst::Runtime::Devices
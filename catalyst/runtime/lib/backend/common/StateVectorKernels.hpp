@@ -0,0 +1,134 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "Exception.hpp"
+
+/**
+ * Dense state-vector kernels.
+ *
+ * A state of n wires is a vector of 2^n amplitudes, where the first wire is the most significant
+ * bit of the index. Matrices are dense and in row-major order, where their first wire is the most
+ * significant one. The kernels apply a k-wire matrix in place, in a single pass over the 2^(n-k)
+ * groups of amplitudes that it mixes, without allocating a new state.
+ */
+namespace Catalyst::Runtime::Devices::StateVectorKernels {
+
+using ComplexT = std::complex<double>;
+
+/**
+ * Apply a single-wire matrix.
+ */
+inline void applyMatrix1(ComplexT *data, size_t num_wires, const ComplexT *matrix, size_t wire)
+{
+    const size_t dim = 1UL << num_wires;
+    const size_t stride = 1UL << (num_wires - 1 - wire);
+    const ComplexT m00 = matrix[0];
+    const ComplexT m01 = matrix[1];
+    const ComplexT m10 = matrix[2];
+    const ComplexT m11 = matrix[3];
+
+    for (size_t base = 0; base < dim; base += 2 * stride) {
+        ComplexT *v0 = data + base;
+        ComplexT *v1 = v0 + stride;
+        for (size_t k = 0; k < stride; k++) {
+            const ComplexT a0 = v0[k];
+            const ComplexT a1 = v1[k];
+            v0[k] = m00 * a0 + m01 * a1;
+            v1[k] = m10 * a0 + m11 * a1;
+        }
+    }
+}
+
+/**
+ * Apply a matrix on any number of distinct wires.
+ */
+inline void applyMatrix(ComplexT *data, size_t num_wires, const ComplexT *matrix,
+                        const std::vector<size_t> &wires)
+{
+    const size_t num_targets = wires.size();
+    RT_FAIL_IF(num_targets == 0 || num_targets > num_wires, "Invalid number of wires");
+
+    if (num_targets == 1) {
+        applyMatrix1(data, num_wires, matrix, wires[0]);
+        return;
+    }
+
+    // The bit positions of the wires, and the offsets of the amplitudes of a group
+    const size_t group_size = 1UL << num_targets;
+    std::vector<size_t> positions(num_targets);
+    std::vector<size_t> offsets(group_size, 0);
+    for (size_t k = 0; k < num_targets; k++) {
+        RT_FAIL_IF(wires[k] >= num_wires, "Invalid wires of the matrix");
+        positions[k] = num_wires - 1 - wires[k];
+    }
+    for (size_t idx = 0; idx < group_size; idx++) {
+        for (size_t k = 0; k < num_targets; k++) {
+            if ((idx >> (num_targets - 1 - k)) & 1U) {
+                offsets[idx] |= 1UL << positions[k];
+            }
+        }
+    }
+    std::sort(positions.begin(), positions.end());
+    RT_FAIL_IF(std::adjacent_find(positions.begin(), positions.end()) != positions.end(),
+               "Invalid wires of the matrix");
+
+    std::vector<ComplexT> in(group_size);
+    const size_t num_groups = 1UL << (num_wires - num_targets);
+    for (size_t group = 0; group < num_groups; group++) {
+        // Insert zero bits at the positions of the wires
+        size_t base = group;
+        for (auto position : positions) {
+            const size_t low = base & ((1UL << position) - 1);
+            base = ((base >> position) << (position + 1)) | low;
+        }
+
+        for (size_t idx = 0; idx < group_size; idx++) {
+            in[idx] = data[base + offsets[idx]];
+        }
+        for (size_t row = 0; row < group_size; row++) {
+            const ComplexT *matrix_row = matrix + row * group_size;
+            ComplexT value = 0;
+            for (size_t col = 0; col < group_size; col++) {
+                value += matrix_row[col] * in[col];
+            }
+            data[base + offsets[row]] = value;
+        }
+    }
+}
+
+/**
+ * Return the probabilities of the basis states of some wires, where the first wire is the most
+ * significant one, from the probabilities of the basis states of all wires.
+ */
+inline auto getMarginalProbabilities(const std::vector<double> &probs, size_t num_wires,
+                                     const std::vector<size_t> &wires) -> std::vector<double>
+{
+    std::vector<double> marginal(1UL << wires.size(), 0.0);
+    for (size_t index = 0; index < probs.size(); index++) {
+        size_t outcome = 0;
+        for (auto wire : wires) {
+            outcome = (outcome << 1) | ((index >> (num_wires - 1 - wire)) & 1U);
+        }
+        marginal[outcome] += probs[index];
+    }
+    return marginal;
+}
+
+} // namespace Catalyst::Runtime::Devices::StateVectorKernels
@@ -1,4 +1,7 @@
 #include "CustomDevice.hpp"
+#include "GateMatrices.hpp"
+#include "StateVectorKernels.hpp"
+#include "Utils.hpp"
 #include <complex>
 #include <vector>
 #include <string>
@@ -7,6 +10,7 @@
 #include <cmath>
 #include <stdexcept>
 #include <filesystem>
+#include <numeric>
 
 using std::vector;
 using std::string;
@@ -26,11 +30,67 @@ void printState(const vector<complex<double>>& state, const string& label) {
     cout << "]\n";
 }
 
+// The index of a basis state restricted to some wires, where the first wire is the most
+// significant bit of the outcome. Wire w of the device is bit w of the basis state.
+static size_t marginalIndex(size_t index, const vector<QubitIdType> &wires) {
+    size_t outcome = 0;
+    for (auto wire : wires) {
+        outcome = (outcome << 1) | ((index >> wire) & 1U);
+    }
+    return outcome;
+}
+
+static double parseProbability(const std::unordered_map<string, string> &kwargs,
+                               const string &key) {
+    auto it = kwargs.find(key);
+    if (it == kwargs.end()) {
+        return 0.0;
+    }
+    double prob = std::stod(it->second);
+    if (prob < 0.0 || prob > 1.0) {
+        throw runtime_error("Invalid probability of the " + key + " channel");
+    }
+    return prob;
+}
+
 namespace Catalyst::Runtime::Devices {
 
 CustomDevice::CustomDevice([[maybe_unused]] const string &kwargs) {
     cout << "Constructor: CustomDevice\n";
     cout << "kwargs: " << kwargs << '\n';
+
+    // Trajectory mode: noisy circuits are simulated by sampling one Kraus operator of every
+    // channel per gate, over independent state vectors run in parallel
+    auto device_kwargs = Catalyst::Runtime::parse_kwargs(kwargs);
+    if (auto it = device_kwargs.find("trajectories"); it != device_kwargs.end()) {
+        num_trajectories_ = std::stoul(it->second);
+    }
+    num_threads_ = std::max(1U, std::thread::hardware_concurrency());
+    if (auto it = device_kwargs.find("threads"); it != device_kwargs.end()) {
+        num_threads_ = std::max(1UL, std::stoul(it->second));
+    }
+    if (auto it = device_kwargs.find("seed"); it != device_kwargs.end()) {
+        fallback_gen_.seed(std::stoul(it->second));
+    }
+
+    const complex<double> one{1.0, 0.0};
+    const complex<double> i{0.0, 1.0};
+    if (double p = parseProbability(device_kwargs, "depolarizing"); p > 0.0) {
+        noise_.push_back({{{one, 0, 0, one}, {0, one, one, 0}, {0, -i, i, 0}, {one, 0, 0, -one}},
+                          {1.0 - p, p / 3, p / 3, p / 3}});
+    }
+    if (double gamma = parseProbability(device_kwargs, "amplitude_damping"); gamma > 0.0) {
+        noise_.push_back({{{one, 0, 0, sqrt(1.0 - gamma)}, {0, sqrt(gamma), 0, 0}}, {}});
+    }
+    if (!noise_.empty() && !useTrajectories()) {
+        throw runtime_error("Noise channels require the trajectory mode (trajectories > 0)");
+    }
+    if (useTrajectories()) {
+        cout << "Trajectory mode: " << num_trajectories_ << " trajectories on " << num_threads_
+             << " threads\n";
+        pool_ = std::make_unique<ThreadPool>(num_threads_);
+        use_fpga_ = false;
+    }
     
     // Check if FPGA kernel is available
     if (use_fpga_) {
@@ -149,6 +209,8 @@ void CustomDevice::ReleaseAllQubits() {
     cout << "Called: ReleaseAllQubits\n";
     num_qubits_ = 0;
     state_.clear();
+    circuit_.clear();
+    observables_.clear();
     printState(state_, "State after ReleaseAllQubits");
 }
 
@@ -159,12 +221,17 @@ auto CustomDevice::GetNumQubits() const -> size_t {
 
 void CustomDevice::SetDeviceShots(size_t shots) {
     cout << "Called: SetDeviceShots with shots: " << shots << '\n';
-    // Shots not used in state vector simulation
+    shots_ = shots; // Only used by counts
 }
 
 auto CustomDevice::GetDeviceShots() const -> size_t {
     cout << "Called: GetDeviceShots\n";
-    return 0; // State vector simulation doesn't use shots
+    return shots_;
+}
+
+void CustomDevice::SetDevicePRNG(std::mt19937 *gen) {
+    cout << "Called: SetDevicePRNG\n";
+    device_gen_ = gen;
 }
 
 void CustomDevice::NamedOperation(const string &name,
@@ -173,17 +240,51 @@ void CustomDevice::NamedOperation(const string &name,
                                  bool inverse,
                                  const vector<QubitIdType> &ctrl_wires,
                                  const vector<bool> &ctrl_values) {
-    if (name == "Hadamard" && wires.size() == 1 && params.empty() && ctrl_wires.empty() && !inverse) {
+    if (name == "Hadamard" && wires.size() == 1 && params.empty() && ctrl_wires.empty() && !inverse
+        && !useTrajectories()) {
         cout << "Applying Hadamard gate on wire " << wires[0] << '\n';
         applyHadamard(wires[0]);
-    } else {
+        return;
+    }
+
+    auto [matrix, num_wires] = GateMatrices::getGateMatrix(name, params);
+    if (wires.size() != num_wires) {
         cerr << "Unsupported operation: " << name << '\n';
         throw runtime_error("Unsupported operation: " + name);
     }
+    MatrixOperation(matrix, wires, inverse, ctrl_wires, ctrl_values);
+}
+
+void CustomDevice::MatrixOperation(const vector<complex<double>> &matrix,
+                                   const vector<QubitIdType> &wires,
+                                   bool inverse,
+                                   const vector<QubitIdType> &ctrl_wires,
+                                   const vector<bool> &ctrl_values) {
+    size_t dim = 1ULL << wires.size();
+    if (matrix.size() != dim * dim || ctrl_wires.size() != ctrl_values.size()) {
+        throw runtime_error("Invalid matrix operation");
+    }
+
+    Operation op{inverse ? GateMatrices::getAdjointMatrix(matrix) : matrix, ctrl_wires};
+    op.wires.insert(op.wires.end(), wires.begin(), wires.end());
+    if (!ctrl_wires.empty()) {
+        op.matrix = GateMatrices::getControlledMatrix(op.matrix, wires.size(), ctrl_values);
+    }
+
+    if (useTrajectories()) {
+        // Gates are replayed by every trajectory, with their own noise branches
+        circuit_.push_back(std::move(op));
+        return;
+    }
+    applyOperation(state_, op);
+    printState(state_, "State after matrix operation");
 }
 
 auto CustomDevice::Measure(QubitIdType wire, optional<int32_t> postselect) -> Result {
     cout << "Called: Measure on wire " << wire << '\n';
+    if (useTrajectories()) {
+        throw runtime_error("Mid-circuit measurements are not supported in trajectory mode");
+    }
     bool *result = new bool(true); // Dummy result for |0>
     return result;
 }
@@ -198,9 +299,284 @@ void CustomDevice::StopTapeRecording() {
 
 void CustomDevice::State(DataView<complex<double>, 1> &state) {
     cout << "Called: State\n";
+    if (useTrajectories()) {
+        throw runtime_error("State is not available in trajectory mode");
+    }
     getState(state);
 }
 
+bool CustomDevice::useTrajectories() const {
+    return num_trajectories_ > 0;
+}
+
+std::mt19937 &CustomDevice::getGenerator() {
+    return device_gen_ != nullptr ? *device_gen_ : fallback_gen_;
+}
+
+void CustomDevice::applyOperation(vector<complex<double>> &state, const Operation &op) const {
+    // The shared kernels index wires from the most significant bit
+    vector<size_t> kernel_wires(op.wires.size());
+    for (size_t k = 0; k < op.wires.size(); ++k) {
+        kernel_wires[k] = num_qubits_ - 1 - static_cast<size_t>(op.wires[k]);
+    }
+    StateVectorKernels::applyMatrix(state.data(), num_qubits_, op.matrix.data(), kernel_wires);
+}
+
+void CustomDevice::applyNoise(vector<complex<double>> &state, QubitIdType wire,
+                              std::mt19937 &gen) const {
+    const size_t bit = 1ULL << wire;
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    for (const auto &channel : noise_) {
+        vector<double> probs = channel.probs;
+        if (probs.empty()) {
+            // Branch probabilities <psi|K^dagger K|psi>, from the reduced state of the wire
+            double r00 = 0.0;
+            double r11 = 0.0;
+            complex<double> r01 = 0.0;
+            for (size_t idx = 0; idx < state.size(); ++idx) {
+                if (idx & bit) {
+                    continue;
+                }
+                r00 += std::norm(state[idx]);
+                r11 += std::norm(state[idx | bit]);
+                r01 += state[idx] * std::conj(state[idx | bit]);
+            }
+            for (const auto &k : channel.kraus) {
+                complex<double> kk00 = std::norm(k[0]) + std::norm(k[2]);
+                complex<double> kk11 = std::norm(k[1]) + std::norm(k[3]);
+                complex<double> kk01 = std::conj(k[0]) * k[1] + std::conj(k[2]) * k[3];
+                probs.push_back((kk00 * r00 + kk11 * r11 + 2.0 * kk01 * std::conj(r01)).real());
+            }
+        }
+
+        // Branches of negligible probability are never taken: rounding could otherwise let the
+        // draw fall through to one of them and renormalize a state of norm about 0
+        constexpr double min_branch_prob = 1e-12;
+        double total = 0.0;
+        for (auto &prob : probs) {
+            if (prob < min_branch_prob) {
+                prob = 0.0;
+            }
+            total += prob;
+        }
+
+        size_t branch = 0;
+        double draw = uniform(gen) * total;
+        for (size_t k = 0; k < probs.size(); ++k) {
+            if (probs[k] == 0.0) {
+                continue;
+            }
+            branch = k;
+            if (draw < probs[k]) {
+                break;
+            }
+            draw -= probs[k];
+        }
+
+        // The identity branch of a mixture of unitaries leaves the state unchanged
+        if (!channel.probs.empty() && branch == 0) {
+            continue;
+        }
+        double scale = channel.probs.empty() ? 1.0 / sqrt(probs[branch]) : 1.0;
+        Operation op{channel.kraus[branch], {wire}};
+        for (auto &entry : op.matrix) {
+            entry *= scale;
+        }
+        applyOperation(state, op);
+    }
+}
+
+void CustomDevice::runTrajectory(vector<complex<double>> &state, std::mt19937 &gen) const {
+    state.assign(1ULL << num_qubits_, 0.0);
+    state[0] = 1.0;
+    for (const auto &op : circuit_) {
+        applyOperation(state, op);
+        for (auto wire : op.wires) {
+            applyNoise(state, wire, gen);
+        }
+    }
+}
+
+void CustomDevice::forEachTrajectory(
+    size_t num_trajectories,
+    const std::function<void(const vector<complex<double>> &, size_t, size_t, std::mt19937 &)>
+        &fn) {
+    // Trajectories are seeded in order from the device PRNG, so that the results don't depend
+    // on their scheduling across the threads
+    vector<std::mt19937::result_type> seeds(num_trajectories);
+    for (auto &seed : seeds) {
+        seed = getGenerator()();
+    }
+
+    // One state vector per thread
+    vector<vector<complex<double>>> states(pool_->size());
+    pool_->parallelFor(num_trajectories, [&](size_t trajectory, size_t worker) {
+        std::mt19937 gen(seeds[trajectory]);
+        runTrajectory(states[worker], gen);
+        fn(states[worker], trajectory, worker, gen);
+    });
+}
+
+auto CustomDevice::Observable(ObsId id, const vector<complex<double>> &matrix,
+                              const vector<QubitIdType> &wires) -> ObsIdType {
+    cout << "Called: Observable\n";
+    const complex<double> one{1.0, 0.0};
+    const complex<double> i{0.0, 1.0};
+    const complex<double> h{1.0 / sqrt(2.0), 0.0};
+
+    Operation obs{{}, wires};
+    switch (id) {
+    case ObsId::Identity:
+        obs.matrix = {one, 0, 0, one};
+        break;
+    case ObsId::PauliX:
+        obs.matrix = {0, one, one, 0};
+        break;
+    case ObsId::PauliY:
+        obs.matrix = {0, -i, i, 0};
+        break;
+    case ObsId::PauliZ:
+        obs.matrix = {one, 0, 0, -one};
+        break;
+    case ObsId::Hadamard:
+        obs.matrix = {h, h, h, -h};
+        break;
+    case ObsId::Hermitian:
+        obs.matrix = matrix;
+        break;
+    }
+
+    size_t dim = 1ULL << wires.size();
+    if (wires.empty() || obs.matrix.size() != dim * dim) {
+        throw runtime_error("Invalid observable");
+    }
+    observables_.push_back(std::move(obs));
+    return static_cast<ObsIdType>(observables_.size() - 1);
+}
+
+auto CustomDevice::Expval(ObsIdType obsKey) -> double {
+    cout << "Called: Expval\n";
+    if (obsKey < 0 || static_cast<size_t>(obsKey) >= observables_.size()) {
+        throw runtime_error("Invalid observable");
+    }
+    const Operation &obs = observables_[obsKey];
+
+    auto expectation = [this, &obs](const vector<complex<double>> &state) {
+        vector<complex<double>> product = state;
+        applyOperation(product, obs);
+        complex<double> value = 0.0;
+        for (size_t idx = 0; idx < state.size(); ++idx) {
+            value += std::conj(state[idx]) * product[idx];
+        }
+        return value.real();
+    };
+
+    if (!useTrajectories()) {
+        return expectation(state_);
+    }
+
+    // The average over the trajectories, summed in order
+    vector<double> values(num_trajectories_);
+    forEachTrajectory(num_trajectories_, [&](const vector<complex<double>> &state,
+                                             size_t trajectory, size_t, std::mt19937 &) {
+        values[trajectory] = expectation(state);
+    });
+    return std::accumulate(values.begin(), values.end(), 0.0) / num_trajectories_;
+}
+
+std::vector<double> CustomDevice::getProbabilities(const vector<QubitIdType> &wires) {
+    const size_t num_outcomes = 1ULL << wires.size();
+    auto accumulate = [&wires](const vector<complex<double>> &state, vector<double> &probs) {
+        for (size_t idx = 0; idx < state.size(); ++idx) {
+            probs[marginalIndex(idx, wires)] += std::norm(state[idx]);
+        }
+    };
+
+    vector<double> probs(num_outcomes, 0.0);
+    if (!useTrajectories()) {
+        accumulate(state_, probs);
+        return probs;
+    }
+
+    vector<vector<double>> partial(pool_->size(), vector<double>(num_outcomes, 0.0));
+    forEachTrajectory(num_trajectories_, [&](const vector<complex<double>> &state, size_t,
+                                             size_t worker, std::mt19937 &) {
+        accumulate(state, partial[worker]);
+    });
+    for (const auto &worker_probs : partial) {
+        for (size_t outcome = 0; outcome < num_outcomes; ++outcome) {
+            probs[outcome] += worker_probs[outcome] / num_trajectories_;
+        }
+    }
+    return probs;
+}
+
+void CustomDevice::Probs(DataView<double, 1> &probs) {
+    vector<QubitIdType> wires(num_qubits_);
+    std::iota(wires.begin(), wires.end(), 0);
+    PartialProbs(probs, wires);
+}
+
+void CustomDevice::PartialProbs(DataView<double, 1> &probs, const vector<QubitIdType> &wires) {
+    cout << "Called: Probs\n";
+    auto values = getProbabilities(wires);
+    if (probs.size() != values.size()) {
+        throw runtime_error("Probabilities size mismatch");
+    }
+    std::copy(values.begin(), values.end(), probs.begin());
+}
+
+void CustomDevice::Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts) {
+    vector<QubitIdType> wires(num_qubits_);
+    std::iota(wires.begin(), wires.end(), 0);
+    PartialCounts(eigvals, counts, wires);
+}
+
+void CustomDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                                 const vector<QubitIdType> &wires) {
+    cout << "Called: Counts\n";
+    const size_t num_outcomes = 1ULL << wires.size();
+    if (eigvals.size() != num_outcomes || counts.size() != num_outcomes) {
+        throw runtime_error("Counts size mismatch");
+    }
+
+    auto draw = [&wires, num_outcomes](const vector<complex<double>> &state, size_t shots,
+                                       std::mt19937 &gen, vector<int64_t> &histogram) {
+        vector<double> probs(num_outcomes, 0.0);
+        for (size_t idx = 0; idx < state.size(); ++idx) {
+            probs[marginalIndex(idx, wires)] += std::norm(state[idx]);
+        }
+        std::discrete_distribution<size_t> distribution(probs.begin(), probs.end());
+        for (size_t shot = 0; shot < shots; ++shot) {
+            histogram[distribution(gen)]++;
+        }
+    };
+
+    vector<int64_t> histogram(num_outcomes, 0);
+    if (!useTrajectories()) {
+        draw(state_, shots_, getGenerator(), histogram);
+    } else if (shots_ > 0) {
+        // The shots are split evenly across the trajectories
+        size_t num_trajectories = std::min(num_trajectories_, shots_);
+        vector<vector<int64_t>> partial(pool_->size(), vector<int64_t>(num_outcomes, 0));
+        forEachTrajectory(num_trajectories, [&](const vector<complex<double>> &state,
+                                                size_t trajectory, size_t worker,
+                                                std::mt19937 &gen) {
+            size_t shots = shots_ / num_trajectories + (trajectory < shots_ % num_trajectories);
+            draw(state, shots, gen, partial[worker]);
+        });
+        for (const auto &worker_histogram : partial) {
+            for (size_t outcome = 0; outcome < num_outcomes; ++outcome) {
+                histogram[outcome] += worker_histogram[outcome];
+            }
+        }
+    }
+
+    std::iota(eigvals.begin(), eigvals.end(), 0);
+    std::copy(histogram.begin(), histogram.end(), counts.begin());
+}
+
 } // namespace Catalyst::Runtime::Devices
 
 GENERATE_DEVICE_FACTORY(CustomDevice, Catalyst::Runtime::Devices::CustomDevice)
\ No newline at end of file
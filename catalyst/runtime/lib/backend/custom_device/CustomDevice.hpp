@@ -5,6 +5,7 @@
 #include <memory>
 #include <optional>
 #include <random>
+#include <functional>
 #include <vector>
 #include <string>
 
@@ -13,6 +14,8 @@
 #include "QubitManager.hpp"
 #include "Types.h"
 
+#include "ThreadPool.hpp"
+
 // Forward declaration for the Hadamard kernel interface
 namespace Catalyst::Runtime::Devices {
     int hadamard_kernel_execute(
@@ -38,6 +41,7 @@ struct CustomDevice : public QuantumDevice {
     auto GetNumQubits() const -> size_t override;
     void SetDeviceShots(size_t shots) override;
     auto GetDeviceShots() const -> size_t override;
+    void SetDevicePRNG(std::mt19937 *gen) override;
 
     void NamedOperation(const std::string &name,
                         const std::vector<double> &params,
@@ -45,24 +49,78 @@ struct CustomDevice : public QuantumDevice {
                         bool inverse,
                         const std::vector<QubitIdType> &ctrl_wires,
                         const std::vector<bool> &ctrl_values) override;
+    void MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                         const std::vector<QubitIdType> &wires,
+                         bool inverse,
+                         const std::vector<QubitIdType> &ctrl_wires,
+                         const std::vector<bool> &ctrl_values) override;
 
     auto Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result override;
 
     void StartTapeRecording() override;
     void StopTapeRecording() override;
 
+    auto Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
+                    const std::vector<QubitIdType> &wires) -> ObsIdType override;
+    auto Expval(ObsIdType obsKey) -> double override;
+
     void State(DataView<std::complex<double>, 1> &state) override;
+    void Probs(DataView<double, 1> &probs) override;
+    void PartialProbs(DataView<double, 1> &probs,
+                      const std::vector<QubitIdType> &wires) override;
+    void Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts) override;
+    void PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                       const std::vector<QubitIdType> &wires) override;
 
 private:
+    using Matrix = std::vector<std::complex<double>>;
+
+    // A gate, with its dense matrix on device wires (controls first)
+    struct Operation {
+        Matrix matrix;
+        std::vector<QubitIdType> wires;
+    };
+
+    // A single-qubit noise channel, applied after every gate on each of its wires.
+    // `probs` holds the fixed branch probabilities of a mixture of unitaries, whose first
+    // Kraus operator is the identity; it is empty for channels with state-dependent branches.
+    struct NoiseChannel {
+        std::vector<Matrix> kraus;
+        std::vector<double> probs;
+    };
+
     void applyHadamard(QubitIdType wire);
     void applyHadamardCPU(QubitIdType wire);
     void getState(DataView<std::complex<double>, 1> &state);
     bool useFPGAKernel() const;
 
+    // Trajectory mode
+    bool useTrajectories() const;
+    std::mt19937 &getGenerator();
+    void applyOperation(std::vector<std::complex<double>> &state, const Operation &op) const;
+    void applyNoise(std::vector<std::complex<double>> &state, QubitIdType wire,
+                    std::mt19937 &gen) const;
+    void runTrajectory(std::vector<std::complex<double>> &state, std::mt19937 &gen) const;
+    void forEachTrajectory(size_t num_trajectories,
+                           const std::function<void(const std::vector<std::complex<double>> &,
+                                                    size_t, size_t, std::mt19937 &)> &fn);
+    std::vector<double> getProbabilities(const std::vector<QubitIdType> &wires);
+
     size_t num_qubits_{0};
     std::vector<std::complex<double>> state_;
     std::string xclbin_path_{"libadf.xclbin"}; // Path to FPGA bitstream
     bool use_fpga_{true}; // Flag to enable/disable FPGA kernel usage
+
+    size_t shots_{0};
+    std::mt19937 *device_gen_{nullptr};
+    std::mt19937 fallback_gen_{std::random_device{}()};
+
+    size_t num_trajectories_{0}; // 0: noiseless simulation of a single state vector
+    size_t num_threads_{0};
+    std::vector<NoiseChannel> noise_;
+    std::vector<Operation> circuit_; // Gates recorded in trajectory mode
+    std::vector<Operation> observables_;
+    std::unique_ptr<ThreadPool> pool_;
 };
 
 } // namespace Catalyst::Runtime::Devices
\ No newline at end of file
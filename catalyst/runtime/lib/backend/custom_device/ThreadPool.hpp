@@ -0,0 +1,109 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Catalyst::Runtime::Devices {
+
+// A fixed set of worker threads that run the iterations of a loop.
+//
+// The workers are created once and sleep between loops, so the trajectories of every
+// measurement process don't pay for spawning threads. Iterations are handed out one at a
+// time, so that workers which finish early pick up the remaining ones.
+class ThreadPool {
+public:
+    // The body of a loop, given the iteration and the index of the worker running it
+    using Task = std::function<void(size_t iteration, size_t worker)>;
+
+    explicit ThreadPool(size_t num_workers) {
+        for (size_t worker = 0; worker < num_workers; ++worker) {
+            workers_.emplace_back([this, worker] { run(worker); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto &thread : workers_) {
+            thread.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    size_t size() const { return workers_.size(); }
+
+    // Run `task` for the iterations 0..count-1, and wait for all of them.
+    // The first exception thrown by an iteration is rethrown here.
+    void parallelFor(size_t count, const Task &task) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_ = &task;
+        count_ = count;
+        next_ = 0;
+        pending_ = count;
+        error_ = nullptr;
+        ++generation_;
+        wake_.notify_all();
+        done_.wait(lock, [this] { return pending_ == 0; });
+        task_ = nullptr;
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+private:
+    void run(size_t worker) {
+        size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            wake_.wait(lock, [this, seen] { return stop_ || generation_ != seen; });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+
+            while (next_ < count_) {
+                size_t iteration = next_++;
+                const Task *task = task_;
+                lock.unlock();
+                std::exception_ptr error = nullptr;
+                try {
+                    (*task)(iteration, worker);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                lock.lock();
+                if (error && !error_) {
+                    error_ = error;
+                }
+                if (--pending_ == 0) {
+                    done_.notify_one();
+                }
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+
+    const Task *task_{nullptr};
+    size_t count_{0};
+    size_t next_{0};
+    size_t pending_{0};
+    size_t generation_{0};
+    bool stop_{false};
+    std::exception_ptr error_{nullptr};
+};
+
+} // namespace Catalyst::Runtime::Devices
@@ -0,0 +1,185 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "Exception.hpp"
+#include "StateVectorKernels.hpp"
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * The density matrix of a register of qubits.
+ *
+ * The 2^n-by-2^n matrix of n qubits is stored as a vector of 4^n entries, where entry (r, c) is
+ * at index r 2^n + c. It is thus the state vector of 2n wires, where wires 0..n-1 hold the row
+ * and wires n..2n-1 the column of an entry, and the state-vector kernels apply to it without
+ * change: a gate U on the wires w maps rho to U rho U^dagger, which is U applied on the wires w
+ * and conj(U) on the wires n + w. A single-qubit channel with Kraus operators K_i is likewise the
+ * two-wire superoperator sum_i K_i (x) conj(K_i) on the wires (w, n + w).
+ */
+class DensityMatrix {
+  public:
+    using ComplexT = std::complex<double>;
+
+    // A matrix in row-major order, where the first qubit is the most significant one
+    using MatrixT = std::vector<ComplexT>;
+
+  private:
+    size_t num_qubits{0};
+    std::vector<ComplexT> data{ComplexT{1.0, 0.0}};
+
+    [[nodiscard]] static auto getConjugate(const MatrixT &matrix) -> MatrixT
+    {
+        MatrixT conjugate(matrix.size());
+        for (size_t idx = 0; idx < matrix.size(); idx++) {
+            conjugate[idx] = std::conj(matrix[idx]);
+        }
+        return conjugate;
+    }
+
+    [[nodiscard]] auto getColumnWires(const std::vector<size_t> &wires) const
+        -> std::vector<size_t>
+    {
+        std::vector<size_t> columns(wires.size());
+        for (size_t k = 0; k < wires.size(); k++) {
+            columns[k] = num_qubits + wires[k];
+        }
+        return columns;
+    }
+
+  public:
+    /**
+     * Return the superoperator sum_i K_i (x) conj(K_i) of a single-qubit channel, as a matrix on
+     * the (row, column) wires of the qubit.
+     */
+    [[nodiscard]] static auto getSuperoperator(const std::vector<MatrixT> &kraus) -> MatrixT
+    {
+        MatrixT superop(16, ComplexT{0.0});
+        for (const auto &op : kraus) {
+            RT_FAIL_IF(op.size() != 4, "Invalid size of the Kraus operator");
+            for (size_t row = 0; row < 4; row++) {
+                for (size_t col = 0; col < 4; col++) {
+                    superop[row * 4 + col] +=
+                        op[(row >> 1) * 2 + (col >> 1)] * std::conj(op[(row & 1) * 2 + (col & 1)]);
+                }
+            }
+        }
+        return superop;
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits; }
+    [[nodiscard]] auto getData() const -> const std::vector<ComplexT> & { return data; }
+
+    /**
+     * Append qubits in the state |0>, i.e. map rho to rho (x) |0><0|.
+     */
+    void addQubits(size_t num_new)
+    {
+        RT_FAIL_IF(2 * (num_qubits + num_new) >= 64,
+                   "Unable to simulate the density matrix of 32 qubits or more");
+
+        const size_t dim = 1UL << num_qubits;
+        const size_t new_dim = dim << num_new;
+        std::vector<ComplexT> new_data(new_dim * new_dim, ComplexT{0.0});
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                new_data[(row << num_new) * new_dim + (col << num_new)] = data[row * dim + col];
+            }
+        }
+        data = std::move(new_data);
+        num_qubits += num_new;
+    }
+
+    /**
+     * Apply a unitary on some qubits, i.e. map rho to U rho U^dagger.
+     */
+    void apply(const MatrixT &matrix, const std::vector<size_t> &wires)
+    {
+        StateVectorKernels::applyMatrix(data.data(), 2 * num_qubits, matrix.data(), wires);
+        StateVectorKernels::applyMatrix(data.data(), 2 * num_qubits, getConjugate(matrix).data(),
+                                        getColumnWires(wires));
+    }
+
+    /**
+     * Multiply the density matrix by a matrix on the left, i.e. map rho to O rho.
+     */
+    void applyLeft(const MatrixT &matrix, const std::vector<size_t> &wires)
+    {
+        StateVectorKernels::applyMatrix(data.data(), 2 * num_qubits, matrix.data(), wires);
+    }
+
+    /**
+     * Apply a single-qubit channel, given by its superoperator (see `getSuperoperator`).
+     */
+    void applyChannel(const MatrixT &superop, size_t wire)
+    {
+        StateVectorKernels::applyMatrix(data.data(), 2 * num_qubits, superop.data(),
+                                        {wire, num_qubits + wire});
+    }
+
+    [[nodiscard]] auto getTrace() const -> ComplexT
+    {
+        const size_t dim = 1UL << num_qubits;
+        ComplexT trace{0.0};
+        for (size_t idx = 0; idx < dim; idx++) {
+            trace += data[idx * dim + idx];
+        }
+        return trace;
+    }
+
+    /**
+     * Return the probabilities of the basis states of all qubits, i.e. the diagonal of rho.
+     */
+    [[nodiscard]] auto getProbabilities() const -> std::vector<double>
+    {
+        const size_t dim = 1UL << num_qubits;
+        std::vector<double> probs(dim);
+        for (size_t idx = 0; idx < dim; idx++) {
+            probs[idx] = std::max(data[idx * dim + idx].real(), 0.0);
+        }
+        return probs;
+    }
+
+    /**
+     * Project a qubit onto a measurement outcome, and renormalize the density matrix.
+     */
+    void collapse(size_t wire, bool outcome)
+    {
+        const size_t dim = 1UL << num_qubits;
+        const size_t bit = 1UL << (num_qubits - 1 - wire);
+        const size_t value = outcome ? bit : 0;
+
+        double norm{0.0};
+        for (size_t idx = 0; idx < dim; idx++) {
+            if ((idx & bit) == value) {
+                norm += data[idx * dim + idx].real();
+            }
+        }
+        RT_FAIL_IF(norm <= 0.0, "Probability of the measurement outcome is 0");
+
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                auto &entry = data[row * dim + col];
+                entry = ((row & bit) == value && (col & bit) == value) ? entry / norm : 0.0;
+            }
+        }
+    }
+};
+
+} // namespace Catalyst::Runtime::Devices
@@ -0,0 +1,437 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <unordered_set>
+
+#include "Exception.hpp"
+#include "GateMatrices.hpp"
+#include "StateVectorKernels.hpp"
+#include "Utils.hpp"
+
+#include "DensityMatrixDevice.hpp"
+
+namespace {
+using Catalyst::Runtime::Devices::DensityMatrix;
+using ComplexT = DensityMatrix::ComplexT;
+using MatrixT = DensityMatrix::MatrixT;
+
+static constexpr bool GLOBAL_RESULT_TRUE_CONST = true;
+static constexpr bool GLOBAL_RESULT_FALSE_CONST = false;
+
+auto parseProbability(const std::unordered_map<std::string, std::string> &kwargs,
+                      const std::string &key) -> double
+{
+    auto it = kwargs.find(key);
+    if (it == kwargs.end()) {
+        return 0.0;
+    }
+
+    const double prob = std::stod(it->second);
+    RT_FAIL_IF(prob < 0.0 || prob > 1.0, "Invalid probability of a noise channel");
+    return prob;
+}
+
+// The product of two single-qubit superoperators, i.e. the channel `lhs` after `rhs`
+auto composeSuperoperators(const MatrixT &lhs, const MatrixT &rhs) -> MatrixT
+{
+    MatrixT product(16, ComplexT{0.0});
+    for (size_t row = 0; row < 4; row++) {
+        for (size_t k = 0; k < 4; k++) {
+            for (size_t col = 0; col < 4; col++) {
+                product[row * 4 + col] += lhs[row * 4 + k] * rhs[k * 4 + col];
+            }
+        }
+    }
+    return product;
+}
+
+auto getPauliMatrix(ObsId id) -> MatrixT
+{
+    const ComplexT one{1.0, 0.0};
+    const ComplexT i{0.0, 1.0};
+    const ComplexT h{1.0 / std::numbers::sqrt2, 0.0};
+
+    switch (id) {
+    case ObsId::PauliX:
+        return {0, one, one, 0};
+    case ObsId::PauliY:
+        return {0, -i, i, 0};
+    case ObsId::PauliZ:
+        return {one, 0, 0, -one};
+    case ObsId::Hadamard:
+        return {h, h, h, -h};
+    default:
+        return {one, 0, 0, one};
+    }
+}
+} // namespace
+
+namespace Catalyst::Runtime::Devices {
+
+DensityMatrixDevice::DensityMatrixDevice(const std::string &kwargs)
+    : device_kwargs(Catalyst::Runtime::parse_kwargs(kwargs)), fallback_gen(std::random_device{}())
+{
+    depolarizing = parseProbability(device_kwargs, "depolarizing");
+    amplitude_damping = parseProbability(device_kwargs, "amplitude_damping");
+    readout_error = parseProbability(device_kwargs, "readout_error");
+    if (auto it = device_kwargs.find("seed"); it != device_kwargs.end()) {
+        fallback_gen.seed(std::stoul(it->second));
+    }
+
+    // The depolarizing channel is followed by the amplitude damping channel
+    if (depolarizing > 0.0) {
+        const double p = depolarizing;
+        const ComplexT k0{std::sqrt(1.0 - p), 0.0};
+        const ComplexT k{std::sqrt(p / 3), 0.0};
+        const ComplexT ik{0.0, std::sqrt(p / 3)};
+        gate_noise = DensityMatrix::getSuperoperator(
+            {{k0, 0, 0, k0}, {0, k, k, 0}, {0, -ik, ik, 0}, {k, 0, 0, -k}});
+    }
+    if (amplitude_damping > 0.0) {
+        const double gamma = amplitude_damping;
+        auto &&damping = DensityMatrix::getSuperoperator(
+            {{1.0, 0, 0, std::sqrt(1.0 - gamma)}, {0, std::sqrt(gamma), 0, 0}});
+        gate_noise = gate_noise ? composeSuperoperators(damping, *gate_noise) : damping;
+    }
+}
+
+auto DensityMatrixDevice::AllocateQubits(size_t num_new) -> std::vector<QubitIdType>
+{
+    if (!num_new) {
+        return {};
+    }
+
+    state.addQubits(num_new);
+    auto ids = qubit_manager.AllocateRange(num_qubits, num_new);
+    num_qubits += num_new;
+    return ids;
+}
+
+void DensityMatrixDevice::ReleaseAllQubits()
+{
+    num_qubits = 0;
+    qubit_manager.ReleaseAll();
+    state = DensityMatrix{};
+    observables.clear();
+}
+
+auto DensityMatrixDevice::GetNumQubits() const -> size_t { return num_qubits; }
+
+void DensityMatrixDevice::SetDeviceShots(size_t shots) { device_shots = shots; }
+
+auto DensityMatrixDevice::GetDeviceShots() const -> size_t { return device_shots; }
+
+void DensityMatrixDevice::SetDevicePRNG(std::mt19937 *gen) { device_gen = gen; }
+
+void DensityMatrixDevice::applyMatrix(MatrixT matrix, const std::vector<QubitIdType> &wires,
+                                      bool inverse,
+                                      const std::vector<QubitIdType> &controlled_wires,
+                                      const std::vector<bool> &controlled_values)
+{
+    RT_FAIL_IF(controlled_wires.size() != controlled_values.size(),
+               "Invalid number of control values");
+    RT_FAIL_IF(wires.empty(), "Invalid number of wires");
+
+    const size_t dim = 1UL << wires.size();
+    RT_FAIL_IF(matrix.size() != dim * dim, "Invalid size of the matrix");
+
+    if (inverse) {
+        matrix = GateMatrices::getAdjointMatrix(matrix);
+    }
+
+    // The control wires are the most significant ones of the controlled matrix
+    std::vector<size_t> dev_wires = qubit_manager.getDeviceIds(controlled_wires);
+    auto &&target_wires = qubit_manager.getDeviceIds(wires);
+    dev_wires.insert(dev_wires.end(), target_wires.begin(), target_wires.end());
+    if (!controlled_wires.empty()) {
+        matrix = GateMatrices::getControlledMatrix(matrix, wires.size(), controlled_values);
+    }
+
+    state.apply(matrix, dev_wires);
+
+    if (gate_noise) {
+        for (auto wire : dev_wires) {
+            state.applyChannel(*gate_noise, wire);
+        }
+    }
+}
+
+void DensityMatrixDevice::NamedOperation(const std::string &name,
+                                         const std::vector<double> &params,
+                                         const std::vector<QubitIdType> &wires, bool inverse,
+                                         const std::vector<QubitIdType> &controlled_wires,
+                                         const std::vector<bool> &controlled_values)
+{
+    auto &&[matrix, num_wires] = GateMatrices::getGateMatrix(name, params);
+    RT_FAIL_IF(wires.size() != num_wires, "Invalid number of wires");
+
+    applyMatrix(std::move(matrix), wires, inverse, controlled_wires, controlled_values);
+}
+
+void DensityMatrixDevice::MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                                          const std::vector<QubitIdType> &wires, bool inverse,
+                                          const std::vector<QubitIdType> &controlled_wires,
+                                          const std::vector<bool> &controlled_values)
+{
+    applyMatrix(MatrixT(matrix.begin(), matrix.end()), wires, inverse, controlled_wires,
+                controlled_values);
+}
+
+auto DensityMatrixDevice::Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result
+{
+    using Catalyst::Runtime::Simulator::Lightning::simulateDraw;
+
+    const size_t dev_wire = qubit_manager.getDeviceId(wire);
+    auto &&probs = StateVectorKernels::getMarginalProbabilities(state.getProbabilities(),
+                                                                num_qubits, {dev_wire});
+    bool outcome = simulateDraw(probs, postselect, getGenerator());
+    state.collapse(dev_wire, outcome);
+
+    // The state collapses on the actual outcome, but its readout may be flipped
+    if (!postselect && readout_error > 0.0) {
+        std::bernoulli_distribution flip(readout_error);
+        outcome ^= flip(*getGenerator());
+    }
+
+    return const_cast<Result>(outcome ? &GLOBAL_RESULT_TRUE_CONST : &GLOBAL_RESULT_FALSE_CONST);
+}
+
+auto DensityMatrixDevice::Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
+                                     const std::vector<QubitIdType> &wires) -> ObsIdType
+{
+    ObservableTerm term{1.0, {}};
+    if (id == ObsId::Hermitian) {
+        const size_t dim = 1UL << wires.size();
+        RT_FAIL_IF(wires.empty() || matrix.size() != dim * dim, "Invalid size of the matrix");
+        term.factors.emplace_back(MatrixT(matrix.begin(), matrix.end()),
+                                  qubit_manager.getDeviceIds(wires));
+    }
+    else if (id != ObsId::Identity) {
+        RT_FAIL_IF(wires.size() != 1, "Invalid number of wires");
+        term.factors.emplace_back(getPauliMatrix(id), qubit_manager.getDeviceIds(wires));
+    }
+    observables.push_back({std::move(term)});
+    return static_cast<ObsIdType>(observables.size() - 1);
+}
+
+auto DensityMatrixDevice::TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType
+{
+    ObservableTerm product{1.0, {}};
+    std::unordered_set<size_t> wires;
+    for (auto key : obs) {
+        const auto &terms = getObservable(key);
+        RT_FAIL_IF(terms.size() != 1, "Invalid tensor product of a Hamiltonian observable");
+
+        const auto &term = terms[0];
+        product.coeff *= term.coeff;
+        for (const auto &factor : term.factors) {
+            for (auto wire : factor.second) {
+                RT_FAIL_IF(!wires.insert(wire).second,
+                           "Invalid tensor product of observables sharing wires");
+            }
+            product.factors.push_back(factor);
+        }
+    }
+    observables.push_back({std::move(product)});
+    return static_cast<ObsIdType>(observables.size() - 1);
+}
+
+auto DensityMatrixDevice::HamiltonianObservable(const std::vector<double> &coeffs,
+                                                const std::vector<ObsIdType> &obs) -> ObsIdType
+{
+    RT_FAIL_IF(coeffs.size() != obs.size(), "Incompatible list of observables and coefficients");
+
+    std::vector<ObservableTerm> sum;
+    for (size_t idx = 0; idx < obs.size(); idx++) {
+        for (auto term : getObservable(obs[idx])) {
+            term.coeff *= coeffs[idx];
+            sum.push_back(std::move(term));
+        }
+    }
+    observables.push_back(std::move(sum));
+    return static_cast<ObsIdType>(observables.size() - 1);
+}
+
+auto DensityMatrixDevice::getObservable(ObsIdType obsKey) const
+    -> const std::vector<ObservableTerm> &
+{
+    RT_FAIL_IF(obsKey < 0 || static_cast<size_t>(obsKey) >= observables.size(),
+               "Invalid key for cached observables");
+    return observables[obsKey];
+}
+
+auto DensityMatrixDevice::getMeasuredState() const -> DensityMatrix
+{
+    DensityMatrix measured = state;
+    if (readout_error > 0.0) {
+        // The bit flip channel of the readout on every qubit
+        const ComplexT k0{std::sqrt(1.0 - readout_error), 0.0};
+        const ComplexT k1{std::sqrt(readout_error), 0.0};
+        auto &&flip = DensityMatrix::getSuperoperator({{k0, 0, 0, k0}, {0, k1, k1, 0}});
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            measured.applyChannel(flip, wire);
+        }
+    }
+    return measured;
+}
+
+auto DensityMatrixDevice::Expval(ObsIdType obsKey) -> double
+{
+    const auto &&measured = getMeasuredState();
+
+    double expval{0.0};
+    for (const auto &term : getObservable(obsKey)) {
+        DensityMatrix product = measured;
+        for (const auto &[matrix, wires] : term.factors) {
+            product.applyLeft(matrix, wires);
+        }
+        expval += term.coeff * product.getTrace().real();
+    }
+    return expval;
+}
+
+auto DensityMatrixDevice::Var(ObsIdType obsKey) -> double
+{
+    const auto &terms = getObservable(obsKey);
+    const auto &&measured = getMeasuredState();
+
+    // Tr(H^2 rho) = sum_{s, t} c_s c_t Tr(P_s P_t rho)
+    double expval{0.0};
+    double square{0.0};
+    for (const auto &rhs : terms) {
+        DensityMatrix partial = measured;
+        for (const auto &[matrix, wires] : rhs.factors) {
+            partial.applyLeft(matrix, wires);
+        }
+        expval += rhs.coeff * partial.getTrace().real();
+        for (const auto &lhs : terms) {
+            DensityMatrix product = partial;
+            for (const auto &[matrix, wires] : lhs.factors) {
+                product.applyLeft(matrix, wires);
+            }
+            square += lhs.coeff * rhs.coeff * product.getTrace().real();
+        }
+    }
+
+    return square - expval * expval;
+}
+
+auto DensityMatrixDevice::getProbabilities(const std::vector<size_t> &wires) const
+    -> std::vector<double>
+{
+    auto &&probs =
+        StateVectorKernels::getMarginalProbabilities(state.getProbabilities(), num_qubits, wires);
+
+    // The readout errors of the wires are independent bit flips of the outcomes
+    if (readout_error > 0.0) {
+        for (size_t k = 0; k < wires.size(); k++) {
+            const size_t bit = 1UL << (wires.size() - 1 - k);
+            for (size_t outcome = 0; outcome < probs.size(); outcome++) {
+                if (outcome & bit) {
+                    continue;
+                }
+                const double p0 = probs[outcome];
+                const double p1 = probs[outcome | bit];
+                probs[outcome] = (1.0 - readout_error) * p0 + readout_error * p1;
+                probs[outcome | bit] = (1.0 - readout_error) * p1 + readout_error * p0;
+            }
+        }
+    }
+    return probs;
+}
+
+void DensityMatrixDevice::Probs(DataView<double, 1> &probs)
+{
+    std::vector<size_t> wires(num_qubits);
+    std::iota(wires.begin(), wires.end(), 0);
+    auto &&dv_probs = getProbabilities(wires);
+
+    RT_FAIL_IF(probs.size() != dv_probs.size(), "Invalid size for the pre-allocated probabilities");
+    std::copy(dv_probs.begin(), dv_probs.end(), probs.begin());
+}
+
+void DensityMatrixDevice::PartialProbs(DataView<double, 1> &probs,
+                                       const std::vector<QubitIdType> &wires)
+{
+    auto &&dv_probs = getProbabilities(qubit_manager.getDeviceIds(wires));
+
+    RT_FAIL_IF(probs.size() != dv_probs.size(),
+               "Invalid size for the pre-allocated partial-probabilities");
+    std::copy(dv_probs.begin(), dv_probs.end(), probs.begin());
+}
+
+auto DensityMatrixDevice::getSamples(const std::vector<size_t> &wires) -> std::vector<size_t>
+{
+    auto &&probs = getProbabilities(wires);
+    std::discrete_distribution<size_t> distribution(probs.begin(), probs.end());
+
+    std::vector<size_t> outcomes(device_shots);
+    for (auto &outcome : outcomes) {
+        outcome = distribution(*getGenerator());
+    }
+    return outcomes;
+}
+
+void DensityMatrixDevice::Sample(DataView<double, 2> &samples)
+{
+    std::vector<QubitIdType> wires = qubit_manager.getAllQubitIds();
+    PartialSample(samples, wires);
+}
+
+void DensityMatrixDevice::PartialSample(DataView<double, 2> &samples,
+                                        const std::vector<QubitIdType> &wires)
+{
+    const size_t numWires = wires.size();
+    RT_FAIL_IF(samples.size() != device_shots * numWires,
+               "Invalid size for the pre-allocated partial-samples");
+
+    auto &&outcomes = getSamples(qubit_manager.getDeviceIds(wires));
+
+    // The first wire is the most significant bit of the basis state
+    auto it = samples.begin();
+    for (auto outcome : outcomes) {
+        for (size_t k = 0; k < numWires; k++) {
+            *it++ = static_cast<double>((outcome >> (numWires - 1 - k)) & 1U);
+        }
+    }
+}
+
+void DensityMatrixDevice::Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts)
+{
+    std::vector<QubitIdType> wires = qubit_manager.getAllQubitIds();
+    PartialCounts(eigvals, counts, wires);
+}
+
+void DensityMatrixDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                                        const std::vector<QubitIdType> &wires)
+{
+    const size_t numElements = 1UL << wires.size();
+    RT_FAIL_IF((eigvals.size() != numElements || counts.size() != numElements),
+               "Invalid size for the pre-allocated counts");
+
+    std::vector<int64_t> histogram(numElements, 0);
+    for (auto outcome : getSamples(qubit_manager.getDeviceIds(wires))) {
+        histogram[outcome]++;
+    }
+
+    std::iota(eigvals.begin(), eigvals.end(), 0);
+    std::copy(histogram.begin(), histogram.end(), counts.begin());
+}
+
+} // namespace Catalyst::Runtime::Devices
+
+GENERATE_DEVICE_FACTORY(DensityMatrixDevice, Catalyst::Runtime::Devices::DensityMatrixDevice);
@@ -0,0 +1,144 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DataView.hpp"
+#include "QuantumDevice.hpp"
+#include "QubitManager.hpp"
+#include "Types.h"
+
+#include "DensityMatrix.hpp"
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * A density-matrix simulator of noisy circuits.
+ *
+ * Gates are applied to the vectorized density matrix with the state-vector kernels (see
+ * `DensityMatrix`), and are followed by the noise channels of the device on each of their wires,
+ * controls included. The channels are composed into one single-qubit superoperator when the device
+ * is created, so the noise of a gate costs one two-wire kernel per wire.
+ *
+ * The memory is 4^n entries for n qubits, which restricts the device to small registers, e.g.
+ * for local zero-noise extrapolation studies.
+ *
+ * Device kwargs:
+ * - `depolarizing`: the probability of the depolarizing channel after every gate (0)
+ * - `amplitude_damping`: the damping parameter of the amplitude damping channel after every
+ *   gate (0)
+ * - `readout_error`: the probability that a measured bit is flipped (0)
+ * - `seed`: the seed of the device generator, used if the runtime provides none
+ */
+class DensityMatrixDevice final : public Catalyst::Runtime::QuantumDevice {
+  private:
+    using MatrixT = DensityMatrix::MatrixT;
+
+    // A product of matrices on disjoint device wires, with a coefficient
+    struct ObservableTerm {
+        double coeff;
+        std::vector<std::pair<MatrixT, std::vector<size_t>>> factors;
+    };
+
+    Catalyst::Runtime::QubitManager<QubitIdType, size_t> qubit_manager{};
+    std::unordered_map<std::string, std::string> device_kwargs;
+    size_t device_shots{0};
+    size_t num_qubits{0};
+
+    std::mt19937 *device_gen{nullptr};
+    std::mt19937 fallback_gen;
+
+    double depolarizing{0.0};
+    double amplitude_damping{0.0};
+    double readout_error{0.0};
+
+    // The superoperator of the noise after every gate, if any
+    std::optional<MatrixT> gate_noise{};
+
+    DensityMatrix state{};
+
+    // The observables, as sums of terms
+    std::vector<std::vector<ObservableTerm>> observables{};
+
+    [[nodiscard]] auto getGenerator() -> std::mt19937 *
+    {
+        return device_gen != nullptr ? device_gen : &fallback_gen;
+    }
+
+    [[nodiscard]] auto getObservable(ObsIdType obsKey) const
+        -> const std::vector<ObservableTerm> &;
+    [[nodiscard]] auto getMeasuredState() const -> DensityMatrix;
+    [[nodiscard]] auto getProbabilities(const std::vector<size_t> &wires) const
+        -> std::vector<double>;
+    [[nodiscard]] auto getSamples(const std::vector<size_t> &wires) -> std::vector<size_t>;
+    void applyMatrix(MatrixT matrix, const std::vector<QubitIdType> &wires, bool inverse,
+                     const std::vector<QubitIdType> &controlled_wires,
+                     const std::vector<bool> &controlled_values);
+
+  public:
+    explicit DensityMatrixDevice(const std::string &kwargs = "{}");
+    ~DensityMatrixDevice() override = default;
+
+    DensityMatrixDevice &operator=(const DensityMatrixDevice &) = delete;
+    DensityMatrixDevice(const DensityMatrixDevice &) = delete;
+    DensityMatrixDevice(DensityMatrixDevice &&) = delete;
+    DensityMatrixDevice &operator=(DensityMatrixDevice &&) = delete;
+
+    auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType> override;
+    void ReleaseAllQubits() override;
+    [[nodiscard]] auto GetNumQubits() const -> size_t override;
+    void SetDeviceShots(size_t shots) override;
+    [[nodiscard]] auto GetDeviceShots() const -> size_t override;
+    void SetDevicePRNG(std::mt19937 *gen) override;
+
+    void NamedOperation(const std::string &name, const std::vector<double> &params,
+                        const std::vector<QubitIdType> &wires, bool inverse = false,
+                        const std::vector<QubitIdType> &controlled_wires = {},
+                        const std::vector<bool> &controlled_values = {}) override;
+    void MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                         const std::vector<QubitIdType> &wires, bool inverse = false,
+                         const std::vector<QubitIdType> &controlled_wires = {},
+                         const std::vector<bool> &controlled_values = {}) override;
+    auto Measure(QubitIdType wire, std::optional<int32_t> postselect = std::nullopt)
+        -> Result override;
+
+    auto Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
+                    const std::vector<QubitIdType> &wires) -> ObsIdType override;
+    auto TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType override;
+    auto HamiltonianObservable(const std::vector<double> &coeffs,
+                               const std::vector<ObsIdType> &obs) -> ObsIdType override;
+    auto Expval(ObsIdType obsKey) -> double override;
+    auto Var(ObsIdType obsKey) -> double override;
+
+    void Probs(DataView<double, 1> &probs) override;
+    void PartialProbs(DataView<double, 1> &probs, const std::vector<QubitIdType> &wires) override;
+    void Sample(DataView<double, 2> &samples) override;
+    void PartialSample(DataView<double, 2> &samples,
+                       const std::vector<QubitIdType> &wires) override;
+    void Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts) override;
+    void PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                       const std::vector<QubitIdType> &wires) override;
+
+    [[nodiscard]] auto getState() const -> const DensityMatrix & { return state; }
+};
+
+} // namespace Catalyst::Runtime::Devices
@@ -0,0 +1,378 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <numbers>
+
+#include "Exception.hpp"
+#include "Utils.hpp"
+
+#include "MBQCDevice.hpp"
+
+namespace {
+using Catalyst::Runtime::Devices::MBQCDevice;
+using Catalyst::Runtime::Devices::MBQCStateVector;
+using ComplexT = MBQCStateVector::ComplexT;
+using MatrixT = MBQCStateVector::MatrixT;
+using Gate = MBQCDevice::Gate;
+
+static constexpr bool GLOBAL_RESULT_TRUE_CONST = true;
+static constexpr bool GLOBAL_RESULT_FALSE_CONST = false;
+
+auto getResult(bool outcome) -> Result
+{
+    return const_cast<Result>(outcome ? &GLOBAL_RESULT_TRUE_CONST : &GLOBAL_RESULT_FALSE_CONST);
+}
+
+auto isTwoQubitGate(Gate gate) -> bool
+{
+    return gate == Gate::CNOT || gate == Gate::CZ || gate == Gate::SWAP;
+}
+
+auto getGateMatrix(Gate gate) -> MatrixT
+{
+    const ComplexT one{1.0, 0.0};
+    const ComplexT i{0.0, 1.0};
+    const ComplexT h{1.0 / std::numbers::sqrt2, 0.0};
+
+    switch (gate) {
+    case Gate::H:
+        return {h, h, h, -h};
+    case Gate::S:
+        return {one, 0, 0, i};
+    case Gate::Sdg:
+        return {one, 0, 0, -i};
+    case Gate::X:
+        return {0, one, one, 0};
+    case Gate::Y:
+        return {0, -i, i, 0};
+    case Gate::Z:
+        return {one, 0, 0, -one};
+    case Gate::CNOT:
+        return {one, 0, 0, 0, 0, one, 0, 0, 0, 0, 0, one, 0, 0, one, 0};
+    case Gate::CZ:
+        return {one, 0, 0, 0, 0, one, 0, 0, 0, 0, one, 0, 0, 0, 0, -one};
+    case Gate::SWAP:
+        return {one, 0, 0, 0, 0, 0, one, 0, 0, one, 0, 0, 0, 0, 0, one};
+    default:
+        RT_FAIL("Invalid gate of the MBQC device");
+    }
+}
+
+/**
+ * The matrix of a rotation about the X, Y, or Z axis.
+ */
+auto getRotationMatrix(Gate axis, double angle) -> MatrixT
+{
+    const double c = std::cos(angle / 2);
+    const double s = std::sin(angle / 2);
+
+    switch (axis) {
+    case Gate::X:
+        return {ComplexT{c, 0}, ComplexT{0, -s}, ComplexT{0, -s}, ComplexT{c, 0}};
+    case Gate::Y:
+        return {ComplexT{c, 0}, ComplexT{-s, 0}, ComplexT{s, 0}, ComplexT{c, 0}};
+    case Gate::Z:
+        return {ComplexT{c, -s}, 0, 0, ComplexT{c, s}};
+    default:
+        RT_FAIL("Invalid rotation axis of the MBQC device");
+    }
+}
+} // namespace
+
+namespace Catalyst::Runtime::Devices {
+
+MBQCDevice::MBQCDevice(const std::string &kwargs)
+    : device_kwargs(Catalyst::Runtime::parse_kwargs(kwargs)), fallback_gen(std::random_device{}())
+{
+    if (auto it = device_kwargs.find("max_dense_qubits"); it != device_kwargs.end()) {
+        max_dense_qubits = std::stoul(it->second);
+        RT_FAIL_IF(max_dense_qubits == 0 || max_dense_qubits > 48,
+                   "Invalid maximum number of dense qubits");
+    }
+    if (auto it = device_kwargs.find("seed"); it != device_kwargs.end()) {
+        fallback_gen.seed(std::stoul(it->second));
+    }
+}
+
+auto MBQCDevice::AllocateQubits(size_t num_new) -> std::vector<QubitIdType>
+{
+    if (!num_new) {
+        return {};
+    }
+
+    if (isCliffordMode()) {
+        tableau.addQubits(num_new);
+    }
+    else {
+        state_vector->addQubits(num_new);
+    }
+
+    auto ids = qubit_manager.AllocateRange(num_qubits, num_new);
+    num_qubits += num_new;
+    return ids;
+}
+
+void MBQCDevice::ReleaseAllQubits()
+{
+    num_qubits = 0;
+    qubit_manager.ReleaseAll();
+    tableau = StabilizerTableau{};
+    clifford_ops.clear();
+    state_vector.reset();
+}
+
+auto MBQCDevice::GetNumQubits() const -> size_t { return num_qubits; }
+
+void MBQCDevice::SetDeviceShots(size_t shots) { device_shots = shots; }
+
+auto MBQCDevice::GetDeviceShots() const -> size_t { return device_shots; }
+
+void MBQCDevice::SetDevicePRNG(std::mt19937 *gen) { device_gen = gen; }
+
+void MBQCDevice::switchToStateVector()
+{
+    // Replay the Clifford operations, forcing the outcomes of their measurements
+    state_vector = std::make_unique<MBQCStateVector>(num_qubits, max_dense_qubits);
+    for (const auto &op : clifford_ops) {
+        if (op.gate == Gate::Measure) {
+            state_vector->collapse(op.wire0, op.outcome);
+        }
+        else {
+            state_vector->apply(getGateMatrix(op.gate), isTwoQubitGate(op.gate) ? 2 : 1, op.wire0,
+                                op.wire1);
+        }
+    }
+
+    clifford_ops.clear();
+    clifford_ops.shrink_to_fit();
+    tableau = StabilizerTableau{};
+}
+
+void MBQCDevice::applyGate(Gate gate, size_t wire0, size_t wire1)
+{
+    if (!isCliffordMode()) {
+        state_vector->apply(getGateMatrix(gate), isTwoQubitGate(gate) ? 2 : 1, wire0, wire1);
+        return;
+    }
+
+    switch (gate) {
+    case Gate::H:
+        tableau.H(wire0);
+        break;
+    case Gate::S:
+        tableau.S(wire0);
+        break;
+    case Gate::Sdg:
+        tableau.Sdg(wire0);
+        break;
+    case Gate::X:
+        tableau.X(wire0);
+        break;
+    case Gate::Y:
+        tableau.Y(wire0);
+        break;
+    case Gate::Z:
+        tableau.Z(wire0);
+        break;
+    case Gate::CNOT:
+        tableau.CNOT(wire0, wire1);
+        break;
+    case Gate::CZ:
+        tableau.CZ(wire0, wire1);
+        break;
+    case Gate::SWAP:
+        tableau.SWAP(wire0, wire1);
+        break;
+    default:
+        RT_FAIL("Invalid gate of the MBQC device");
+    }
+    clifford_ops.push_back({gate, wire0, wire1, false});
+}
+
+void MBQCDevice::applyMatrix(const MatrixT &matrix, size_t num_wires, size_t wire0, size_t wire1)
+{
+    if (isCliffordMode()) {
+        switchToStateVector();
+    }
+    state_vector->apply(matrix, num_wires, wire0, wire1);
+}
+
+/**
+ * Apply a rotation of `power` quarter turns about the X, Y, or Z axis, up to a global phase.
+ */
+void MBQCDevice::applyCliffordRotation(Gate axis, int power, size_t wire)
+{
+    // RX = H RZ H, and RY = S RX S^dagger
+    if (axis == Gate::Y) {
+        applyGate(Gate::Sdg, wire);
+    }
+    if (axis != Gate::Z) {
+        applyGate(Gate::H, wire);
+    }
+    for (int k = 0; k < power; k++) {
+        applyGate(Gate::S, wire);
+    }
+    if (axis != Gate::Z) {
+        applyGate(Gate::H, wire);
+    }
+    if (axis == Gate::Y) {
+        applyGate(Gate::S, wire);
+    }
+}
+
+void MBQCDevice::applyRotation(Gate axis, double angle, size_t wire)
+{
+    if (auto power = getCliffordPower(angle); power.has_value() && isCliffordMode()) {
+        applyCliffordRotation(axis, power.value(), wire);
+        return;
+    }
+    applyMatrix(getRotationMatrix(axis, angle), 1, wire);
+}
+
+void MBQCDevice::NamedOperation(const std::string &name, const std::vector<double> &params,
+                                const std::vector<QubitIdType> &wires, bool inverse,
+                                const std::vector<QubitIdType> &controlled_wires,
+                                [[maybe_unused]] const std::vector<bool> &controlled_values)
+{
+    RT_FAIL_IF(!controlled_wires.empty(), "MBQCDevice does not support controlled operations");
+
+    static const std::unordered_map<std::string, Gate> clifford_gates = {
+        {"Hadamard", Gate::H}, {"S", Gate::S},       {"PauliX", Gate::X},
+        {"PauliY", Gate::Y},   {"PauliZ", Gate::Z},  {"CNOT", Gate::CNOT},
+        {"CZ", Gate::CZ},      {"SWAP", Gate::SWAP},
+    };
+
+    // The device wires are the positions of the qubits in the tableau or state vector
+    const auto &&dev_wires = qubit_manager.getDeviceIds(wires);
+
+    if (name == "Identity") {
+        return;
+    }
+
+    if (auto it = clifford_gates.find(name); it != clifford_gates.end()) {
+        Gate gate = it->second;
+        RT_FAIL_IF(dev_wires.size() != (isTwoQubitGate(gate) ? 2 : 1), "Invalid number of wires");
+        if (gate == Gate::S && inverse) {
+            gate = Gate::Sdg;
+        }
+        applyGate(gate, dev_wires[0], isTwoQubitGate(gate) ? dev_wires[1] : 0);
+        return;
+    }
+
+    // Rotations, up to a global phase
+    static const std::unordered_map<std::string, Gate> rotation_gates = {
+        {"RX", Gate::X}, {"RY", Gate::Y}, {"RZ", Gate::Z}, {"PhaseShift", Gate::Z}, {"T", Gate::Z}};
+
+    auto it = rotation_gates.find(name);
+    RT_FAIL_IF(it == rotation_gates.end(), "Unsupported gate by MBQCDevice");
+    RT_FAIL_IF(dev_wires.size() != 1, "Invalid number of wires");
+
+    double angle = std::numbers::pi / 4;
+    if (name != "T") {
+        RT_FAIL_IF(params.size() != 1, "Invalid number of parameters");
+        angle = params[0];
+    }
+    applyRotation(it->second, inverse ? -angle : angle, dev_wires[0]);
+}
+
+void MBQCDevice::MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                                 const std::vector<QubitIdType> &wires, bool inverse,
+                                 const std::vector<QubitIdType> &controlled_wires,
+                                 [[maybe_unused]] const std::vector<bool> &controlled_values)
+{
+    RT_FAIL_IF(!controlled_wires.empty(), "MBQCDevice does not support controlled operations");
+    RT_FAIL_IF(wires.empty() || wires.size() > 2,
+               "MBQCDevice only supports one- and two-qubit matrices");
+
+    const size_t dim = size_t{1} << wires.size();
+    RT_FAIL_IF(matrix.size() != dim * dim, "Invalid size of the matrix");
+
+    MatrixT mat{};
+    for (size_t row = 0; row < dim; row++) {
+        for (size_t col = 0; col < dim; col++) {
+            mat[row * dim + col] =
+                inverse ? std::conj(matrix[col * dim + row]) : matrix[row * dim + col];
+        }
+    }
+
+    const auto &&dev_wires = qubit_manager.getDeviceIds(wires);
+    applyMatrix(mat, wires.size(), dev_wires[0], wires.size() == 2 ? dev_wires[1] : 0);
+}
+
+auto MBQCDevice::measureWire(size_t wire, std::optional<int32_t> postselect) -> bool
+{
+    using Catalyst::Runtime::Simulator::Lightning::simulateDraw;
+
+    if (!isCliffordMode()) {
+        const std::array<double, 2> probs = state_vector->getProbabilities(wire);
+        const bool outcome = simulateDraw({probs[0], probs[1]}, postselect, getGenerator());
+        state_vector->collapse(wire, outcome);
+        return outcome;
+    }
+
+    // The outcome is drawn beforehand, and only used if the measurement is random
+    const bool draw = simulateDraw({0.5, 0.5}, postselect, getGenerator());
+    auto [outcome, random] = tableau.Measure(wire, draw);
+    RT_FAIL_IF(!random && postselect.has_value() && outcome != (postselect.value() == 1),
+               "Probability of postselect value is 0");
+
+    clifford_ops.push_back({Gate::Measure, wire, 0, outcome});
+    return outcome;
+}
+
+auto MBQCDevice::Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result
+{
+    return getResult(measureWire(qubit_manager.getDeviceId(wire), postselect));
+}
+
+/**
+ * The measurement is a computational-basis measurement after a change of basis U, which maps the
+ * state |+_angle> of the basis to |0>, followed by the inverse change of basis:
+ * - XY: |+_angle> = (|0> + e^{i angle}|1>) / sqrt(2), and U = H RZ(-angle)
+ * - YZ: |+_angle> = cos(angle/2)|0> + i sin(angle/2)|1>, and U = RX(angle)
+ * - ZX: |+_angle> = cos(angle/2)|0> + sin(angle/2)|1>, and U = RY(-angle)
+ */
+auto MBQCDevice::MeasureInBasis(QubitIdType wire, uint32_t plane, double angle,
+                                std::optional<int32_t> postselect) -> Result
+{
+    RT_FAIL_IF(plane > 2, "Invalid plane of the measurement basis");
+
+    const size_t dev_wire = qubit_manager.getDeviceId(wire);
+    bool outcome = false;
+    switch (plane) {
+    case 0:
+        applyRotation(Gate::Z, -angle, dev_wire);
+        applyGate(Gate::H, dev_wire);
+        outcome = measureWire(dev_wire, postselect);
+        applyGate(Gate::H, dev_wire);
+        applyRotation(Gate::Z, angle, dev_wire);
+        break;
+    case 1:
+        applyRotation(Gate::X, angle, dev_wire);
+        outcome = measureWire(dev_wire, postselect);
+        applyRotation(Gate::X, -angle, dev_wire);
+        break;
+    default:
+        applyRotation(Gate::Y, -angle, dev_wire);
+        outcome = measureWire(dev_wire, postselect);
+        applyRotation(Gate::Y, angle, dev_wire);
+        break;
+    }
+    return getResult(outcome);
+}
+
+} // namespace Catalyst::Runtime::Devices
+
+GENERATE_DEVICE_FACTORY(MBQCDevice, Catalyst::Runtime::Devices::MBQCDevice);
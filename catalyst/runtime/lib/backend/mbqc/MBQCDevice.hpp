@@ -0,0 +1,134 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "QuantumDevice.hpp"
+#include "QubitManager.hpp"
+#include "StabilizerTableau.hpp"
+#include "Types.h"
+
+#include "MBQCStateVector.hpp"
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * A simulator of measurement-based quantum computations.
+ *
+ * The device starts in the Clifford mode, in which graph states and Pauli or Clifford-angle
+ * measurements are simulated on a stabilizer tableau in polynomial time. The first non-Clifford
+ * gate or measurement angle switches the device to a lazy state-vector simulation
+ * (`MBQCStateVector`): the Clifford operations and measurement outcomes so far are replayed,
+ * and the following operations are only applied when a measurement depends on them. Patterns
+ * that are measured in a sequential order keep a small dense register whatever their size.
+ *
+ * Device kwargs:
+ * - `max_dense_qubits`: the maximum number of entangled qubits of the state-vector mode (24)
+ * - `seed`: the seed of the device generator, used if the runtime provides none
+ */
+class MBQCDevice final : public Catalyst::Runtime::QuantumDevice {
+  public:
+    enum class Gate : uint8_t { H, S, Sdg, X, Y, Z, CNOT, CZ, SWAP, Measure };
+
+  private:
+    static constexpr size_t default_max_dense_qubits = 24;
+
+    // An operation of the Clifford mode, and the outcome of a measurement
+    struct CliffordOp {
+        Gate gate;
+        size_t wire0;
+        size_t wire1;
+        bool outcome;
+    };
+
+    Catalyst::Runtime::QubitManager<QubitIdType, size_t> qubit_manager{};
+    std::unordered_map<std::string, std::string> device_kwargs;
+    size_t device_shots{0};
+    size_t num_qubits{0};
+
+    std::mt19937 *device_gen{nullptr};
+    std::mt19937 fallback_gen;
+
+    size_t max_dense_qubits{default_max_dense_qubits};
+
+    StabilizerTableau tableau{};
+    std::vector<CliffordOp> clifford_ops{};
+    std::unique_ptr<MBQCStateVector> state_vector{};
+
+    [[nodiscard]] auto getGenerator() -> std::mt19937 *
+    {
+        return device_gen != nullptr ? device_gen : &fallback_gen;
+    }
+
+    void switchToStateVector();
+    void applyGate(Gate gate, size_t wire0, size_t wire1 = 0);
+    void applyMatrix(const MBQCStateVector::MatrixT &matrix, size_t num_wires, size_t wire0,
+                     size_t wire1 = 0);
+    void applyCliffordRotation(Gate axis, int power, size_t wire);
+    void applyRotation(Gate axis, double angle, size_t wire);
+    [[nodiscard]] auto measureWire(size_t wire, std::optional<int32_t> postselect) -> bool;
+
+  public:
+    explicit MBQCDevice(const std::string &kwargs = "{}");
+    ~MBQCDevice() override = default;
+
+    MBQCDevice &operator=(const MBQCDevice &) = delete;
+    MBQCDevice(const MBQCDevice &) = delete;
+    MBQCDevice(MBQCDevice &&) = delete;
+    MBQCDevice &operator=(MBQCDevice &&) = delete;
+
+    auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType> override;
+    void ReleaseAllQubits() override;
+    [[nodiscard]] auto GetNumQubits() const -> size_t override;
+    void SetDeviceShots(size_t shots) override;
+    [[nodiscard]] auto GetDeviceShots() const -> size_t override;
+    void SetDevicePRNG(std::mt19937 *gen) override;
+
+    void NamedOperation(const std::string &name, const std::vector<double> &params,
+                        const std::vector<QubitIdType> &wires, bool inverse = false,
+                        const std::vector<QubitIdType> &controlled_wires = {},
+                        const std::vector<bool> &controlled_values = {}) override;
+    void MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                         const std::vector<QubitIdType> &wires, bool inverse = false,
+                         const std::vector<QubitIdType> &controlled_wires = {},
+                         const std::vector<bool> &controlled_values = {}) override;
+
+    auto Measure(QubitIdType wire, std::optional<int32_t> postselect = std::nullopt)
+        -> Result override;
+    auto MeasureInBasis(QubitIdType wire, uint32_t plane, double angle,
+                        std::optional<int32_t> postselect = std::nullopt) -> Result override;
+
+    [[nodiscard]] auto isCliffordMode() const -> bool { return state_vector == nullptr; }
+    [[nodiscard]] auto getMaxDenseQubits() const -> size_t { return max_dense_qubits; }
+
+    /**
+     * Get the largest number of qubits of the dense register since the device entered the
+     * state-vector mode, or 0 in the Clifford mode.
+     */
+    [[nodiscard]] auto getPeakDenseQubits() const -> size_t
+    {
+        return state_vector ? state_vector->getPeakDenseQubits() : 0;
+    }
+};
+
+} // namespace Catalyst::Runtime::Devices
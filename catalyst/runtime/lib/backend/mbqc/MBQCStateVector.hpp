@@ -0,0 +1,358 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <vector>
+
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * A lazy state-vector simulator of measurement patterns.
+ *
+ * The operations are recorded, and only applied when a measurement depends on them: measuring a
+ * qubit applies the pending operations of its past light cone. Qubits that are not entangled with
+ * others are kept as single-qubit states, and measured qubits are projected out of the dense
+ * register. A pattern that entangles, measures, and discards its qubits in a sequential order
+ * thus only ever holds a few qubits in the dense register, however many qubits it has.
+ *
+ * Diagonal operations commute with one another and with computational-basis measurements, so
+ * they stay pending until a non-diagonal operation on one of their qubits needs them. In
+ * particular, the CZ entanglers of a graph state are applied one at a time as its qubits are
+ * measured, and a CZ on a measured qubit reduces to a Z correction on the other one.
+ *
+ * @param num_qubits The number of qubits, initialized in |0>
+ * @param max_dense_qubits The maximum number of qubits of the dense register
+ */
+class MBQCStateVector {
+  public:
+    using ComplexT = std::complex<double>;
+
+    // A one- or two-qubit matrix in row-major order, where the first qubit is the most
+    // significant one
+    using MatrixT = std::array<ComplexT, 16>;
+
+  private:
+    static constexpr size_t not_dense = std::numeric_limits<size_t>::max();
+    static constexpr double zero_tol = 1e-24;
+
+    struct Operation {
+        std::array<size_t, 2> qubits;
+        size_t num_qubits;
+        bool diagonal;
+        MatrixT matrix;
+    };
+
+    std::vector<Operation> operations{};
+
+    // The pending operations of each qubit, in program order
+    std::vector<std::deque<size_t>> pending{};
+
+    // The states of the qubits out of the dense register
+    std::vector<std::array<ComplexT, 2>> local{};
+
+    // The bit of each qubit in the dense register, and the qubit of each bit
+    std::vector<size_t> position{};
+    std::vector<size_t> dense_qubits{};
+    std::vector<ComplexT> amplitudes{ComplexT{1.0, 0.0}};
+
+    size_t max_dense_qubits;
+    size_t peak_dense_qubits{0};
+
+    [[nodiscard]] static auto isDiagonal(const MatrixT &matrix, size_t dim) -> bool
+    {
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                if (row != col && std::norm(matrix[row * dim + col]) > zero_tol) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Return the computational basis state of a qubit out of the dense register, if any.
+     */
+    [[nodiscard]] auto getBasisState(size_t qubit) const -> int
+    {
+        if (position[qubit] != not_dense) {
+            return -1;
+        }
+        if (std::norm(local[qubit][1]) <= zero_tol) {
+            return 0;
+        }
+        if (std::norm(local[qubit][0]) <= zero_tol) {
+            return 1;
+        }
+        return -1;
+    }
+
+    /**
+     * Apply the pending operations of a qubit that precede the operation `limit`. If `limit` is
+     * diagonal, the pending diagonal operations after the last non-diagonal one commute with it
+     * and are left pending.
+     */
+    void flush(size_t qubit, size_t limit, bool diagonal)
+    {
+        const auto &queue = pending[qubit];
+
+        size_t last = not_dense;
+        for (size_t index : queue) {
+            if (index >= limit) {
+                break;
+            }
+            if (!diagonal || !operations[index].diagonal) {
+                last = index;
+            }
+        }
+        if (last == not_dense) {
+            return;
+        }
+
+        while (!queue.empty() && queue.front() <= last) {
+            applyOperation(queue.front());
+        }
+    }
+
+    void applyOperation(size_t index)
+    {
+        const Operation &op = operations[index];
+        for (size_t k = 0; k < op.num_qubits; k++) {
+            flush(op.qubits[k], index, op.diagonal);
+        }
+        for (size_t k = 0; k < op.num_qubits; k++) {
+            auto &queue = pending[op.qubits[k]];
+            queue.erase(std::find(queue.begin(), queue.end(), index));
+        }
+
+        if (op.num_qubits == 1) {
+            applyMatrix1(op.matrix, op.qubits[0]);
+        }
+        else {
+            applyMatrix2(op.matrix, op.qubits[0], op.qubits[1]);
+        }
+    }
+
+    void applyMatrix1(const MatrixT &m, size_t qubit)
+    {
+        const size_t pos = position[qubit];
+        if (pos == not_dense) {
+            auto &state = local[qubit];
+            state = {m[0] * state[0] + m[1] * state[1], m[2] * state[0] + m[3] * state[1]};
+            return;
+        }
+
+        const size_t bit = size_t{1} << pos;
+        for (size_t i = 0; i < amplitudes.size(); i++) {
+            if (i & bit) {
+                continue;
+            }
+            const ComplexT v0 = amplitudes[i];
+            const ComplexT v1 = amplitudes[i | bit];
+            amplitudes[i] = m[0] * v0 + m[1] * v1;
+            amplitudes[i | bit] = m[2] * v0 + m[3] * v1;
+        }
+    }
+
+    void applyMatrix2(const MatrixT &m, size_t qubit0, size_t qubit1)
+    {
+        // A two-qubit operation that preserves the basis state of one of its qubits reduces to a
+        // single-qubit operation on the other one, e.g. a CZ on a measured qubit.
+        for (size_t k = 0; k < 2; k++) {
+            const int basis = getBasisState(k == 0 ? qubit0 : qubit1);
+            if (basis < 0) {
+                continue;
+            }
+
+            // The row-major index of the entry (row, col) of the sub-matrix of the other qubit,
+            // where the `k`-th qubit is in the basis state `b`
+            auto entry = [k](size_t b_row, size_t row, size_t b_col, size_t col) {
+                return k == 0 ? (2 * b_row + row) * 4 + (2 * b_col + col)
+                              : (2 * row + b_row) * 4 + (2 * col + b_col);
+            };
+
+            const size_t b = static_cast<size_t>(basis);
+            bool preserved = true;
+            for (size_t row = 0; row < 2 && preserved; row++) {
+                for (size_t col = 0; col < 2; col++) {
+                    if (std::norm(m[entry(1 - b, row, b, col)]) > zero_tol) {
+                        preserved = false;
+                        break;
+                    }
+                }
+            }
+            if (preserved) {
+                const MatrixT reduced = {m[entry(b, 0, b, 0)], m[entry(b, 0, b, 1)],
+                                         m[entry(b, 1, b, 0)], m[entry(b, 1, b, 1)]};
+                applyMatrix1(reduced, k == 0 ? qubit1 : qubit0);
+                return;
+            }
+        }
+
+        makeDense(qubit0);
+        makeDense(qubit1);
+
+        const size_t bit0 = size_t{1} << position[qubit0];
+        const size_t bit1 = size_t{1} << position[qubit1];
+        for (size_t i = 0; i < amplitudes.size(); i++) {
+            if (i & (bit0 | bit1)) {
+                continue;
+            }
+            const std::array<size_t, 4> idx = {i, i | bit1, i | bit0, i | bit0 | bit1};
+            const std::array<ComplexT, 4> v = {amplitudes[idx[0]], amplitudes[idx[1]],
+                                               amplitudes[idx[2]], amplitudes[idx[3]]};
+            for (size_t row = 0; row < 4; row++) {
+                amplitudes[idx[row]] = m[row * 4] * v[0] + m[row * 4 + 1] * v[1] +
+                                       m[row * 4 + 2] * v[2] + m[row * 4 + 3] * v[3];
+            }
+        }
+    }
+
+    /**
+     * Move a qubit into the dense register, as its most significant bit.
+     */
+    void makeDense(size_t qubit)
+    {
+        if (position[qubit] != not_dense) {
+            return;
+        }
+        RT_FAIL_IF(dense_qubits.size() >= max_dense_qubits,
+                   "The measurement pattern entangles more qubits than the maximum number of "
+                   "dense qubits of the device");
+
+        const size_t size = amplitudes.size();
+        amplitudes.resize(2 * size);
+        for (size_t i = 0; i < size; i++) {
+            amplitudes[size + i] = amplitudes[i] * local[qubit][1];
+            amplitudes[i] *= local[qubit][0];
+        }
+
+        position[qubit] = dense_qubits.size();
+        dense_qubits.push_back(qubit);
+        peak_dense_qubits = std::max(peak_dense_qubits, dense_qubits.size());
+    }
+
+  public:
+    explicit MBQCStateVector(size_t num_qubits, size_t _max_dense_qubits)
+        : max_dense_qubits(_max_dense_qubits)
+    {
+        addQubits(num_qubits);
+    }
+    ~MBQCStateVector() = default;
+
+    MBQCStateVector(const MBQCStateVector &) = delete;
+    MBQCStateVector &operator=(const MBQCStateVector &) = delete;
+    MBQCStateVector(MBQCStateVector &&) = default;
+    MBQCStateVector &operator=(MBQCStateVector &&) = default;
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return local.size(); }
+    [[nodiscard]] auto getNumDenseQubits() const -> size_t { return dense_qubits.size(); }
+    [[nodiscard]] auto getPeakDenseQubits() const -> size_t { return peak_dense_qubits; }
+
+    /**
+     * Add `count` qubits in the |0> state.
+     */
+    void addQubits(size_t count)
+    {
+        const size_t num_qubits = local.size() + count;
+        pending.resize(num_qubits);
+        local.resize(num_qubits, {ComplexT{1.0, 0.0}, ComplexT{0.0, 0.0}});
+        position.resize(num_qubits, not_dense);
+    }
+
+    /**
+     * Record a one-qubit (`qubit1` is ignored) or two-qubit operation.
+     */
+    void apply(const MatrixT &matrix, size_t num_qubits, size_t qubit0, size_t qubit1 = 0)
+    {
+        RT_FAIL_IF(num_qubits != 1 && num_qubits != 2, "Invalid number of wires");
+        RT_FAIL_IF(num_qubits == 2 && qubit0 == qubit1, "Invalid wires of a two-qubit gate");
+
+        const size_t index = operations.size();
+        operations.push_back({{qubit0, qubit1}, num_qubits, isDiagonal(matrix, 2 * num_qubits),
+                              matrix});
+        pending[qubit0].push_back(index);
+        if (num_qubits == 2) {
+            pending[qubit1].push_back(index);
+        }
+    }
+
+    /**
+     * Get the probabilities of the outcomes of a computational-basis measurement of a qubit.
+     */
+    [[nodiscard]] auto getProbabilities(size_t qubit) -> std::array<double, 2>
+    {
+        flush(qubit, operations.size(), true);
+
+        std::array<double, 2> probs{0.0, 0.0};
+        const size_t pos = position[qubit];
+        if (pos == not_dense) {
+            probs = {std::norm(local[qubit][0]), std::norm(local[qubit][1])};
+        }
+        else {
+            const size_t bit = size_t{1} << pos;
+            for (size_t i = 0; i < amplitudes.size(); i++) {
+                probs[(i & bit) ? 1 : 0] += std::norm(amplitudes[i]);
+            }
+        }
+
+        const double norm = probs[0] + probs[1];
+        return {probs[0] / norm, probs[1] / norm};
+    }
+
+    /**
+     * Project a qubit on the computational basis state `outcome`, and move it out of the dense
+     * register.
+     */
+    void collapse(size_t qubit, bool outcome)
+    {
+        const std::array<double, 2> probs = getProbabilities(qubit);
+        RT_FAIL_IF(probs[outcome] <= zero_tol, "Probability of postselect value is 0");
+
+        const size_t pos = position[qubit];
+        local[qubit] = outcome ? std::array{ComplexT{0.0, 0.0}, ComplexT{1.0, 0.0}}
+                               : std::array{ComplexT{1.0, 0.0}, ComplexT{0.0, 0.0}};
+        if (pos == not_dense) {
+            return;
+        }
+
+        // Remove the bit of the qubit from the indices of the amplitudes
+        const size_t low = (size_t{1} << pos) - 1;
+        const size_t bit = outcome ? (size_t{1} << pos) : 0;
+        const double scale = 1.0 / std::sqrt(probs[outcome]);
+        const size_t size = amplitudes.size() / 2;
+        for (size_t j = 0; j < size; j++) {
+            amplitudes[j] = amplitudes[((j & ~low) << 1) | bit | (j & low)] * scale;
+        }
+        amplitudes.resize(size);
+
+        dense_qubits.erase(dense_qubits.begin() + static_cast<std::ptrdiff_t>(pos));
+        position[qubit] = not_dense;
+        for (size_t k = pos; k < dense_qubits.size(); k++) {
+            position[dense_qubits[k]] = k;
+        }
+    }
+};
+
+} // namespace Catalyst::Runtime::Devices
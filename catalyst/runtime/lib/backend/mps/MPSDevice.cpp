@@ -0,0 +1,296 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <numeric>
+#include <unordered_set>
+
+#include "Exception.hpp"
+#include "GateMatrices.hpp"
+#include "Utils.hpp"
+
+#include "MPSDevice.hpp"
+
+namespace {
+using Catalyst::Runtime::Devices::MPSState;
+using MatrixT = MPSState::MatrixT;
+
+static constexpr bool GLOBAL_RESULT_TRUE_CONST = true;
+static constexpr bool GLOBAL_RESULT_FALSE_CONST = false;
+} // namespace
+
+namespace Catalyst::Runtime::Devices {
+
+MPSDevice::MPSDevice(const std::string &kwargs)
+    : device_kwargs(Catalyst::Runtime::parse_kwargs(kwargs)), fallback_gen(std::random_device{}())
+{
+    if (auto it = device_kwargs.find("max_bond_dim"); it != device_kwargs.end()) {
+        max_bond_dim = std::stoul(it->second);
+        RT_FAIL_IF(max_bond_dim == 0, "Invalid maximum bond dimension");
+    }
+    if (auto it = device_kwargs.find("cutoff"); it != device_kwargs.end()) {
+        cutoff = std::stod(it->second);
+        RT_FAIL_IF(cutoff < 0 || cutoff >= 1, "Invalid truncation cutoff");
+    }
+    if (auto it = device_kwargs.find("seed"); it != device_kwargs.end()) {
+        fallback_gen.seed(std::stoul(it->second));
+    }
+    if (auto it = device_kwargs.find("lapack_library"); it != device_kwargs.end()) {
+        lapack = MPS::loadLapackSVD(it->second);
+        RT_FAIL_IF(!lapack, "Unable to load zgesdd from the LAPACK library of the MPS device");
+    }
+    state = MPSState(max_bond_dim, cutoff, lapack);
+}
+
+auto MPSDevice::AllocateQubits(size_t num_new) -> std::vector<QubitIdType>
+{
+    if (!num_new) {
+        return {};
+    }
+
+    state.addQubits(num_new);
+    auto ids = qubit_manager.AllocateRange(num_qubits, num_new);
+    num_qubits += num_new;
+    return ids;
+}
+
+void MPSDevice::ReleaseAllQubits()
+{
+    num_qubits = 0;
+    qubit_manager.ReleaseAll();
+    state = MPSState(max_bond_dim, cutoff, lapack);
+    observables.clear();
+}
+
+auto MPSDevice::GetNumQubits() const -> size_t { return num_qubits; }
+
+void MPSDevice::SetDeviceShots(size_t shots) { device_shots = shots; }
+
+auto MPSDevice::GetDeviceShots() const -> size_t { return device_shots; }
+
+void MPSDevice::SetDevicePRNG(std::mt19937 *gen) { device_gen = gen; }
+
+void MPSDevice::applyMatrix(MatrixT matrix, const std::vector<QubitIdType> &wires, bool inverse,
+                            const std::vector<QubitIdType> &controlled_wires,
+                            const std::vector<bool> &controlled_values)
+{
+    RT_FAIL_IF(controlled_wires.size() != controlled_values.size(),
+               "Invalid number of control values");
+    RT_FAIL_IF(wires.empty() || wires.size() + controlled_wires.size() > 2,
+               "MPSDevice only supports operations on one or two wires");
+
+    const size_t dim = 1UL << wires.size();
+    RT_FAIL_IF(matrix.size() != dim * dim, "Invalid size of the matrix");
+
+    if (inverse) {
+        matrix = GateMatrices::getAdjointMatrix(matrix);
+    }
+
+    if (!controlled_wires.empty()) {
+        matrix = GateMatrices::getControlledMatrix(matrix, 1, controlled_values);
+        state.apply(matrix, 2, qubit_manager.getDeviceId(controlled_wires[0]),
+                    qubit_manager.getDeviceId(wires[0]));
+        return;
+    }
+
+    const auto &&dev_wires = qubit_manager.getDeviceIds(wires);
+    state.apply(matrix, dev_wires.size(), dev_wires[0], dev_wires.size() > 1 ? dev_wires[1] : 0);
+}
+
+void MPSDevice::NamedOperation(const std::string &name, const std::vector<double> &params,
+                               const std::vector<QubitIdType> &wires, bool inverse,
+                               const std::vector<QubitIdType> &controlled_wires,
+                               const std::vector<bool> &controlled_values)
+{
+    auto &&[matrix, num_wires] = GateMatrices::getGateMatrix(name, params);
+    RT_FAIL_IF(wires.size() != num_wires, "Invalid number of wires");
+
+    if (name == "Identity" && controlled_wires.empty()) {
+        return;
+    }
+    applyMatrix(std::move(matrix), wires, inverse, controlled_wires, controlled_values);
+}
+
+void MPSDevice::MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                                const std::vector<QubitIdType> &wires, bool inverse,
+                                const std::vector<QubitIdType> &controlled_wires,
+                                const std::vector<bool> &controlled_values)
+{
+    applyMatrix(MatrixT(matrix.begin(), matrix.end()), wires, inverse, controlled_wires,
+                controlled_values);
+}
+
+auto MPSDevice::Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result
+{
+    using Catalyst::Runtime::Simulator::Lightning::simulateDraw;
+
+    const size_t dev_wire = qubit_manager.getDeviceId(wire);
+    const bool outcome = simulateDraw(state.getProbabilities(dev_wire), postselect, getGenerator());
+    state.collapse(dev_wire, outcome);
+
+    return const_cast<Result>(outcome ? &GLOBAL_RESULT_TRUE_CONST : &GLOBAL_RESULT_FALSE_CONST);
+}
+
+auto MPSDevice::Observable(ObsId id,
+                           [[maybe_unused]] const std::vector<std::complex<double>> &matrix,
+                           const std::vector<QubitIdType> &wires) -> ObsIdType
+{
+    RT_FAIL_IF(id == ObsId::Hadamard || id == ObsId::Hermitian,
+               "MPSDevice only supports Pauli observables");
+    RT_FAIL_IF(wires.size() != 1, "Invalid number of wires");
+
+    PauliTerm term{1.0, {}, {}};
+    if (id != ObsId::Identity) {
+        term.wires.push_back(qubit_manager.getDeviceId(wires[0]));
+        term.paulis.push_back(id == ObsId::PauliX ? 'X' : (id == ObsId::PauliY ? 'Y' : 'Z'));
+    }
+    observables.push_back({std::move(term)});
+    return static_cast<ObsIdType>(observables.size() - 1);
+}
+
+auto MPSDevice::TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType
+{
+    PauliTerm product{1.0, {}, {}};
+    std::unordered_set<size_t> wires;
+    for (auto key : obs) {
+        const auto &terms = getObservable(key);
+        RT_FAIL_IF(terms.size() != 1, "Invalid tensor product of a Hamiltonian observable");
+
+        const auto &term = terms[0];
+        product.coeff *= term.coeff;
+        for (size_t k = 0; k < term.wires.size(); k++) {
+            RT_FAIL_IF(!wires.insert(term.wires[k]).second,
+                       "Invalid tensor product of observables sharing wires");
+            product.wires.push_back(term.wires[k]);
+            product.paulis.push_back(term.paulis[k]);
+        }
+    }
+    observables.push_back({std::move(product)});
+    return static_cast<ObsIdType>(observables.size() - 1);
+}
+
+auto MPSDevice::HamiltonianObservable(const std::vector<double> &coeffs,
+                                      const std::vector<ObsIdType> &obs) -> ObsIdType
+{
+    RT_FAIL_IF(coeffs.size() != obs.size(), "Incompatible list of observables and coefficients");
+
+    std::vector<PauliTerm> sum;
+    for (size_t idx = 0; idx < obs.size(); idx++) {
+        for (auto term : getObservable(obs[idx])) {
+            term.coeff *= coeffs[idx];
+            sum.push_back(std::move(term));
+        }
+    }
+    observables.push_back(std::move(sum));
+    return static_cast<ObsIdType>(observables.size() - 1);
+}
+
+auto MPSDevice::getObservable(ObsIdType obsKey) const -> const std::vector<PauliTerm> &
+{
+    RT_FAIL_IF(obsKey < 0 || static_cast<size_t>(obsKey) >= observables.size(),
+               "Invalid key for cached observables");
+    return observables[obsKey];
+}
+
+auto MPSDevice::Expval(ObsIdType obsKey) -> double
+{
+    double expval{0.0};
+    for (const auto &term : getObservable(obsKey)) {
+        expval += term.coeff * state.ExpectationValue(term.wires, term.paulis);
+    }
+    return expval;
+}
+
+auto MPSDevice::Var(ObsIdType obsKey) -> double
+{
+    const auto &terms = getObservable(obsKey);
+    RT_FAIL_IF(terms.size() != 1, "Unsupported observable: Hamiltonian");
+
+    // Pauli words square to the identity
+    const auto &term = terms[0];
+    const double expval = state.ExpectationValue(term.wires, term.paulis);
+    return term.coeff * term.coeff * (1.0 - expval * expval);
+}
+
+void MPSDevice::State(DataView<std::complex<double>, 1> &state_view)
+{
+    RT_FAIL_IF(num_qubits >= 64, "Unable to return the state of 64 qubits or more");
+    RT_FAIL_IF(state_view.size() != (1UL << num_qubits),
+               "Invalid size for the pre-allocated state vector");
+
+    auto &&amplitudes = state.getAmplitudes();
+    std::copy(amplitudes.begin(), amplitudes.end(), state_view.begin());
+}
+
+auto MPSDevice::getSamples(const std::vector<size_t> &wires) -> std::vector<uint8_t>
+{
+    return state.Sample(wires, device_shots, *getGenerator());
+}
+
+void MPSDevice::Sample(DataView<double, 2> &samples)
+{
+    RT_FAIL_IF(samples.size() != device_shots * num_qubits,
+               "Invalid size for the pre-allocated samples");
+
+    std::vector<size_t> wires(num_qubits);
+    std::iota(wires.begin(), wires.end(), 0);
+    auto &&bits = getSamples(wires);
+    std::transform(bits.begin(), bits.end(), samples.begin(),
+                   [](uint8_t bit) { return static_cast<double>(bit); });
+}
+
+void MPSDevice::PartialSample(DataView<double, 2> &samples, const std::vector<QubitIdType> &wires)
+{
+    RT_FAIL_IF(samples.size() != device_shots * wires.size(),
+               "Invalid size for the pre-allocated partial-samples");
+
+    auto &&bits = getSamples(qubit_manager.getDeviceIds(wires));
+    std::transform(bits.begin(), bits.end(), samples.begin(),
+                   [](uint8_t bit) { return static_cast<double>(bit); });
+}
+
+void MPSDevice::Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts)
+{
+    std::vector<QubitIdType> wires = qubit_manager.getAllQubitIds();
+    PartialCounts(eigvals, counts, wires);
+}
+
+void MPSDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                              const std::vector<QubitIdType> &wires)
+{
+    const size_t numWires = wires.size();
+    RT_FAIL_IF(numWires >= 64, "Unable to return the counts of 64 qubits or more");
+
+    const size_t numElements = 1UL << numWires;
+    RT_FAIL_IF((eigvals.size() != numElements || counts.size() != numElements),
+               "Invalid size for the pre-allocated counts");
+
+    auto &&bits = getSamples(qubit_manager.getDeviceIds(wires));
+
+    // The first wire is the most significant bit of the basis state
+    std::vector<int64_t> histogram(numElements, 0);
+    for (size_t shot = 0; shot < device_shots; shot++) {
+        size_t index = 0;
+        for (size_t k = 0; k < numWires; k++) {
+            index = (index << 1) | bits[shot * numWires + k];
+        }
+        histogram[index]++;
+    }
+
+    std::iota(eigvals.begin(), eigvals.end(), 0);
+    std::copy(histogram.begin(), histogram.end(), counts.begin());
+}
+
+} // namespace Catalyst::Runtime::Devices
+
+GENERATE_DEVICE_FACTORY(MPSDevice, Catalyst::Runtime::Devices::MPSDevice);
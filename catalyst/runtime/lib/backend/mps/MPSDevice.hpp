@@ -0,0 +1,143 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DataView.hpp"
+#include "QuantumDevice.hpp"
+#include "QubitManager.hpp"
+#include "Types.h"
+
+#include "MPSState.hpp"
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * A matrix product state simulator for circuits of low entanglement.
+ *
+ * The state of n qubits is stored in O(n chi^2) memory for a bond dimension chi, instead of the
+ * 2^n amplitudes of a state vector, so shallow or one-dimensional circuits of hundreds of qubits
+ * fit on a single node. Bonds are truncated after every two-qubit gate (see `MPSState`); the
+ * singular value decompositions use the LAPACK library given by `lapack_library`, or the one
+ * globally loaded in the process if any, and a built-in Jacobi method otherwise.
+ *
+ * Only Pauli words, and linear combinations of them, are supported as observables. Gates and
+ * matrices act on at most two wires, including their control wires.
+ *
+ * Device kwargs:
+ * - `max_bond_dim`: the maximum bond dimension (128)
+ * - `cutoff`: the maximum relative weight of the singular values discarded at a bond (1e-12)
+ * - `seed`: the seed of the device generator, used if the runtime provides none
+ * - `lapack_library`: the path of a LAPACK library providing zgesdd, such as the OpenBLAS of
+ *   SciPy which the frontend passes by default
+ */
+class MPSDevice final : public Catalyst::Runtime::QuantumDevice {
+  private:
+    static constexpr size_t default_max_bond_dim = 128;
+    static constexpr double default_cutoff = 1e-12;
+
+    // A Pauli word with a coefficient, on device wires
+    struct PauliTerm {
+        double coeff;
+        std::vector<size_t> wires;
+        std::string paulis;
+    };
+
+    Catalyst::Runtime::QubitManager<QubitIdType, size_t> qubit_manager{};
+    std::unordered_map<std::string, std::string> device_kwargs;
+    size_t device_shots{0};
+    size_t num_qubits{0};
+
+    std::mt19937 *device_gen{nullptr};
+    std::mt19937 fallback_gen;
+
+    size_t max_bond_dim{default_max_bond_dim};
+    double cutoff{default_cutoff};
+    MPS::LapackSVD lapack{MPS::getLapackSVD()};
+    MPSState state{default_max_bond_dim, default_cutoff};
+
+    // The observables, as sums of Pauli terms
+    std::vector<std::vector<PauliTerm>> observables{};
+
+    [[nodiscard]] auto getGenerator() -> std::mt19937 *
+    {
+        return device_gen != nullptr ? device_gen : &fallback_gen;
+    }
+
+    [[nodiscard]] auto getObservable(ObsIdType obsKey) const -> const std::vector<PauliTerm> &;
+    [[nodiscard]] auto getSamples(const std::vector<size_t> &wires) -> std::vector<uint8_t>;
+    void applyMatrix(MPSState::MatrixT matrix, const std::vector<QubitIdType> &wires,
+                     bool inverse, const std::vector<QubitIdType> &controlled_wires,
+                     const std::vector<bool> &controlled_values);
+
+  public:
+    explicit MPSDevice(const std::string &kwargs = "{}");
+    ~MPSDevice() override = default;
+
+    MPSDevice &operator=(const MPSDevice &) = delete;
+    MPSDevice(const MPSDevice &) = delete;
+    MPSDevice(MPSDevice &&) = delete;
+    MPSDevice &operator=(MPSDevice &&) = delete;
+
+    auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType> override;
+    void ReleaseAllQubits() override;
+    [[nodiscard]] auto GetNumQubits() const -> size_t override;
+
+    /**
+     * Return whether the singular value decompositions use LAPACK.
+     */
+    [[nodiscard]] auto UsesLapack() const -> bool { return state.usesLapack(); }
+    void SetDeviceShots(size_t shots) override;
+    [[nodiscard]] auto GetDeviceShots() const -> size_t override;
+    void SetDevicePRNG(std::mt19937 *gen) override;
+
+    void NamedOperation(const std::string &name, const std::vector<double> &params,
+                        const std::vector<QubitIdType> &wires, bool inverse = false,
+                        const std::vector<QubitIdType> &controlled_wires = {},
+                        const std::vector<bool> &controlled_values = {}) override;
+    void MatrixOperation(const std::vector<std::complex<double>> &matrix,
+                         const std::vector<QubitIdType> &wires, bool inverse = false,
+                         const std::vector<QubitIdType> &controlled_wires = {},
+                         const std::vector<bool> &controlled_values = {}) override;
+    auto Measure(QubitIdType wire, std::optional<int32_t> postselect = std::nullopt)
+        -> Result override;
+
+    auto Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
+                    const std::vector<QubitIdType> &wires) -> ObsIdType override;
+    auto TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType override;
+    auto HamiltonianObservable(const std::vector<double> &coeffs,
+                               const std::vector<ObsIdType> &obs) -> ObsIdType override;
+    auto Expval(ObsIdType obsKey) -> double override;
+    auto Var(ObsIdType obsKey) -> double override;
+
+    void State(DataView<std::complex<double>, 1> &state_view) override;
+    void Sample(DataView<double, 2> &samples) override;
+    void PartialSample(DataView<double, 2> &samples,
+                       const std::vector<QubitIdType> &wires) override;
+    void Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts) override;
+    void PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                       const std::vector<QubitIdType> &wires) override;
+
+    [[nodiscard]] auto getState() const -> const MPSState & { return state; }
+};
+
+} // namespace Catalyst::Runtime::Devices
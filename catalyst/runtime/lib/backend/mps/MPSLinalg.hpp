@@ -0,0 +1,303 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Catalyst::Runtime::Devices::MPS {
+
+using ComplexT = std::complex<double>;
+
+/**
+ * The thin singular value decomposition `A = U diag(S) Vh` of an m-by-n matrix, with k = min(m, n)
+ * singular values in descending order. All matrices are in row-major order: U is m-by-k and Vh
+ * is k-by-n.
+ */
+struct SVDResult {
+    std::vector<ComplexT> U;
+    std::vector<double> S;
+    std::vector<ComplexT> Vh;
+};
+
+// The C interface of the LAPACK zgesdd routine, as used by the `jax_cpu_lapack_kernels` of the
+// frontend (`jax::ComplexGesdd<std::complex<double>>::FnType`)
+using ZgesddFnType = int(int matrix_layout, char jobz, int m, int n, ComplexT *a, int lda,
+                         double *s, ComplexT *u, int ldu, ComplexT *vt, int ldvt);
+
+// The Fortran interface of the same routine, which is all that plain LAPACK libraries export
+using ZgesddFortranFnType = void(const char *jobz, const int *m, const int *n, ComplexT *a,
+                                 const int *lda, double *s, ComplexT *u, const int *ldu,
+                                 ComplexT *vt, const int *ldvt, ComplexT *work, const int *lwork,
+                                 double *rwork, int *iwork, int *info, size_t jobz_len);
+
+constexpr int lapack_row_major = 101;
+
+/**
+ * The zgesdd routine of a LAPACK library, through either of its interfaces. Both are null if no
+ * library was found.
+ */
+struct LapackSVD {
+    ZgesddFnType *lapacke{nullptr};
+    ZgesddFortranFnType *fortran{nullptr};
+
+    [[nodiscard]] explicit operator bool() const { return lapacke || fortran; }
+};
+
+/**
+ * Look up zgesdd in the given `dlopen` handle. SciPy's OpenBLAS exports its symbols with a
+ * `scipy_` prefix, and the LAPACKE interface is preferred when available.
+ */
+inline auto findLapackSVD(void *handle) -> LapackSVD
+{
+    for (const char *name : {"scipy_LAPACKE_zgesdd", "LAPACKE_zgesdd"}) {
+        if (void *symbol = dlsym(handle, name)) {
+            return {reinterpret_cast<ZgesddFnType *>(symbol), nullptr};
+        }
+    }
+    for (const char *name : {"scipy_zgesdd_", "zgesdd_"}) {
+        if (void *symbol = dlsym(handle, name)) {
+            return {nullptr, reinterpret_cast<ZgesddFortranFnType *>(symbol)};
+        }
+    }
+    return {};
+}
+
+/**
+ * Look up zgesdd among the global symbols of the process. Compiled programs are loaded with
+ * `RTLD_LOCAL`, so this only finds a LAPACK library that the host application itself links; use
+ * `loadLapackSVD` with the path of the library otherwise.
+ */
+inline auto getLapackSVD() -> LapackSVD
+{
+    static const LapackSVD fn = findLapackSVD(RTLD_DEFAULT);
+    return fn;
+}
+
+/**
+ * Load the LAPACK library at `path` and look up its zgesdd routine. The library stays loaded
+ * for the lifetime of the process. Return an empty routine if the library can't be loaded or
+ * doesn't provide zgesdd.
+ */
+inline auto loadLapackSVD(const std::string &path) -> LapackSVD
+{
+    void *handle = dlopen(path.c_str(), RTLD_LAZY | RTLD_LOCAL);
+    if (!handle) {
+        return {};
+    }
+    return findLapackSVD(handle);
+}
+
+/**
+ * Compute the SVD of a matrix with the one-sided Jacobi (Hestenes) method.
+ *
+ * Pairs of columns are orthogonalized by plane rotations until all columns are orthogonal; the
+ * singular values are then the column norms. Wide matrices are decomposed through their
+ * conjugate transpose. This is the fallback of `computeSVD` when LAPACK isn't available.
+ */
+inline auto jacobiSVD(const std::vector<ComplexT> &matrix, size_t m, size_t n) -> SVDResult
+{
+    if (m < n) {
+        // A^H = U' S V'^H, hence A = V' S U'^H
+        std::vector<ComplexT> adjoint(n * m);
+        for (size_t row = 0; row < m; row++) {
+            for (size_t col = 0; col < n; col++) {
+                adjoint[col * m + row] = std::conj(matrix[row * n + col]);
+            }
+        }
+        auto [U, S, Vh] = jacobiSVD(adjoint, n, m);
+
+        SVDResult result{std::vector<ComplexT>(m * m), std::move(S), std::vector<ComplexT>(m * n)};
+        for (size_t row = 0; row < m; row++) {
+            for (size_t col = 0; col < m; col++) {
+                result.U[row * m + col] = std::conj(Vh[col * m + row]);
+            }
+        }
+        for (size_t row = 0; row < m; row++) {
+            for (size_t col = 0; col < n; col++) {
+                result.Vh[row * n + col] = std::conj(U[col * m + row]);
+            }
+        }
+        return result;
+    }
+
+    constexpr size_t max_sweeps = 64;
+    constexpr double tol = 1e-15;
+
+    // The columns of A and V are stored contiguously
+    std::vector<ComplexT> a(m * n);
+    std::vector<ComplexT> v(n * n);
+    for (size_t row = 0; row < m; row++) {
+        for (size_t col = 0; col < n; col++) {
+            a[col * m + row] = matrix[row * n + col];
+        }
+    }
+    for (size_t col = 0; col < n; col++) {
+        v[col * n + col] = 1.0;
+    }
+
+    auto rotate = [](ComplexT *p, ComplexT *q, size_t size, double c, ComplexT sp, ComplexT sq) {
+        for (size_t k = 0; k < size; k++) {
+            const ComplexT x = p[k];
+            const ComplexT y = q[k];
+            p[k] = c * x - sq * y;
+            q[k] = sp * x + c * y;
+        }
+    };
+
+    for (size_t sweep = 0; sweep < max_sweeps; sweep++) {
+        bool converged = true;
+        for (size_t p = 0; p + 1 < n; p++) {
+            for (size_t q = p + 1; q < n; q++) {
+                ComplexT *ap = &a[p * m];
+                ComplexT *aq = &a[q * m];
+
+                double alpha = 0;
+                double beta = 0;
+                ComplexT gamma = 0;
+                for (size_t k = 0; k < m; k++) {
+                    alpha += std::norm(ap[k]);
+                    beta += std::norm(aq[k]);
+                    gamma += std::conj(ap[k]) * aq[k];
+                }
+
+                const double abs_gamma = std::abs(gamma);
+                if (abs_gamma <= tol * std::sqrt(alpha * beta) || abs_gamma == 0) {
+                    continue;
+                }
+                converged = false;
+
+                // Rotate the pair (a_p, e^{-i phi} a_q), whose inner product is real
+                const double zeta = (beta - alpha) / (2 * abs_gamma);
+                const double t = std::copysign(1.0, zeta) / (std::abs(zeta) + std::hypot(1, zeta));
+                const double c = 1 / std::hypot(1, t);
+                const ComplexT phase = gamma / abs_gamma;
+                const ComplexT sp = c * t * phase;
+                const ComplexT sq = c * t * std::conj(phase);
+
+                rotate(ap, aq, m, c, sp, sq);
+                rotate(&v[p * n], &v[q * n], n, c, sp, sq);
+            }
+        }
+        if (converged) {
+            break;
+        }
+    }
+
+    std::vector<double> norms(n);
+    for (size_t col = 0; col < n; col++) {
+        double norm = 0;
+        for (size_t k = 0; k < m; k++) {
+            norm += std::norm(a[col * m + k]);
+        }
+        norms[col] = std::sqrt(norm);
+    }
+
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&norms](size_t lhs, size_t rhs) { return norms[lhs] > norms[rhs]; });
+
+    SVDResult result{std::vector<ComplexT>(m * n), std::vector<double>(n),
+                     std::vector<ComplexT>(n * n)};
+    for (size_t j = 0; j < n; j++) {
+        const size_t col = order[j];
+        const double sigma = norms[col];
+        result.S[j] = sigma;
+        for (size_t k = 0; k < m; k++) {
+            result.U[k * n + j] = sigma > 0 ? a[col * m + k] / sigma : ComplexT{0};
+        }
+        for (size_t k = 0; k < n; k++) {
+            result.Vh[j * n + k] = std::conj(v[col * n + k]);
+        }
+    }
+    return result;
+}
+
+/**
+ * Compute the thin SVD of an m-by-n matrix in row-major order with the zgesdd routine of LAPACK.
+ * Return nothing if the routine fails, which only happens on NaN entries or when its bidiagonal
+ * iteration doesn't converge.
+ */
+inline auto lapackSVD(const LapackSVD &lapack, const std::vector<ComplexT> &matrix, size_t m,
+                      size_t n) -> std::optional<SVDResult>
+{
+    // zgesdd overwrites its input
+    std::vector<ComplexT> a(matrix);
+    const size_t k = std::min(m, n);
+    SVDResult result{std::vector<ComplexT>(m * k), std::vector<double>(k),
+                     std::vector<ComplexT>(k * n)};
+
+    if (lapack.lapacke) {
+        const int info = lapack.lapacke(lapack_row_major, 'S', static_cast<int>(m),
+                                        static_cast<int>(n), a.data(), static_cast<int>(n),
+                                        result.S.data(), result.U.data(), static_cast<int>(k),
+                                        result.Vh.data(), static_cast<int>(n));
+        return info == 0 ? std::optional(std::move(result)) : std::nullopt;
+    }
+
+    // The row-major A is the column-major n-by-m matrix A^T = conj(V) S U^T, hence decompose A^T
+    // and swap the roles of the outputs: the column-major k-by-m Vh of A^T is the row-major U of
+    // A, and the column-major n-by-k U of A^T is the row-major Vh of A.
+    const char jobz = 'S';
+    const int rows = static_cast<int>(n);
+    const int cols = static_cast<int>(m);
+    const int rank = static_cast<int>(k);
+    const size_t large = std::max(m, n);
+    std::vector<double> rwork(k * std::max(5 * k + 7, 2 * large + 2 * k + 1));
+    std::vector<int> iwork(8 * k);
+    int info = 0;
+
+    // Query the size of the workspace first
+    int lwork = -1;
+    ComplexT optimal_lwork;
+    lapack.fortran(&jobz, &rows, &cols, a.data(), &rows, result.S.data(), result.Vh.data(), &rows,
+                   result.U.data(), &rank, &optimal_lwork, &lwork, rwork.data(), iwork.data(),
+                   &info, 1);
+    if (info != 0) {
+        return std::nullopt;
+    }
+    lwork = static_cast<int>(optimal_lwork.real());
+    std::vector<ComplexT> work(std::max(lwork, 1));
+    lapack.fortran(&jobz, &rows, &cols, a.data(), &rows, result.S.data(), result.Vh.data(), &rows,
+                   result.U.data(), &rank, work.data(), &lwork, rwork.data(), iwork.data(), &info,
+                   1);
+    return info == 0 ? std::optional(std::move(result)) : std::nullopt;
+}
+
+/**
+ * Compute the thin SVD of an m-by-n matrix in row-major order, with LAPACK if a library is
+ * given and with the one-sided Jacobi method otherwise.
+ */
+inline auto computeSVD(const std::vector<ComplexT> &matrix, size_t m, size_t n,
+                       const LapackSVD &lapack) -> SVDResult
+{
+    if (lapack) {
+        if (auto result = lapackSVD(lapack, matrix, m, n)) {
+            return std::move(*result);
+        }
+        // Fall back to the Jacobi method, which always converges
+    }
+    return jacobiSVD(matrix, m, n);
+}
+
+} // namespace Catalyst::Runtime::Devices::MPS
@@ -0,0 +1,567 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "Exception.hpp"
+
+#include "MPSLinalg.hpp"
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * A matrix product state of qubits in mixed canonical form.
+ *
+ * The state is a chain of tensors of shape (left bond, 2, right bond). The tensors left of the
+ * orthogonality center are left-canonical and the ones right of it are right-canonical, so local
+ * quantities only depend on the tensors between the center and the qubits they involve. Gates on
+ * two neighbouring sites are applied by a singular value decomposition of their two tensors,
+ * which truncates the bond to `max_bond_dim` singular values and discards the ones whose total
+ * weight is below `cutoff`. Gates on distant qubits bring them together with SWAP gates; the
+ * qubits are not swapped back, and the site of each qubit is tracked instead.
+ *
+ * The memory and the cost of gates are linear in the number of qubits, and polynomial in the bond
+ * dimension, which grows with the entanglement of the state.
+ *
+ * @param max_bond_dim The maximum bond dimension
+ * @param cutoff The maximum relative weight of the singular values discarded at every bond
+ * @param lapack The LAPACK routine of the decompositions, the Jacobi method being used if empty
+ */
+class MPSState {
+  public:
+    using ComplexT = MPS::ComplexT;
+
+    // A one- or two-qubit matrix in row-major order, where the first qubit is the most
+    // significant one
+    using MatrixT = std::vector<ComplexT>;
+
+  private:
+    // Singular values below this fraction of the largest one are dropped at any bond
+    static constexpr double zero_tol = 1e-14;
+
+    size_t max_bond_dim;
+    double cutoff;
+    MPS::LapackSVD lapack;
+
+    // The tensor of each site, and the bond dimensions left of each site
+    std::vector<std::vector<ComplexT>> tensors{};
+    std::vector<size_t> bonds{1};
+
+    // The site of each qubit, and the qubit of each site
+    std::vector<size_t> sites{};
+    std::vector<size_t> qubits{};
+
+    size_t center{0};
+    double truncation_error{0.0};
+
+    /**
+     * Return the product of an m-by-k matrix and a k-by-n matrix.
+     */
+    [[nodiscard]] static auto multiply(const std::vector<ComplexT> &lhs,
+                                       const std::vector<ComplexT> &rhs, size_t m, size_t k,
+                                       size_t n) -> std::vector<ComplexT>
+    {
+        std::vector<ComplexT> result(m * n);
+        for (size_t row = 0; row < m; row++) {
+            ComplexT *out = &result[row * n];
+            for (size_t idx = 0; idx < k; idx++) {
+                const ComplexT factor = lhs[row * k + idx];
+                if (factor == ComplexT{0}) {
+                    continue;
+                }
+                const ComplexT *in = &rhs[idx * n];
+                for (size_t col = 0; col < n; col++) {
+                    out[col] += factor * in[col];
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Decompose a rows-by-cols matrix into a left factor with orthonormal columns and a right
+     * factor with orthonormal rows, the singular values being absorbed into the right factor if
+     * `absorb_right` and into the left one otherwise. Return both factors and the number of
+     * singular values kept.
+     */
+    auto decompose(const std::vector<ComplexT> &matrix, size_t rows, size_t cols, bool truncate,
+                   bool absorb_right)
+        -> std::tuple<std::vector<ComplexT>, std::vector<ComplexT>, size_t>
+    {
+        auto [U, S, Vh] = MPS::computeSVD(matrix, rows, cols, lapack);
+        const size_t rank = S.size();
+
+        double total = 0;
+        for (double sigma : S) {
+            total += sigma * sigma;
+        }
+
+        size_t keep = 1;
+        while (keep < rank && S[keep] > zero_tol * S[0]) {
+            keep++;
+        }
+        if (truncate) {
+            keep = std::min(keep, max_bond_dim);
+            double discarded = 0;
+            for (size_t j = keep; j < rank; j++) {
+                discarded += S[j] * S[j];
+            }
+            while (keep > 1 && discarded + S[keep - 1] * S[keep - 1] <= cutoff * total) {
+                keep--;
+                discarded += S[keep] * S[keep];
+            }
+            truncation_error += total > 0 ? discarded / total : 0;
+        }
+
+        // Renormalize the kept singular values
+        double kept = 0;
+        for (size_t j = 0; j < keep; j++) {
+            kept += S[j] * S[j];
+        }
+        const double scale = kept > 0 ? std::sqrt(total / kept) : 1.0;
+
+        std::vector<ComplexT> left(rows * keep);
+        std::vector<ComplexT> right(keep * cols);
+        for (size_t row = 0; row < rows; row++) {
+            for (size_t j = 0; j < keep; j++) {
+                left[row * keep + j] = U[row * rank + j] * (absorb_right ? 1.0 : S[j] * scale);
+            }
+        }
+        for (size_t j = 0; j < keep; j++) {
+            const double factor = absorb_right ? S[j] * scale : 1.0;
+            for (size_t col = 0; col < cols; col++) {
+                right[j * cols + col] = Vh[j * cols + col] * factor;
+            }
+        }
+        return {std::move(left), std::move(right), keep};
+    }
+
+    /**
+     * Move the orthogonality center to a site.
+     */
+    void moveCenter(size_t site)
+    {
+        while (center < site) {
+            const size_t left = bonds[center];
+            const size_t right = bonds[center + 1];
+            auto [U, SVh, keep] = decompose(tensors[center], left * 2, right, false, true);
+            tensors[center] = std::move(U);
+            tensors[center + 1] =
+                multiply(SVh, tensors[center + 1], keep, right, 2 * bonds[center + 2]);
+            bonds[center + 1] = keep;
+            center++;
+        }
+        while (center > site) {
+            const size_t left = bonds[center];
+            const size_t right = bonds[center + 1];
+            auto [US, Vh, keep] = decompose(tensors[center], left, 2 * right, false, false);
+            tensors[center] = std::move(Vh);
+            tensors[center - 1] =
+                multiply(tensors[center - 1], US, bonds[center - 1] * 2, left, keep);
+            bonds[center] = keep;
+            center--;
+        }
+    }
+
+    void applyLocal(const MatrixT &matrix, size_t site)
+    {
+        auto &tensor = tensors[site];
+        const size_t left = bonds[site];
+        const size_t right = bonds[site + 1];
+        for (size_t l = 0; l < left; l++) {
+            ComplexT *t0 = &tensor[(l * 2) * right];
+            ComplexT *t1 = &tensor[(l * 2 + 1) * right];
+            for (size_t r = 0; r < right; r++) {
+                const ComplexT v0 = t0[r];
+                const ComplexT v1 = t1[r];
+                t0[r] = matrix[0] * v0 + matrix[1] * v1;
+                t1[r] = matrix[2] * v0 + matrix[3] * v1;
+            }
+        }
+    }
+
+    /**
+     * Apply a two-qubit matrix to the sites `site` and `site + 1`, the first qubit of the matrix
+     * being on `site`. The orthogonality center ends on `site + 1`.
+     */
+    void applyAdjacent(const MatrixT &matrix, size_t site)
+    {
+        moveCenter(site);
+
+        const size_t left = bonds[site];
+        const size_t mid = bonds[site + 1];
+        const size_t right = bonds[site + 2];
+        auto theta = multiply(tensors[site], tensors[site + 1], left * 2, mid, 2 * right);
+
+        // theta[l, s1, s2, r] <- sum matrix[s1 s2, t1 t2] theta[l, t1, t2, r]
+        std::array<ComplexT, 4> in{};
+        for (size_t l = 0; l < left; l++) {
+            ComplexT *block = &theta[l * 4 * right];
+            for (size_t r = 0; r < right; r++) {
+                for (size_t s = 0; s < 4; s++) {
+                    in[s] = block[s * right + r];
+                }
+                for (size_t s = 0; s < 4; s++) {
+                    block[s * right + r] = matrix[s * 4] * in[0] + matrix[s * 4 + 1] * in[1] +
+                                           matrix[s * 4 + 2] * in[2] + matrix[s * 4 + 3] * in[3];
+                }
+            }
+        }
+
+        auto [U, SVh, keep] = decompose(theta, left * 2, 2 * right, true, true);
+        tensors[site] = std::move(U);
+        tensors[site + 1] = std::move(SVh);
+        bonds[site + 1] = keep;
+        center = site + 1;
+    }
+
+    void swapSites(size_t site)
+    {
+        const ComplexT one{1.0, 0.0};
+        static const MatrixT swap{one, 0, 0, 0, 0, 0, one, 0, 0, one, 0, 0, 0, 0, 0, one};
+        applyAdjacent(swap, site);
+        std::swap(qubits[site], qubits[site + 1]);
+        sites[qubits[site]] = site;
+        sites[qubits[site + 1]] = site + 1;
+    }
+
+    /**
+     * Apply a Pauli matrix to the physical index of a tensor.
+     */
+    static void applyPauli(std::vector<ComplexT> &tensor, size_t left, size_t right, char pauli)
+    {
+        const ComplexT i{0.0, 1.0};
+        for (size_t l = 0; l < left; l++) {
+            ComplexT *t0 = &tensor[(l * 2) * right];
+            ComplexT *t1 = &tensor[(l * 2 + 1) * right];
+            for (size_t r = 0; r < right; r++) {
+                const ComplexT v0 = t0[r];
+                const ComplexT v1 = t1[r];
+                switch (pauli) {
+                case 'X':
+                    t0[r] = v1;
+                    t1[r] = v0;
+                    break;
+                case 'Y':
+                    t0[r] = -i * v1;
+                    t1[r] = i * v0;
+                    break;
+                case 'Z':
+                    t1[r] = -v1;
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+    }
+
+  public:
+    explicit MPSState(size_t max_bond_dim, double cutoff,
+                      MPS::LapackSVD lapack = MPS::getLapackSVD())
+        : max_bond_dim(max_bond_dim), cutoff(cutoff), lapack(lapack)
+    {
+    }
+
+    /**
+     * Return whether the decompositions use LAPACK rather than the Jacobi method.
+     */
+    [[nodiscard]] auto usesLapack() const -> bool { return static_cast<bool>(lapack); }
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return sites.size(); }
+
+    [[nodiscard]] auto getMaxBondDim() const -> size_t
+    {
+        return *std::max_element(bonds.begin(), bonds.end());
+    }
+
+    /**
+     * Return the sum of the relative weights of the singular values discarded so far, an upper
+     * bound of the infidelity of the state.
+     */
+    [[nodiscard]] auto getTruncationError() const -> double { return truncation_error; }
+
+    /**
+     * Add qubits in |0> at the end of the chain.
+     */
+    void addQubits(size_t count)
+    {
+        for (size_t k = 0; k < count; k++) {
+            sites.push_back(tensors.size());
+            qubits.push_back(sites.size() - 1);
+            tensors.push_back({ComplexT{1.0, 0.0}, ComplexT{0.0, 0.0}});
+            bonds.push_back(1);
+        }
+    }
+
+    /**
+     * Apply a one- or two-qubit matrix.
+     */
+    void apply(const MatrixT &matrix, size_t num_qubits, size_t qubit0, size_t qubit1 = 0)
+    {
+        if (num_qubits == 1) {
+            applyLocal(matrix, sites[qubit0]);
+            return;
+        }
+
+        RT_FAIL_IF(qubit0 == qubit1, "Invalid wires of a two-qubit gate");
+
+        // Bring the second qubit next to the first one
+        while (sites[qubit1] > sites[qubit0] + 1) {
+            swapSites(sites[qubit1] - 1);
+        }
+        while (sites[qubit1] + 1 < sites[qubit0]) {
+            swapSites(sites[qubit1]);
+        }
+
+        if (sites[qubit0] < sites[qubit1]) {
+            applyAdjacent(matrix, sites[qubit0]);
+            return;
+        }
+
+        // Exchange the qubits of the matrix: swapped[ab, cd] = matrix[ba, dc]
+        MatrixT swapped(16);
+        for (size_t row = 0; row < 4; row++) {
+            for (size_t col = 0; col < 4; col++) {
+                const size_t srow = ((row & 1U) << 1) | (row >> 1);
+                const size_t scol = ((col & 1U) << 1) | (col >> 1);
+                swapped[row * 4 + col] = matrix[srow * 4 + scol];
+            }
+        }
+        applyAdjacent(swapped, sites[qubit1]);
+    }
+
+    /**
+     * Return the probabilities of the outcomes of a computational-basis measurement of a qubit.
+     */
+    [[nodiscard]] auto getProbabilities(size_t qubit) -> std::vector<double>
+    {
+        const size_t site = sites[qubit];
+        moveCenter(site);
+
+        std::vector<double> probs(2, 0.0);
+        const auto &tensor = tensors[site];
+        const size_t right = bonds[site + 1];
+        for (size_t l = 0; l < bonds[site]; l++) {
+            for (size_t s = 0; s < 2; s++) {
+                for (size_t r = 0; r < right; r++) {
+                    probs[s] += std::norm(tensor[(l * 2 + s) * right + r]);
+                }
+            }
+        }
+        return probs;
+    }
+
+    /**
+     * Project a qubit on a computational basis state, and renormalize the state.
+     */
+    void collapse(size_t qubit, bool outcome)
+    {
+        const double prob = getProbabilities(qubit)[outcome];
+        RT_FAIL_IF(prob == 0, "Unable to collapse a qubit on a state of probability 0");
+
+        const double scale = 1 / std::sqrt(prob);
+        const size_t site = sites[qubit];
+        auto &tensor = tensors[site];
+        const size_t right = bonds[site + 1];
+        for (size_t l = 0; l < bonds[site]; l++) {
+            for (size_t r = 0; r < right; r++) {
+                tensor[(l * 2 + outcome) * right + r] *= scale;
+                tensor[(l * 2 + !outcome) * right + r] = 0;
+            }
+        }
+    }
+
+    /**
+     * Return the expectation value of a Pauli word, with one letter of "IXYZ" for each qubit.
+     *
+     * The word is contracted between its first and last sites, from the orthogonality center
+     * moved to its first site, in O(d chi^3) operations for a word spanning d sites.
+     */
+    [[nodiscard]] auto ExpectationValue(const std::vector<size_t> &word_qubits,
+                                        std::string_view paulis) -> double
+    {
+        RT_FAIL_IF(word_qubits.size() != paulis.size(), "Invalid Pauli word");
+
+        const size_t num_sites = tensors.size();
+        std::vector<char> ops(num_sites, 'I');
+        size_t first = num_sites;
+        size_t last = 0;
+        for (size_t k = 0; k < word_qubits.size(); k++) {
+            RT_FAIL_IF(word_qubits[k] >= num_sites || ops[sites[word_qubits[k]]] != 'I',
+                       "Invalid wires of the Pauli word");
+            RT_FAIL_IF(paulis[k] != 'I' && paulis[k] != 'X' && paulis[k] != 'Y' && paulis[k] != 'Z',
+                       "Invalid Pauli word");
+            if (paulis[k] == 'I') {
+                continue;
+            }
+            const size_t site = sites[word_qubits[k]];
+            ops[site] = paulis[k];
+            first = std::min(first, site);
+            last = std::max(last, site);
+        }
+        if (first == num_sites) {
+            return 1.0;
+        }
+
+        moveCenter(first);
+
+        // The environment E[r, r'] of the contraction so far, the identity left of `first`
+        size_t dim = bonds[first];
+        std::vector<ComplexT> env(dim * dim);
+        for (size_t k = 0; k < dim; k++) {
+            env[k * dim + k] = 1.0;
+        }
+
+        for (size_t site = first; site <= last; site++) {
+            const size_t left = bonds[site];
+            const size_t right = bonds[site + 1];
+
+            // tmp[l, s, r'] = sum_{l'} E[l, l'] (O T)[l', s, r']
+            auto ket = tensors[site];
+            applyPauli(ket, left, right, ops[site]);
+            auto tmp = multiply(env, ket, left, left, 2 * right);
+
+            // E'[r, r'] = sum_{l, s} conj(T[l, s, r]) tmp[l, s, r']
+            const auto &bra = tensors[site];
+            std::vector<ComplexT> next(right * right);
+            for (size_t ls = 0; ls < left * 2; ls++) {
+                for (size_t r = 0; r < right; r++) {
+                    const ComplexT factor = std::conj(bra[ls * right + r]);
+                    if (factor == ComplexT{0}) {
+                        continue;
+                    }
+                    for (size_t rp = 0; rp < right; rp++) {
+                        next[r * right + rp] += factor * tmp[ls * right + rp];
+                    }
+                }
+            }
+            env = std::move(next);
+            dim = right;
+        }
+
+        // The tensors right of `last` are right-canonical
+        ComplexT trace{0};
+        for (size_t k = 0; k < dim; k++) {
+            trace += env[k * dim + k];
+        }
+        return trace.real();
+    }
+
+    /**
+     * Sample computational-basis measurements of qubits, without changing the state.
+     *
+     * Each shot is drawn site by site from the conditional probabilities of the outcomes given the
+     * previous ones, which only depend on the sites up to the current one when the orthogonality
+     * center is on the first site: a shot costs O(n chi^2) operations. Return `shots` rows of one
+     * bit per qubit.
+     */
+    template <typename GeneratorT>
+    [[nodiscard]] auto Sample(const std::vector<size_t> &sample_qubits, size_t shots,
+                              GeneratorT &gen) -> std::vector<uint8_t>
+    {
+        const size_t num_qubits = sample_qubits.size();
+        std::vector<uint8_t> samples(shots * num_qubits);
+        if (!num_qubits) {
+            return samples;
+        }
+
+        size_t last = 0;
+        for (auto qubit : sample_qubits) {
+            last = std::max(last, sites[qubit]);
+        }
+
+        moveCenter(0);
+
+        std::uniform_real_distribution<double> dis(0.0, 1.0);
+        std::vector<uint8_t> bits(last + 1);
+        std::vector<ComplexT> vec;
+        std::array<std::vector<ComplexT>, 2> branches;
+        for (size_t shot = 0; shot < shots; shot++) {
+            vec.assign(1, ComplexT{1.0, 0.0});
+            for (size_t site = 0; site <= last; site++) {
+                const size_t left = bonds[site];
+                const size_t right = bonds[site + 1];
+                const auto &tensor = tensors[site];
+
+                std::array<double, 2> probs{0.0, 0.0};
+                for (size_t s = 0; s < 2; s++) {
+                    auto &branch = branches[s];
+                    branch.assign(right, ComplexT{0});
+                    for (size_t l = 0; l < left; l++) {
+                        const ComplexT factor = vec[l];
+                        const ComplexT *row = &tensor[(l * 2 + s) * right];
+                        for (size_t r = 0; r < right; r++) {
+                            branch[r] += factor * row[r];
+                        }
+                    }
+                    for (const auto &value : branch) {
+                        probs[s] += std::norm(value);
+                    }
+                }
+
+                const bool outcome = dis(gen) * (probs[0] + probs[1]) >= probs[0];
+                const double scale = 1 / std::sqrt(probs[outcome]);
+                vec = std::move(branches[outcome]);
+                for (auto &value : vec) {
+                    value *= scale;
+                }
+                bits[site] = outcome;
+            }
+
+            for (size_t k = 0; k < num_qubits; k++) {
+                samples[shot * num_qubits + k] = bits[sites[sample_qubits[k]]];
+            }
+        }
+        return samples;
+    }
+
+    /**
+     * Return the amplitudes of the state, where the first qubit is the most significant one.
+     */
+    [[nodiscard]] auto getAmplitudes() const -> std::vector<ComplexT>
+    {
+        // Contract the chain into psi[sites, right bond]
+        std::vector<ComplexT> psi{ComplexT{1.0, 0.0}};
+        size_t dim = 1;
+        for (size_t site = 0; site < tensors.size(); site++) {
+            psi = multiply(psi, tensors[site], dim, bonds[site], 2 * bonds[site + 1]);
+            dim *= 2;
+        }
+
+        const size_t num_qubits = sites.size();
+        std::vector<ComplexT> amplitudes(dim);
+        for (size_t index = 0; index < dim; index++) {
+            size_t state = 0;
+            for (size_t qubit = 0; qubit < num_qubits; qubit++) {
+                const size_t bit = (index >> (num_qubits - 1 - sites[qubit])) & 1U;
+                state |= bit << (num_qubits - 1 - qubit);
+            }
+            amplitudes[state] = psi[index];
+        }
+        return amplitudes;
+    }
+};
+
+} // namespace Catalyst::Runtime::Devices
@@ -16,13 +16,19 @@
 
 #include <algorithm>
 #include <array>
+#include <charconv>
+#include <cmath>
 #include <complex>
-#include <iomanip>
 #include <memory>
+#include <numbers>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "Exception.hpp"
@@ -43,6 +49,7 @@ enum class BuilderType : uint8_t {
  */
 enum class VariableType : uint8_t {
     Float, // = 0
+    Float64,
 };
 
 /**
@@ -105,6 +112,48 @@ constexpr auto lookup_qasm_gate_name(std::string_view gate_name) -> std::string_
     RT_FAIL("The given QIR gate name is not supported by the OpenQASM builder.");
 }
 
+/**
+ * Lookup the QIR gate names of OpenQasm gates.
+ */
+constexpr auto lookup_rt_gate_name(std::string_view gate_name) -> std::string_view
+{
+    for (auto &&[gate_qir, gate_qasm] : rt_qasm_gate_map) {
+        if (gate_qasm == gate_name) {
+            return gate_qir;
+        }
+    }
+
+    RT_FAIL("The given OpenQasm gate name is not supported by the OpenQASM builder.");
+}
+
+/**
+ * The OpenQasm emitter writes every instruction directly into one output buffer through the
+ * `toOpenQasm(std::string &buffer, ...)` overloads; the overloads returning `std::string` are
+ * kept for serializing single instructions.
+ *
+ * Append the shortest representation of an unsigned integer to the output buffer.
+ */
+inline void appendOpenQasm(std::string &buffer, size_t value)
+{
+    std::array<char, 24> chars{};
+    auto &&[ptr, ec] = std::to_chars(chars.data(), chars.data() + chars.size(), value);
+    RT_FAIL_IF(ec != std::errc(), "Failed to serialize the value");
+    buffer.append(chars.data(), ptr);
+}
+
+/**
+ * Append a floating-point value to the output buffer, formatted as `std::ostream` does
+ * with `std::setprecision(precision)`.
+ */
+inline void appendOpenQasm(std::string &buffer, double value, size_t precision)
+{
+    std::array<char, 128> chars{};
+    auto &&[ptr, ec] = std::to_chars(chars.data(), chars.data() + chars.size(), value,
+                                     std::chars_format::general, static_cast<int>(precision));
+    RT_FAIL_IF(ec != std::errc(), "Failed to serialize the value");
+    buffer.append(chars.data(), ptr);
+}
+
 /**
  * The OpenQasm variable type.
  *
@@ -125,18 +174,27 @@ class QasmVariable {
     [[nodiscard]] auto getType() const -> VariableType { return type; }
     [[nodiscard]] auto getName() const -> std::string { return name; }
 
-    [[nodiscard]] auto toOpenQasm([[maybe_unused]] const std::string &version = "3.0") const
-        -> std::string
+    void toOpenQasm(std::string &buffer, [[maybe_unused]] const std::string &version = "3.0") const
     {
-        std::ostringstream oss;
         switch (type) {
-        case VariableType::Float: {
-            oss << "input float " << name << ";\n";
-            return oss.str();
-        }
+        case VariableType::Float:
+            buffer += "input float ";
+            break;
+        case VariableType::Float64:
+            buffer += "input float[64] ";
+            break;
         default:
             RT_FAIL("Unsupported OpenQasm variable type");
         }
+        buffer += name;
+        buffer += ";\n";
+    }
+
+    [[nodiscard]] auto toOpenQasm(const std::string &version = "3.0") const -> std::string
+    {
+        std::string buffer;
+        toOpenQasm(buffer, version);
+        return buffer;
     }
 };
 
@@ -175,51 +233,66 @@ class QasmRegister {
         return std::all_of(slice.begin(), slice.end(), [this](auto qubit) { return size > qubit; });
     }
 
-    [[nodiscard]] auto toOpenQasm(RegisterMode mode,
-                                  [[maybe_unused]] const std::vector<size_t> &slice = {},
-                                  [[maybe_unused]] const std::string &version = "3.0") const
-        -> std::string
+    void toOpenQasm(std::string &buffer, RegisterMode mode,
+                    [[maybe_unused]] const std::vector<size_t> &slice = {},
+                    [[maybe_unused]] const std::string &version = "3.0") const
     {
-        std::ostringstream oss;
         switch (mode) {
         case RegisterMode::Alloc: {
             // qubit[size] name;
             if (type == RegisterType::Qubit) {
-                oss << "qubit";
+                buffer += "qubit[";
             }
             else if (type == RegisterType::Bit) {
-                oss << "bit";
+                buffer += "bit[";
             }
             else {
                 RT_FAIL("Unsupported OpenQasm register type");
             }
-            oss << "[" << size << "] " << name << ";\n";
-            return oss.str();
+            appendOpenQasm(buffer, size);
+            buffer += "] ";
+            buffer += name;
+            buffer += ";\n";
+            return;
         }
         case RegisterMode::Slice: {
             // name[slice_0], ..., name[slice_n]
             RT_ASSERT(isValidSlice(slice));
-            auto iter = slice.begin();
-            for (; iter != slice.end() - 1; iter++) {
-                oss << name << "[" << *iter << "], ";
+            for (size_t idx = 0; idx < slice.size(); idx++) {
+                if (idx) {
+                    buffer += ", ";
+                }
+                buffer += name;
+                buffer += "[";
+                appendOpenQasm(buffer, slice[idx]);
+                buffer += "]";
             }
-            oss << name << "[" << *iter << "]";
-            return oss.str();
+            return;
         }
         case RegisterMode::Name: {
             // name
-            oss << name;
-            return oss.str();
+            buffer += name;
+            return;
         }
         case RegisterMode::Reset: {
             // reset name;
-            oss << "reset " << name << ";\n";
-            return oss.str();
+            buffer += "reset ";
+            buffer += name;
+            buffer += ";\n";
+            return;
         }
         default:
             RT_FAIL("Unsupported OpenQasm register mode");
         }
     }
+
+    [[nodiscard]] auto toOpenQasm(RegisterMode mode, const std::vector<size_t> &slice = {},
+                                  const std::string &version = "3.0") const -> std::string
+    {
+        std::string buffer;
+        toOpenQasm(buffer, mode, slice, version);
+        return buffer;
+    }
 };
 
 /**
@@ -230,59 +303,74 @@ class QasmRegister {
  * @note It doesn't store the given matrix.
  */
 struct MatrixBuilder {
-    [[nodiscard]] static auto toOpenQasm(const std::vector<std::complex<double>> &matrix,
-                                         size_t num_cols, size_t precision = 5,
-                                         [[maybe_unused]] const std::string &version = "3.0")
-        -> std::string
+    static void toOpenQasm(std::string &buffer, const std::vector<std::complex<double>> &matrix,
+                           size_t num_cols, size_t precision = 5,
+                           [[maybe_unused]] const std::string &version = "3.0")
     {
         constexpr std::complex<double> zero{0, 0};
         size_t index{0};
-        std::ostringstream oss;
-        oss << "[[";
+        buffer += "[[";
         for (const auto &c : matrix) {
             if (index == num_cols) {
-                oss << "], [";
+                buffer += "], [";
                 index = 0;
             }
             else if (index) {
-                oss << ", ";
+                buffer += ", ";
             }
             index++;
 
             if (c == zero) {
-                oss << "0";
+                buffer += "0";
                 continue;
             }
-            oss << std::setprecision(precision) << c.real();
-            oss << std::setprecision(precision) << (c.imag() < 0 ? "" : "+") << c.imag() << "im";
+            appendOpenQasm(buffer, c.real(), precision);
+            if (!(c.imag() < 0)) {
+                buffer += "+";
+            }
+            appendOpenQasm(buffer, c.imag(), precision);
+            buffer += "im";
         }
-        oss << "]]";
-        return oss.str();
+        buffer += "]]";
     }
 
-    [[nodiscard]] static auto toOpenQasm(const std::vector<double> &matrix, size_t num_cols,
-                                         size_t precision = 5,
-                                         [[maybe_unused]] const std::string &version = "3.0")
-        -> std::string
+    static void toOpenQasm(std::string &buffer, const std::vector<double> &matrix, size_t num_cols,
+                           size_t precision = 5,
+                           [[maybe_unused]] const std::string &version = "3.0")
     {
         size_t index{0};
-
-        std::ostringstream oss;
-        oss << "[[";
+        buffer += "[[";
         for (const auto &c : matrix) {
             if (index == num_cols) {
-                oss << "], [";
+                buffer += "], [";
                 index = 0;
             }
             else if (index) {
-                oss << ", ";
+                buffer += ", ";
             }
             index++;
 
-            oss << std::setprecision(precision) << c;
+            appendOpenQasm(buffer, c, precision);
         }
-        oss << "]]";
-        return oss.str();
+        buffer += "]]";
+    }
+
+    [[nodiscard]] static auto toOpenQasm(const std::vector<std::complex<double>> &matrix,
+                                         size_t num_cols, size_t precision = 5,
+                                         const std::string &version = "3.0") -> std::string
+    {
+        std::string buffer;
+        toOpenQasm(buffer, matrix, num_cols, precision, version);
+        return buffer;
+    }
+
+    [[nodiscard]] static auto toOpenQasm(const std::vector<double> &matrix, size_t num_cols,
+                                         size_t precision = 5, const std::string &version = "3.0")
+        -> std::string
+    {
+        std::string buffer;
+        toOpenQasm(buffer, matrix, num_cols, precision, version);
+        return buffer;
     }
 };
 
@@ -335,43 +423,312 @@ class QasmGate {
     [[nodiscard]] auto getWires() const -> std::vector<size_t> { return wires; }
     [[nodiscard]] auto getInverse() const -> bool { return inverse; }
 
-    [[nodiscard]] auto toOpenQasm(const QasmRegister &qregister, size_t precision = 5,
-                                  const std::string &version = "3.0") const -> std::string
+    /**
+     * An upper-bound estimate of the size of the serialized gate, to reserve the output buffer.
+     */
+    [[nodiscard]] auto estimateSize(const QasmRegister &qregister, size_t precision = 5) const
+        -> size_t
+    {
+        // The digits, sign, decimal point, and exponent of a serialized value
+        const size_t value_size = precision + 8;
+        const size_t wires_size = wires.size() * (qregister.getName().size() + 24);
+        if (name == "QubitUnitary") {
+            return 32 + matrix.size() * (2 * value_size + 4) + wires_size;
+        }
+
+        size_t size = name.size() + 4 + params_val.size() * (value_size + 2) + wires_size;
+        for (const auto &param : params_str) {
+            size += param.size() + 2;
+        }
+        return size;
+    }
+
+    void toOpenQasm(std::string &buffer, const QasmRegister &qregister, size_t precision = 5,
+                    const std::string &version = "3.0") const
     {
-        std::ostringstream oss;
         // @note This is a Braket specific functionality
         // #pragma braket unitary(matrix) qubit_1, ..., qubit_m
         if (name == "QubitUnitary") {
-            oss << "#pragma braket unitary(";
-            oss << MatrixBuilder::toOpenQasm(matrix, (1UL << wires.size()), precision, version);
-            oss << ") ";
-            oss << qregister.toOpenQasm(RegisterMode::Slice, wires) << "\n";
-            return oss.str();
+            buffer += "#pragma braket unitary(";
+            MatrixBuilder::toOpenQasm(buffer, matrix, (1UL << wires.size()), precision, version);
+            buffer += ") ";
+            qregister.toOpenQasm(buffer, RegisterMode::Slice, wires);
+            buffer += "\n";
+            return;
         }
 
         // name(param_1, ..., param_n) qubit_1, ..., qubit_m
-        oss << name;
+        buffer += name;
         if (!params_val.empty()) {
-            oss << "(";
-            auto iter = params_val.begin();
-            for (; iter != params_val.end() - 1; iter++) {
-                oss << std::setprecision(precision) << *iter << ", ";
+            buffer += "(";
+            for (size_t idx = 0; idx < params_val.size(); idx++) {
+                if (idx) {
+                    buffer += ", ";
+                }
+                appendOpenQasm(buffer, params_val[idx], precision);
             }
-            oss << std::setprecision(precision) << *iter << ") ";
+            buffer += ") ";
         }
         else if (!params_str.empty()) {
-            oss << "(";
-            auto iter = params_str.begin();
-            for (; iter != params_str.end() - 1; iter++) {
-                oss << *iter << ", ";
+            buffer += "(";
+            for (size_t idx = 0; idx < params_str.size(); idx++) {
+                if (idx) {
+                    buffer += ", ";
+                }
+                buffer += params_str[idx];
             }
-            oss << *iter << ") ";
+            buffer += ") ";
         }
         else {
-            oss << " ";
+            buffer += " ";
         }
-        oss << qregister.toOpenQasm(RegisterMode::Slice, wires) << ";\n";
-        return oss.str();
+        qregister.toOpenQasm(buffer, RegisterMode::Slice, wires);
+        buffer += ";\n";
+    }
+
+    [[nodiscard]] auto toOpenQasm(const QasmRegister &qregister, size_t precision = 5,
+                                  const std::string &version = "3.0") const -> std::string
+    {
+        std::string buffer;
+        buffer.reserve(estimateSize(qregister, precision));
+        toOpenQasm(buffer, qregister, precision, version);
+        return buffer;
+    }
+};
+
+/**
+ * The gate counts of a circuit before and after the peephole stage.
+ *
+ * @param num_gates_in The number of recorded gates
+ * @param num_gates_out The number of emitted gates
+ * @param num_cancelled The number of gates removed as adjacent inverse pairs
+ * @param num_merged The number of gates merged into their predecessor
+ * @param num_dropped The number of identity gates removed
+ */
+struct QasmPeepholeStats {
+    size_t num_gates_in{0};
+    size_t num_gates_out{0};
+    size_t num_cancelled{0};
+    size_t num_merged{0};
+    size_t num_dropped{0};
+
+    [[nodiscard]] auto getDelta() const -> size_t { return num_gates_in - num_gates_out; }
+};
+
+/**
+ * The peephole stage over the recorded gates of a circuit, applied before their emission:
+ *
+ * - adjacent self-inverse gates on the same wires cancel out (e.g. `h; h` or `cnot; cnot`),
+ * - adjacent rotations (`rx`, `ry`, `rz`, `phaseshift`) and `QubitUnitary` gates on the same
+ *   wires are merged, and so are `s; s` into `z` and `t; t` into `s`,
+ * - identity gates are dropped, including rotations by a multiple of their period and identity
+ *   matrices.
+ *
+ * Two gates are adjacent if no other gate acts on any of their wires in between, and the
+ * result of a merge is emitted in place of the first gate. Gates with the `inverse` flag and
+ * gates with symbolic parameters are neither cancelled nor merged.
+ */
+class QasmPeephole {
+  private:
+    static constexpr double tolerance = 1e-10;
+
+    [[nodiscard]] static auto isSelfInverse(const std::string &name) -> bool
+    {
+        static const std::unordered_set<std::string> names = {
+            "x", "y", "z", "h", "cnot", "cy", "cz", "swap", "ccnot", "cswap"};
+        return names.contains(name);
+    }
+
+    [[nodiscard]] static auto getRotationPeriod(const std::string &name) -> double
+    {
+        // rx(2pi) = -I is only the identity up to a global phase, which `State` would expose.
+        if (name == "rx" || name == "ry" || name == "rz") {
+            return 4 * std::numbers::pi;
+        }
+        return name == "phaseshift" ? 2 * std::numbers::pi : 0.0;
+    }
+
+    [[nodiscard]] static auto hasSameWires(const QasmGate &lhs, const QasmGate &rhs) -> bool
+    {
+        auto &&lhs_wires = lhs.getWires();
+        auto &&rhs_wires = rhs.getWires();
+        if (lhs_wires == rhs_wires) {
+            return true;
+        }
+
+        // Symmetric gates only depend on the set of their wires.
+        const auto &&name = lhs.getName();
+        if (name != "cz" && name != "swap") {
+            return false;
+        }
+        std::sort(lhs_wires.begin(), lhs_wires.end());
+        std::sort(rhs_wires.begin(), rhs_wires.end());
+        return lhs_wires == rhs_wires;
+    }
+
+    [[nodiscard]] static auto isIdentity(const QasmGate &gate) -> bool
+    {
+        const auto &&name = gate.getName();
+        if (name == "i") {
+            return true;
+        }
+
+        if (name == "QubitUnitary") {
+            auto &&matrix = gate.getMatrix();
+            const size_t dim = 1UL << gate.getWires().size();
+            for (size_t row = 0; row < dim; row++) {
+                for (size_t col = 0; col < dim; col++) {
+                    const std::complex<double> expected{row == col ? 1.0 : 0.0, 0.0};
+                    if (std::abs(matrix[row * dim + col] - expected) > tolerance) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        const double period = getRotationPeriod(name);
+        auto &&params = gate.getParams();
+        return period != 0.0 && params.size() == 1 &&
+               std::abs(std::remainder(params[0], period)) < tolerance;
+    }
+
+    [[nodiscard]] static auto isInversePair(const QasmGate &prev, const QasmGate &next) -> bool
+    {
+        return !prev.getInverse() && !next.getInverse() && prev.getName() == next.getName() &&
+               isSelfInverse(next.getName()) && hasSameWires(prev, next);
+    }
+
+    [[nodiscard]] static auto merge(const QasmGate &prev, const QasmGate &next)
+        -> std::optional<QasmGate>
+    {
+        const auto &&name = next.getName();
+        if (prev.getInverse() || next.getInverse() || prev.getName() != name ||
+            prev.getWires() != next.getWires() || !prev.getParamsStr().empty() ||
+            !next.getParamsStr().empty()) {
+            return std::nullopt;
+        }
+
+        auto &&wires = next.getWires();
+        if (getRotationPeriod(name) != 0.0) {
+            const double angle = prev.getParams()[0] + next.getParams()[0];
+            return QasmGate{std::string{lookup_rt_gate_name(name)}, {angle}, {}, wires, false};
+        }
+        if (name == "s") {
+            return QasmGate{"PauliZ", {}, {}, wires, false};
+        }
+        if (name == "t") {
+            return QasmGate{"S", {}, {}, wires, false};
+        }
+        if (name == "QubitUnitary") {
+            // The matrix of `prev` is applied first.
+            auto &&lhs = next.getMatrix();
+            auto &&rhs = prev.getMatrix();
+            const size_t dim = 1UL << wires.size();
+            std::vector<std::complex<double>> matrix(dim * dim, {0.0, 0.0});
+            for (size_t row = 0; row < dim; row++) {
+                for (size_t k = 0; k < dim; k++) {
+                    for (size_t col = 0; col < dim; col++) {
+                        matrix[row * dim + col] += lhs[row * dim + k] * rhs[k * dim + col];
+                    }
+                }
+            }
+            return QasmGate{matrix, wires, false};
+        }
+        return std::nullopt;
+    }
+
+  public:
+    /**
+     * Apply the peephole stage to the given gates.
+     *
+     * @param gates The recorded gates
+     * @param stats The gate counts of the stage
+     * @return std::vector<QasmGate> The gates to emit
+     */
+    [[nodiscard]] static auto run(const std::vector<QasmGate> &gates, QasmPeepholeStats &stats)
+        -> std::vector<QasmGate>
+    {
+        stats = QasmPeepholeStats{};
+        stats.num_gates_in = gates.size();
+
+        size_t num_wires = 0;
+        for (const auto &gate : gates) {
+            for (auto wire : gate.getWires()) {
+                num_wires = std::max(num_wires, wire + 1);
+            }
+        }
+
+        // The emitted gates, and the stack of the indices of the emitted gates of each wire
+        std::vector<std::optional<QasmGate>> slots;
+        slots.reserve(gates.size());
+        std::vector<std::vector<size_t>> wire_slots(num_wires);
+
+        auto remove = [&slots, &wire_slots](size_t slot) {
+            for (auto wire : slots[slot]->getWires()) {
+                wire_slots[wire].pop_back();
+            }
+            slots[slot].reset();
+        };
+
+        // The last emitted gate acting on exactly the wires of the given gate, if any
+        auto adjacent = [&slots, &wire_slots](const QasmGate &gate) -> std::optional<size_t> {
+            auto &&wires = gate.getWires();
+            if (wires.empty() || wire_slots[wires[0]].empty()) {
+                return std::nullopt;
+            }
+
+            const size_t slot = wire_slots[wires[0]].back();
+            const bool is_adjacent =
+                slots[slot]->getWires().size() == wires.size() &&
+                std::all_of(wires.begin(), wires.end(), [&wire_slots, slot](size_t wire) {
+                    return !wire_slots[wire].empty() && wire_slots[wire].back() == slot;
+                });
+            return is_adjacent ? std::optional<size_t>{slot} : std::nullopt;
+        };
+
+        for (const auto &gate : gates) {
+            if (isIdentity(gate)) {
+                stats.num_dropped++;
+                continue;
+            }
+
+            if (auto slot = adjacent(gate)) {
+                const auto &prev = *slots[*slot];
+                if (isInversePair(prev, gate)) {
+                    remove(*slot);
+                    stats.num_cancelled += 2;
+                    continue;
+                }
+
+                if (auto merged = merge(prev, gate)) {
+                    stats.num_merged++;
+                    if (isIdentity(*merged)) {
+                        remove(*slot);
+                        stats.num_dropped++;
+                    }
+                    else {
+                        slots[*slot].emplace(std::move(*merged));
+                    }
+                    continue;
+                }
+            }
+
+            slots.emplace_back(gate);
+            for (auto wire : gate.getWires()) {
+                wire_slots[wire].push_back(slots.size() - 1);
+            }
+        }
+
+        std::vector<QasmGate> result;
+        result.reserve(slots.size());
+        for (auto &slot : slots) {
+            if (slot) {
+                result.push_back(std::move(*slot));
+            }
+        }
+        stats.num_gates_out = result.size();
+        return result;
     }
 };
 
@@ -393,25 +750,39 @@ class QasmMeasure {
     [[nodiscard]] auto getBit() const -> size_t { return bit; }
     [[nodiscard]] auto getWire() const -> size_t { return wire; }
 
-    [[nodiscard]] auto toOpenQasm(const QasmRegister &qregister,
-                                  [[maybe_unused]] const std::string &version = "3.0") const
-        -> std::string
+    void toOpenQasm(std::string &buffer, const QasmRegister &qregister,
+                    [[maybe_unused]] const std::string &version = "3.0") const
     {
         // measure wire
-        std::ostringstream oss;
-        oss << "measure " << qregister.toOpenQasm(RegisterMode::Slice, {wire}) << ";\n";
-        return oss.str();
+        buffer += "measure ";
+        qregister.toOpenQasm(buffer, RegisterMode::Slice, {wire});
+        buffer += ";\n";
+    }
+    void toOpenQasm(std::string &buffer, const QasmRegister &bregister,
+                    const QasmRegister &qregister, RegisterMode mode = RegisterMode::Slice,
+                    [[maybe_unused]] const std::string &version = "3.0") const
+    {
+        // bit = measure wire
+        bregister.toOpenQasm(buffer, mode, {bit});
+        buffer += " = measure ";
+        qregister.toOpenQasm(buffer, mode, {wire});
+        buffer += ";\n";
+    }
+
+    [[nodiscard]] auto toOpenQasm(const QasmRegister &qregister,
+                                  const std::string &version = "3.0") const -> std::string
+    {
+        std::string buffer;
+        toOpenQasm(buffer, qregister, version);
+        return buffer;
     }
     [[nodiscard]] auto toOpenQasm(const QasmRegister &bregister, const QasmRegister &qregister,
                                   RegisterMode mode = RegisterMode::Slice,
-                                  [[maybe_unused]] const std::string &version = "3.0") const
-        -> std::string
+                                  const std::string &version = "3.0") const -> std::string
     {
-        // bit = measure wire
-        std::ostringstream oss;
-        oss << bregister.toOpenQasm(mode, {bit}) << " = measure "
-            << qregister.toOpenQasm(mode, {wire}) << ";\n";
-        return oss.str();
+        std::string buffer;
+        toOpenQasm(buffer, bregister, qregister, mode, version);
+        return buffer;
     }
 };
 
@@ -536,6 +907,10 @@ class QasmTensorObs final : public QasmObs {
 
     [[nodiscard]] auto getName() const -> std::string override { return "QasmTensorObs"; }
     [[nodiscard]] auto getWires() const -> std::vector<size_t> override { return wires; }
+    [[nodiscard]] auto getObs() const -> const std::vector<std::shared_ptr<QasmObs>> &
+    {
+        return obs;
+    }
 
     [[nodiscard]] auto toOpenQasm(const QasmRegister &qregister, size_t precision = 5,
                                   const std::string &version = "3.0") const -> std::string override
@@ -598,6 +973,10 @@ class QasmHamiltonianObs final : public QasmObs {
         return wires;
     }
     [[nodiscard]] auto getCoeffs() const -> std::vector<double> { return coeffs; }
+    [[nodiscard]] auto getObs() const -> const std::vector<std::shared_ptr<QasmObs>> &
+    {
+        return obs;
+    }
 
     [[nodiscard]] auto toOpenQasm(const QasmRegister &qregister, size_t precision = 5,
                                   const std::string &version = "3.0") const -> std::string override
@@ -617,6 +996,12 @@ class QasmHamiltonianObs final : public QasmObs {
 /**
  * The OpenQasm circuit builder interface.
  *
+ * In the parametric (template) mode, the numeric parameters of gates are not serialized into the
+ * program. Each of them is declared once as an `input float[64] theta_<i>;` variable, and its
+ * value is recorded to be bound at execution time. The generated program then only depends on
+ * the structure of the circuit, which is serialized by `getStructureKey()`. The structure key is
+ * only built in this mode, and is empty otherwise.
+ *
  * @note Only one user-specified quantum register is currently supported.
  * @note User-specified measurement results registers are supported.
  *
@@ -624,6 +1009,8 @@ class QasmHamiltonianObs final : public QasmObs {
  * @param bregs Measurement results registers
  * @param gates Quantum gates
  * @param measures Quantum measures
+ * @param parametric Whether to build a parametric program template
+ * @param peephole Whether to apply the peephole stage (see `QasmPeephole`) before emission
  */
 class OpenQasmBuilder {
   protected:
@@ -635,16 +1022,116 @@ class OpenQasmBuilder {
     size_t num_qubits;
     size_t num_bits;
 
+    const bool parametric;
+    std::vector<std::pair<std::string, double>> param_values{};
+    std::string structure_key{};
+
+    // The gates to emit after the peephole stage, computed on demand
+    const bool peephole;
+    mutable std::optional<std::vector<QasmGate>> peephole_gates{};
+    mutable QasmPeepholeStats peephole_stats{};
+
+    [[nodiscard]] auto getEmittedGates() const -> const std::vector<QasmGate> &
+    {
+        if (!peephole) {
+            return gates;
+        }
+        if (!peephole_gates) {
+            peephole_gates = QasmPeephole::run(gates, peephole_stats);
+        }
+        return *peephole_gates;
+    }
+
+    /**
+     * An upper-bound estimate of the size of the program, to reserve the output buffer once.
+     */
+    [[nodiscard]] auto estimateSize(size_t precision) const -> size_t
+    {
+        size_t size = 64;
+        for (const auto &var : vars) {
+            size += var.getName().size() + 24;
+        }
+        for (const auto &reg : qregs) {
+            size += 2 * reg.getName().size() + 48;
+        }
+        for (const auto &reg : bregs) {
+            size += reg.getName().size() + 32;
+        }
+        if (!qregs.empty()) {
+            for (const auto &gate : gates) {
+                size += gate.estimateSize(qregs[0], precision);
+            }
+            size += measures.size() * (2 * qregs[0].getName().size() + 64);
+        }
+        return size;
+    }
+
+    /**
+     * Append a field of the structure of the circuit to its key. Strings are length-prefixed
+     * and other values are appended as their bytes, so that different circuits never share a
+     * key.
+     */
+    template <typename T> void appendStructure(const T &value)
+    {
+        if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+            const std::string_view text{value};
+            structure_key += std::to_string(text.size());
+            structure_key += ':';
+            structure_key += text;
+        }
+        else {
+            static_assert(std::is_trivially_copyable_v<T>);
+            structure_key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+    }
+
   public:
-    explicit OpenQasmBuilder() : num_qubits(0), num_bits(0) {}
+    explicit OpenQasmBuilder(bool _parametric = false, bool _peephole = false)
+        : num_qubits(0), num_bits(0), parametric(_parametric), peephole(_peephole)
+    {
+    }
     virtual ~OpenQasmBuilder() = default;
 
     [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits; }
     [[nodiscard]] auto getNumBits() const -> size_t { return num_bits; }
     [[nodiscard]] auto getQubits() const -> std::vector<QasmRegister> { return qregs; }
+    [[nodiscard]] auto isParametric() const -> bool { return parametric; }
+    [[nodiscard]] auto getStructureKey() const -> const std::string & { return structure_key; }
+    [[nodiscard]] auto isPeephole() const -> bool { return peephole; }
+
+    /**
+     * Get the gate counts of the peephole stage for the recorded gates. Without the peephole
+     * stage, all recorded gates are emitted.
+     */
+    [[nodiscard]] auto getPeepholeStats() const -> QasmPeepholeStats
+    {
+        if (!peephole) {
+            return QasmPeepholeStats{gates.size(), gates.size()};
+        }
+        if (!peephole_gates) {
+            peephole_gates = QasmPeephole::run(gates, peephole_stats);
+        }
+        return peephole_stats;
+    }
+
+    /**
+     * Get the values of the parameters declared by the parametric mode, in declaration order.
+     */
+    [[nodiscard]] auto getParameterValues() const
+        -> const std::vector<std::pair<std::string, double>> &
+    {
+        return param_values;
+    }
 
     void Register(RegisterType type, const std::string &name, size_t size)
     {
+        if (parametric) {
+            appendStructure(std::string_view{"Register"});
+            appendStructure(static_cast<uint8_t>(type));
+            appendStructure(name);
+            appendStructure(size);
+        }
+
         switch (type) {
         case RegisterType::Qubit:
             qregs.emplace_back(type, name, size);
@@ -663,18 +1150,77 @@ class OpenQasmBuilder {
               const std::vector<std::string> &params_str, const std::vector<size_t> &wires,
               [[maybe_unused]] bool inverse)
     {
+        peephole_gates.reset();
+        if (parametric) {
+            appendStructure(std::string_view{"Gate"});
+            appendStructure(name);
+            appendStructure(wires.size());
+            for (auto wire : wires) {
+                appendStructure(wire);
+            }
+            appendStructure(inverse);
+            appendStructure(params_val.size());
+            appendStructure(params_str.size());
+        }
+
+        if (parametric && !params_val.empty()) {
+            RT_FAIL_IF(!params_str.empty(),
+                       "Parametric gates are currently supported via either their values or "
+                       "names but not both.");
+
+            std::vector<std::string> params_names;
+            params_names.reserve(params_val.size());
+            for (auto param : params_val) {
+                params_names.push_back("theta_" + std::to_string(param_values.size()));
+                param_values.emplace_back(params_names.back(), param);
+                vars.emplace_back(VariableType::Float64, params_names.back());
+                appendStructure(params_names.back());
+            }
+
+            gates.emplace_back(name, std::vector<double>{}, params_names, wires, inverse);
+            return;
+        }
+
         gates.emplace_back(name, params_val, params_str, wires, inverse);
 
         for (auto &param : params_str) {
+            if (parametric) {
+                appendStructure(param);
+            }
             vars.emplace_back(VariableType::Float, param);
         }
     }
     void Gate(const std::vector<std::complex<double>> &matrix, const std::vector<size_t> &wires,
               [[maybe_unused]] bool inverse)
     {
+        peephole_gates.reset();
+        if (parametric) {
+            // The matrix is emitted as is, so its entries are part of the structure
+            appendStructure(std::string_view{"QubitUnitary"});
+            appendStructure(matrix.size());
+            for (const auto &c : matrix) {
+                appendStructure(c.real());
+                appendStructure(c.imag());
+            }
+            appendStructure(wires.size());
+            for (auto wire : wires) {
+                appendStructure(wire);
+            }
+            appendStructure(inverse);
+        }
+
         gates.emplace_back(matrix, wires, inverse);
     }
-    void Measure(size_t bit, size_t wire) { measures.emplace_back(bit, wire); }
+    void Measure(size_t bit, size_t wire)
+    {
+        if (parametric) {
+            appendStructure(std::string_view{"Measure"});
+            appendStructure(bit);
+            appendStructure(wire);
+        }
+
+        measures.emplace_back(bit, wire);
+    }
 
     [[nodiscard]] virtual auto toOpenQasm(size_t precision = 5,
                                           const std::string &version = "3.0") const -> std::string
@@ -686,47 +1232,50 @@ class OpenQasmBuilder {
                    "Invalid number of measurement results registers; At most one measurement"
                    "results register is currently supported.");
 
-        std::ostringstream oss;
+        std::string buffer;
+        buffer.reserve(estimateSize(precision));
 
         // header
-        oss << "OPENQASM " << version << ";\n";
+        buffer += "OPENQASM ";
+        buffer += version;
+        buffer += ";\n";
 
         // variables
         for (auto &var : vars) {
-            oss << var.toOpenQasm();
+            var.toOpenQasm(buffer);
         }
 
         // quantum registers
         for (auto &qreg : qregs) {
-            oss << qreg.toOpenQasm(RegisterMode::Alloc);
+            qreg.toOpenQasm(buffer, RegisterMode::Alloc);
         }
 
         // measurement results registers
         for (auto &breg : bregs) {
-            oss << breg.toOpenQasm(RegisterMode::Alloc);
+            breg.toOpenQasm(buffer, RegisterMode::Alloc);
         }
 
         // quantum gates assuming qregs.size() == 1
-        for (auto &gate : gates) {
-            oss << gate.toOpenQasm(qregs[0], precision);
+        for (auto &gate : getEmittedGates()) {
+            gate.toOpenQasm(buffer, qregs[0], precision);
         }
 
         // quantum measures assuming qregs.size() == 1, bregs.size() <= 1
         for (auto &m : measures) {
             if (bregs.empty()) {
-                oss << m.toOpenQasm(qregs[0]);
+                m.toOpenQasm(buffer, qregs[0]);
             }
             else {
-                oss << m.toOpenQasm(bregs[0], qregs[0]);
+                m.toOpenQasm(buffer, bregs[0], qregs[0]);
             }
         }
 
         // reset quantum registers
         for (auto &qreg : qregs) {
-            oss << qreg.toOpenQasm(RegisterMode::Reset);
+            qreg.toOpenQasm(buffer, RegisterMode::Reset);
         }
 
-        return oss.str();
+        return buffer;
     }
 
     [[nodiscard]] virtual auto
@@ -763,34 +1312,37 @@ class BraketBuilder : public OpenQasmBuilder {
             "Invalid number of measurement results registers; User-specified measurement results "
             "register is not currently supported.");
 
-        std::ostringstream oss;
+        std::string buffer;
+        buffer.reserve(estimateSize(precision));
 
         // header
-        oss << "OPENQASM " << version << ";\n";
+        buffer += "OPENQASM ";
+        buffer += version;
+        buffer += ";\n";
 
         // variables
         for (auto &var : vars) {
-            oss << var.toOpenQasm();
+            var.toOpenQasm(buffer);
         }
 
         // quantum registers
-        oss << qregs[0].toOpenQasm(RegisterMode::Alloc, {}, version);
+        qregs[0].toOpenQasm(buffer, RegisterMode::Alloc, {}, version);
 
         // measurement results registers
         QasmRegister braket_mresults{RegisterType::Bit, "bits", qregs[0].getSize()};
-        oss << braket_mresults.toOpenQasm(RegisterMode::Alloc, {}, version);
+        braket_mresults.toOpenQasm(buffer, RegisterMode::Alloc, {}, version);
 
         // quantum gates assuming qregs.size() == 1
-        for (auto &gate : gates) {
-            oss << gate.toOpenQasm(qregs[0], precision, version);
+        for (auto &gate : getEmittedGates()) {
+            gate.toOpenQasm(buffer, qregs[0], precision, version);
         }
 
         // quantum measures assuming bregs[0].size() == qregs[0].size()
         // and "mresults" isn't a user-specified register.
         QasmMeasure braket_measure{0, 0};
-        oss << braket_measure.toOpenQasm(braket_mresults, qregs[0], RegisterMode::Name, version);
+        braket_measure.toOpenQasm(buffer, braket_mresults, qregs[0], RegisterMode::Name, version);
 
-        return oss.str();
+        return buffer;
     }
 
     [[nodiscard]] auto toOpenQasmWithCustomInstructions(const std::string &serialized_instructions,
@@ -806,22 +1358,30 @@ class BraketBuilder : public OpenQasmBuilder {
             "Invalid number of measurement results registers; User-specified measurement results "
             "register is not currently supported.");
 
-        std::ostringstream oss;
+        std::string buffer;
+        buffer.reserve(estimateSize(precision) + serialized_instructions.size());
 
         // header
-        oss << "OPENQASM " << version << ";\n";
+        buffer += "OPENQASM ";
+        buffer += version;
+        buffer += ";\n";
+
+        // variables
+        for (auto &var : vars) {
+            var.toOpenQasm(buffer);
+        }
 
         // quantum registers
-        oss << qregs[0].toOpenQasm(RegisterMode::Alloc, {}, version);
+        qregs[0].toOpenQasm(buffer, RegisterMode::Alloc, {}, version);
 
         // quantum gates assuming qregs.size() == 1
-        for (auto &gate : gates) {
-            oss << gate.toOpenQasm(qregs[0], precision, version);
+        for (auto &gate : getEmittedGates()) {
+            gate.toOpenQasm(buffer, qregs[0], precision, version);
         }
 
-        oss << serialized_instructions;
+        buffer += serialized_instructions;
 
-        return oss.str();
+        return buffer;
     }
 };
 
@@ -39,15 +39,106 @@ auto OpenQasmDevice::AllocateQubits(size_t num_qubits) -> std::vector<QubitIdTyp
 
 void OpenQasmDevice::ReleaseAllQubits()
 {
+    deferred_measurements.clear();
+
     // refresh the builder for device re-use.
     if (builder_type != OpenQasm::BuilderType::Common) {
-        builder = std::make_unique<OpenQasm::BraketBuilder>();
+        builder = std::make_unique<OpenQasm::BraketBuilder>(parametric, peephole);
     }
     else {
         builder = std::make_unique<OpenQasm::OpenQasmBuilder>();
     }
 }
 
+auto OpenQasmDevice::getCachedProgram(std::string key, const std::function<std::string()> &generate)
+    -> std::string
+{
+    if (!parametric) {
+        return generate();
+    }
+
+    // Parameter values are bound at execution time, so the program only depends on the structure.
+    key += builder->getStructureKey();
+
+    if (auto it = program_index.find(key); it != program_index.end()) {
+        program_cache.splice(program_cache.begin(), program_cache, it->second);
+        program_cache_hits++;
+        return it->second->second;
+    }
+
+    if (program_cache.size() >= program_cache_capacity) {
+        program_index.erase(program_cache.back().first);
+        program_cache.pop_back();
+    }
+    program_cache.emplace_front(std::move(key), generate());
+    program_index.emplace(program_cache.front().first, program_cache.begin());
+    return program_cache.front().second;
+}
+
+auto OpenQasmDevice::getCircuit() -> std::string
+{
+    return getCachedProgram("circuit;", [this]() { return builder->toOpenQasm(); });
+}
+
+auto OpenQasmDevice::getCircuitWithCustomInstructions(const std::string &instructions,
+                                                      size_t precision) -> std::string
+{
+    // The instructions are length-prefixed to be separated from the structure of the circuit
+    std::string key = "custom;" + std::to_string(precision) + ";" +
+                      std::to_string(instructions.size()) + ";" + instructions;
+    return getCachedProgram(std::move(key), [this, &instructions, precision]() {
+        return builder->toOpenQasmWithCustomInstructions(instructions, precision);
+    });
+}
+
+auto OpenQasmDevice::getCacheKey(std::string_view kind, const std::string &circuit) const
+    -> std::string
+{
+    if (!isResultCached()) {
+        return {};
+    }
+    return OpenQasm::QasmResultCache::digest(
+        {kind, getDeviceInfo(), getS3DestinationFolder(), getInputs(), circuit});
+}
+
+auto OpenQasmDevice::runCached(std::string_view kind, const std::string &circuit,
+                               const std::function<std::vector<double>()> &run)
+    -> std::vector<double>
+{
+    const auto &&key = getCacheKey(kind, circuit);
+    if (key.empty()) {
+        return run();
+    }
+
+    if (auto values = result_cache->lookup(key)) {
+        return std::move(*values);
+    }
+
+    auto &&values = run();
+    result_cache->insert(key, values);
+    return values;
+}
+
+auto OpenQasmDevice::getPackedSamples() -> std::vector<uint64_t>
+{
+    const size_t numQubits = GetNumQubits();
+    RT_FAIL_IF(numQubits > max_packed_qubits, "Unable to pack the samples of more than 64 qubits");
+
+    auto &&packed = runner->PackedSample(getCircuit(), getDeviceInfo(), device_shots, numQubits,
+                                         getS3DestinationFolder(), getInputs());
+    RT_FAIL_IF(packed.size() != device_shots, "Invalid number of samples");
+    return packed;
+}
+
+auto OpenQasmDevice::getSamples() -> std::vector<size_t>
+{
+    const size_t numQubits = GetNumQubits();
+    auto &&samples = runner->Sample(getCircuit(), getDeviceInfo(), device_shots, numQubits,
+                                    getS3DestinationFolder(), getInputs());
+    RT_FAIL_IF(samples.size() != device_shots * numQubits, "Invalid number of samples");
+    return samples;
+}
+
 auto OpenQasmDevice::GetNumQubits() const -> size_t { return builder->getNumQubits(); }
 
 void OpenQasmDevice::SetDeviceShots(size_t shots) { device_shots = shots; }
@@ -125,27 +216,32 @@ auto OpenQasmDevice::Expval(ObsIdType obsKey) -> double
     RT_ASSERT(builder->getQubits().size());
     RT_FAIL_IF(!obs_manager.isValidObservables({obsKey}), "Invalid key for cached observables");
     auto &&obs = obs_manager.getObservable(obsKey);
-    RT_FAIL_IF(obs->getName() == "QasmHamiltonianObs",
-               "Unsupported observable: QasmHamiltonianObs");
 
-    std::ostringstream oss;
-    oss << "#pragma braket result expectation " << obs->toOpenQasm(builder->getQubits()[0]);
-    auto &&circuit = builder->toOpenQasmWithCustomInstructions(oss.str(), 9);
-
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
-    }
+    // Hamiltonians are computed from the expectation values of their terms, all of which
+    // are batched into a single submission per group of compatible terms.
+    if (obs->getName() == "QasmHamiltonianObs") {
+        auto &&hamiltonian = std::static_pointer_cast<OpenQasm::QasmHamiltonianObs>(obs);
+        auto &&coeffs = hamiltonian->getCoeffs();
+        auto &&terms = hamiltonian->getObs();
+
+        MeasurementBatchJob job{createMeasurementBatch()};
+        job.slots.reserve(terms.size());
+        for (const auto &term : terms) {
+            job.slots.push_back(job.batch.add(MeasurementsT::Expval, *term));
+        }
+        executeMeasurementBatch(job);
 
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
+        double expval{0.0};
+        for (size_t idx = 0; idx < job.slots.size(); idx++) {
+            expval += coeffs[idx] * job.batch.getResult(job.slots[idx]);
+        }
+        return expval;
     }
 
-    return runner->Expval(circuit, device_info, device_shots, s3_folder_str);
+    MeasurementBatchJob job{createMeasurementBatch()};
+    auto slot = job.batch.add(MeasurementsT::Expval, *obs);
+    executeMeasurementBatch(job);
+    return job.batch.getResult(slot);
 }
 
 auto OpenQasmDevice::Var(ObsIdType obsKey) -> double
@@ -156,75 +252,195 @@ auto OpenQasmDevice::Var(ObsIdType obsKey) -> double
     RT_FAIL_IF(obs->getName() == "QasmHamiltonianObs",
                "Unsupported observable: QasmHamiltonianObs");
 
-    std::ostringstream oss;
-    oss << "#pragma braket result variance " << obs->toOpenQasm(builder->getQubits()[0]);
-    auto &&circuit = builder->toOpenQasmWithCustomInstructions(oss.str(), 9);
+    MeasurementBatchJob job{createMeasurementBatch()};
+    auto slot = job.batch.add(MeasurementsT::Var, *obs);
+    executeMeasurementBatch(job);
+    return job.batch.getResult(slot);
+}
 
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
-    }
+auto OpenQasmDevice::createMeasurementBatch() const -> OpenQasm::QasmMeasurementBatch
+{
+    RT_FAIL_IF(builder_type == OpenQasm::BuilderType::Common, "Unsupported functionality");
+    return OpenQasm::QasmMeasurementBatch{builder->getQubits()[0], device_shots == 0};
+}
 
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
+void OpenQasmDevice::submitMeasurementBatch(MeasurementBatchJob &job)
+{
+    const auto &&s3_folder_str = getS3DestinationFolder();
+    const auto &&device_info = getDeviceInfo();
+    const auto &&inputs = getInputs();
+
+    // All groups are in flight at once; none of them is waited for here.
+    const size_t num_groups = job.batch.getNumGroups();
+    job.jobs.reserve(num_groups);
+    job.cache_keys.reserve(num_groups);
+    for (size_t group = 0; group < num_groups; group++) {
+        auto &&circuit =
+            getCircuitWithCustomInstructions(job.batch.getGroupInstructions(group), 9);
+
+        auto &&key = getCacheKey("values", circuit);
+        std::optional<std::vector<double>> cached{};
+        if (!key.empty()) {
+            cached = result_cache->lookup(key);
+        }
+
+        if (cached) {
+            job.jobs.push_back(OpenQasm::QasmJob::fromValues(std::move(*cached)));
+            job.cache_keys.emplace_back();
+        }
+        else {
+            job.jobs.push_back(
+                runner->SubmitValues(circuit, device_info, device_shots, s3_folder_str, inputs));
+            job.cache_keys.push_back(std::move(key));
+        }
     }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
+}
+
+void OpenQasmDevice::collectMeasurementBatch(MeasurementBatchJob &job)
+{
+    for (size_t group = 0; group < job.jobs.size(); group++) {
+        const auto &values = job.jobs[group].getValues();
+        job.batch.setGroupValues(group, values);
+        if (!job.cache_keys[group].empty()) {
+            result_cache->insert(job.cache_keys[group], values);
+        }
     }
+}
 
-    return runner->Var(circuit, device_info, device_shots, s3_folder_str);
+void OpenQasmDevice::executeMeasurementBatch(MeasurementBatchJob &job)
+{
+    submitMeasurementBatch(job);
+    collectMeasurementBatch(job);
 }
 
-void OpenQasmDevice::State(DataView<std::complex<double>, 1> &state)
+auto OpenQasmDevice::DeferExpval(ObsIdType obsKey) -> size_t
 {
-    std::ostringstream oss;
-    oss << "#pragma braket result state_vector";
-    auto &&circuit = builder->toOpenQasmWithCustomInstructions(oss.str());
+    RT_FAIL_IF(!obs_manager.isValidObservables({obsKey}), "Invalid key for cached observables");
+    RT_FAIL_IF(obs_manager.getObservable(obsKey)->getName() == "QasmHamiltonianObs",
+               "Unsupported observable to defer: QasmHamiltonianObs");
+    deferred_measurements.emplace_back(MeasurementsT::Expval, obsKey);
+    return deferred_measurements.size() - 1;
+}
 
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
-    }
+auto OpenQasmDevice::DeferVar(ObsIdType obsKey) -> size_t
+{
+    RT_FAIL_IF(!obs_manager.isValidObservables({obsKey}), "Invalid key for cached observables");
+    RT_FAIL_IF(obs_manager.getObservable(obsKey)->getName() == "QasmHamiltonianObs",
+               "Unsupported observable to defer: QasmHamiltonianObs");
+    deferred_measurements.emplace_back(MeasurementsT::Var, obsKey);
+    return deferred_measurements.size() - 1;
+}
 
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
+auto OpenQasmDevice::ExecuteDeferred() -> std::vector<double>
+{
+    return CollectDeferred(SubmitDeferred());
+}
+
+auto OpenQasmDevice::SubmitDeferred() -> size_t
+{
+    RT_ASSERT(builder->getQubits().size());
+
+    MeasurementBatchJob job{createMeasurementBatch()};
+    job.slots.reserve(deferred_measurements.size());
+    for (auto &&[type, obsKey] : deferred_measurements) {
+        job.slots.push_back(job.batch.add(type, *obs_manager.getObservable(obsKey)));
     }
+    deferred_measurements.clear();
 
-    auto &&dv_state =
-        runner->State(circuit, device_info, device_shots, GetNumQubits(), s3_folder_str);
-    RT_FAIL_IF(state.size() != dv_state.size(), "Invalid size for the pre-allocated state vector");
+    submitMeasurementBatch(job);
 
-    std::move(dv_state.begin(), dv_state.end(), state.begin());
+    const size_t job_id = next_job_id++;
+    pending_jobs.emplace(job_id, std::move(job));
+    return job_id;
 }
 
-void OpenQasmDevice::Probs(DataView<double, 1> &probs)
+auto OpenQasmDevice::IsDeferredReady(size_t job_id) -> bool
 {
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
+    auto it = pending_jobs.find(job_id);
+    RT_FAIL_IF(it == pending_jobs.end(), "Invalid job id of the deferred measurements");
+
+    auto &&jobs = it->second.jobs;
+    return std::all_of(jobs.begin(), jobs.end(),
+                       [](const OpenQasm::QasmJob &job) { return job.isReady(); });
+}
+
+auto OpenQasmDevice::CollectDeferred(size_t job_id) -> std::vector<double>
+{
+    auto it = pending_jobs.find(job_id);
+    RT_FAIL_IF(it == pending_jobs.end(), "Invalid job id of the deferred measurements");
+
+    // The job is released even if its execution failed.
+    auto job = std::move(it->second);
+    pending_jobs.erase(it);
+
+    collectMeasurementBatch(job);
+
+    std::vector<double> results;
+    results.reserve(job.slots.size());
+    for (auto slot : job.slots) {
+        results.push_back(job.batch.getResult(slot));
     }
+    return results;
+}
 
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
+void OpenQasmDevice::State(DataView<std::complex<double>, 1> &state)
+{
+    std::ostringstream oss;
+    oss << "#pragma braket result state_vector";
+    auto &&circuit = getCircuitWithCustomInstructions(oss.str());
+
+    const auto &&s3_folder_str = getS3DestinationFolder();
+    const auto &&device_info = getDeviceInfo();
+
+    // The state is cached as interleaved real and imaginary parts.
+    auto &&dv_state = runCached("state", circuit, [&]() {
+        auto &&res = runner->State(circuit, device_info, device_shots, GetNumQubits(),
+                                   s3_folder_str, getInputs());
+        std::vector<double> values;
+        values.reserve(2 * res.size());
+        for (const auto &c : res) {
+            values.push_back(c.real());
+            values.push_back(c.imag());
+        }
+        return values;
+    });
+    RT_FAIL_IF(2 * state.size() != dv_state.size(),
+               "Invalid size for the pre-allocated state vector");
+
+    auto stateIter = state.begin();
+    for (size_t idx = 0; idx < dv_state.size(); idx += 2) {
+        *(stateIter++) = {dv_state[idx], dv_state[idx + 1]};
     }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
+}
+
+void OpenQasmDevice::computeProbs(DataView<double, 1> &probs, const std::string &circuit,
+                                  size_t num_wires)
+{
+    const auto &&s3_folder_str = getS3DestinationFolder();
+    const auto &&device_info = getDeviceInfo();
+
+    // Uncached probabilities are written directly into the caller's buffer when possible.
+    if (!isResultCached() && probs.isContiguous()) {
+        runner->ProbsInto(probs.data(), probs.size(), circuit, device_info, device_shots,
+                          num_wires, s3_folder_str, getInputs());
+        return;
     }
 
-    auto &&dv_probs = runner->Probs(builder->toOpenQasm(), device_info, device_shots,
-                                    GetNumQubits(), s3_folder_str);
+    auto &&dv_probs = runCached("probs", circuit, [&]() {
+        return runner->Probs(circuit, device_info, device_shots, num_wires, s3_folder_str,
+                             getInputs());
+    });
 
     RT_FAIL_IF(probs.size() != dv_probs.size(), "Invalid size for the pre-allocated probabilities");
 
     std::move(dv_probs.begin(), dv_probs.end(), probs.begin());
 }
 
+void OpenQasmDevice::Probs(DataView<double, 1> &probs)
+{
+    computeProbs(probs, getCircuit(), GetNumQubits());
+}
+
 void OpenQasmDevice::PartialProbs(DataView<double, 1> &probs, const std::vector<QubitIdType> &wires)
 {
     // get device wires
@@ -233,54 +449,37 @@ void OpenQasmDevice::PartialProbs(DataView<double, 1> &probs, const std::vector<
     std::ostringstream oss;
     oss << "#pragma braket result probability "
         << builder->getQubits()[0].toOpenQasm(OpenQasm::RegisterMode::Slice, dev_wires);
-    auto &&circuit = builder->toOpenQasmWithCustomInstructions(oss.str());
-
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
-    }
-
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
-    }
-
-    auto &&dv_probs =
-        runner->Probs(circuit, device_info, device_shots, wires.size(), s3_folder_str);
 
-    RT_FAIL_IF(probs.size() != dv_probs.size(), "Invalid size for the pre-allocated probabilities");
-
-    std::move(dv_probs.begin(), dv_probs.end(), probs.begin());
+    computeProbs(probs, getCircuitWithCustomInstructions(oss.str()), wires.size());
 }
 
 void OpenQasmDevice::Sample(DataView<double, 2> &samples)
 {
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
-    }
+    const size_t numQubits = GetNumQubits();
 
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
+    // The samples are written directly into the caller's buffer when possible.
+    if (samples.isContiguous()) {
+        runner->SampleInto(samples.data(), samples.size(), getCircuit(), getDeviceInfo(),
+                           device_shots, numQubits, getS3DestinationFolder(), getInputs());
+        return;
     }
 
-    auto &&li_samples = runner->Sample(builder->toOpenQasm(), device_info, device_shots,
-                                       GetNumQubits(), s3_folder_str);
-    RT_FAIL_IF(samples.size() != li_samples.size(), "Invalid size for the pre-allocated samples");
+    if (numQubits > max_packed_qubits) {
+        auto &&bits = getSamples();
+        RT_FAIL_IF(samples.size() != bits.size(), "Invalid size for the pre-allocated samples");
+        std::transform(bits.begin(), bits.end(), samples.begin(),
+                       [](size_t bit) { return static_cast<double>(bit); });
+        return;
+    }
 
-    const size_t numQubits = GetNumQubits();
+    auto &&packed = getPackedSamples();
+    RT_FAIL_IF(samples.size() != packed.size() * numQubits,
+               "Invalid size for the pre-allocated samples");
 
     auto samplesIter = samples.begin();
-    for (size_t shot = 0; shot < device_shots; shot++) {
-        for (size_t wire = 0; wire < numQubits; wire++) {
-            *(samplesIter++) = static_cast<double>(li_samples[shot * numQubits + wire]);
+    for (auto state : packed) {
+        for (size_t shift = numQubits; shift-- > 0;) {
+            *(samplesIter++) = static_cast<double>((state >> shift) & 1U);
         }
     }
 }
@@ -296,29 +495,24 @@ void OpenQasmDevice::PartialSample(DataView<double, 2> &samples,
     RT_FAIL_IF(samples.size() != device_shots * numWires,
                "Invalid size for the pre-allocated partial-samples");
 
-    // // get device wires
     auto &&dev_wires = getDeviceWires(wires);
+    auto samplesIter = samples.begin();
 
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
-    }
-
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
+    if (numQubits > max_packed_qubits) {
+        auto &&bits = getSamples();
+        for (size_t shot = 0; shot < device_shots; shot++) {
+            for (auto wire : dev_wires) {
+                *(samplesIter++) = static_cast<double>(bits[shot * numQubits + wire]);
+            }
+        }
+        return;
     }
 
-    auto &&li_samples = runner->Sample(builder->toOpenQasm(), device_info, device_shots,
-                                       GetNumQubits(), s3_folder_str);
-
-    auto samplesIter = samples.begin();
-    for (size_t shot = 0; shot < device_shots; shot++) {
-        for (auto wire : dev_wires) {
-            *(samplesIter++) = static_cast<double>(li_samples[shot * numQubits + wire]);
+    auto &&shifts = getWireShifts(dev_wires);
+    auto &&packed = getPackedSamples();
+    for (auto state : packed) {
+        for (auto shift : shifts) {
+            *(samplesIter++) = static_cast<double>((state >> shift) & 1U);
         }
     }
 }
@@ -326,38 +520,20 @@ void OpenQasmDevice::PartialSample(DataView<double, 2> &samples,
 void OpenQasmDevice::Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts)
 {
     const size_t numQubits = GetNumQubits();
-    const size_t numElements = 1U << numQubits;
+    RT_FAIL_IF(numQubits > max_packed_qubits, "Unable to count the samples of more than 64 qubits");
+    const size_t numElements = 1UL << numQubits;
 
     RT_FAIL_IF(eigvals.size() != numElements || counts.size() != numElements,
                "Invalid size for the pre-allocated counts");
 
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
+    // The packed samples are the indices of the measured basis states.
+    std::vector<int64_t> histogram(numElements, 0);
+    for (auto state : getPackedSamples()) {
+        histogram[state]++;
     }
 
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
-    }
-
-    auto &&li_samples = runner->Sample(builder->toOpenQasm(), device_info, device_shots,
-                                       GetNumQubits(), s3_folder_str);
-
     std::iota(eigvals.begin(), eigvals.end(), 0);
-    std::fill(counts.begin(), counts.end(), 0);
-
-    for (size_t shot = 0; shot < device_shots; shot++) {
-        std::bitset<52> basisState; // only 52 bits of precision in a double, TODO: improve
-        size_t idx = numQubits;
-        for (size_t wire = 0; wire < numQubits; wire++) {
-            basisState[--idx] = li_samples[shot * numQubits + wire];
-        }
-        counts(static_cast<size_t>(basisState.to_ulong())) += 1;
-    }
+    std::copy(histogram.begin(), histogram.end(), counts.begin());
 }
 
 void OpenQasmDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
@@ -365,7 +541,7 @@ void OpenQasmDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_
 {
     const size_t numWires = wires.size();
     const size_t numQubits = GetNumQubits();
-    const size_t numElements = 1U << numWires;
+    const size_t numElements = 1UL << numWires;
 
     RT_FAIL_IF(numWires > numQubits, "Invalid number of wires");
     RT_FAIL_IF(!isValidQubits(wires), "Invalid given wires to measure");
@@ -373,34 +549,50 @@ void OpenQasmDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_
                "Invalid size for the pre-allocated partial-counts");
 
     auto &&dev_wires = getDeviceWires(wires);
+    std::vector<int64_t> histogram(numElements, 0);
+
+    if (numQubits > max_packed_qubits) {
+        auto &&bits = getSamples();
+        for (size_t shot = 0; shot < device_shots; shot++) {
+            size_t index = 0;
+            for (auto wire : dev_wires) {
+                index = (index << 1) | bits[shot * numQubits + wire];
+            }
+            histogram[index]++;
+        }
 
-    std::string s3_folder_str{};
-    if (device_kwargs.contains("s3_destination_folder")) {
-        s3_folder_str = device_kwargs["s3_destination_folder"];
+        std::iota(eigvals.begin(), eigvals.end(), 0);
+        std::copy(histogram.begin(), histogram.end(), counts.begin());
+        return;
     }
 
-    std::string device_info{};
-    if (builder_type == OpenQasm::BuilderType::BraketRemote) {
-        device_info = device_kwargs["device_arn"];
-    }
-    else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
-        device_info = device_kwargs["backend"];
-    }
+    auto &&shifts = getWireShifts(dev_wires);
+    auto &&packed = getPackedSamples();
 
-    auto &&li_samples = runner->Sample(builder->toOpenQasm(), device_info, device_shots,
-                                       GetNumQubits(), s3_folder_str);
-
-    std::iota(eigvals.begin(), eigvals.end(), 0);
-    std::fill(counts.begin(), counts.end(), 0);
+    // Measuring a leading range of wires in order only drops the trailing bits of each sample.
+    bool isLeadingRange = true;
+    for (size_t idx = 0; isLeadingRange && idx < numWires; idx++) {
+        isLeadingRange = (dev_wires[idx] == idx);
+    }
 
-    for (size_t shot = 0; shot < device_shots; shot++) {
-        std::bitset<52> basisState; // only 52 bits of precision in a double, TODO: improve
-        size_t idx = dev_wires.size();
-        for (auto wire : dev_wires) {
-            basisState[--idx] = li_samples[shot * numQubits + wire];
+    if (isLeadingRange) {
+        const size_t shift = numQubits - numWires;
+        for (auto state : packed) {
+            histogram[state >> shift]++;
+        }
+    }
+    else {
+        for (auto state : packed) {
+            size_t index = 0;
+            for (auto shift : shifts) {
+                index = (index << 1) | ((state >> shift) & 1U);
+            }
+            histogram[index]++;
         }
-        counts(static_cast<size_t>(basisState.to_ulong())) += 1;
     }
+
+    std::iota(eigvals.begin(), eigvals.end(), 0);
+    std::copy(histogram.begin(), histogram.end(), counts.begin());
 }
 
 auto OpenQasmDevice::Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result
@@ -17,10 +17,14 @@
 #define __device_openqasm
 
 #include <algorithm>
-#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <list>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -28,7 +32,11 @@
 #include "QubitManager.hpp"
 
 #include "OpenQasmBuilder.hpp"
+#include "OpenQasmJob.hpp"
+#include "OpenQasmMeasurementBatch.hpp"
+#include "OpenQasmNativeRunner.hpp"
 #include "OpenQasmObsManager.hpp"
+#include "OpenQasmResultCache.hpp"
 #include "OpenQasmRunner.hpp"
 
 namespace Catalyst::Runtime::Device {
@@ -36,14 +44,45 @@ class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
   private:
     Catalyst::Runtime::QubitManager<QubitIdType, size_t> qubit_manager{};
     std::unique_ptr<OpenQasm::OpenQasmBuilder> builder;
-    std::unique_ptr<OpenQasm::OpenQasmRunner> runner;
+    std::shared_ptr<OpenQasm::OpenQasmRunner> runner;
 
-    size_t device_shots;
+    size_t device_shots{0};
 
     OpenQasm::OpenQasmObsManager obs_manager{};
     OpenQasm::BuilderType builder_type;
     std::unordered_map<std::string, std::string> device_kwargs;
 
+    std::vector<std::pair<MeasurementsT, ObsIdType>> deferred_measurements{};
+
+    // Peephole stage of the builder, enabled by the `peephole` device kwarg
+    bool peephole{false};
+
+    // Parametric program templates, keyed by the serialized structure of the circuit and the
+    // measurement instructions, with the most recently used first. The index refers to the keys
+    // stored in the list, whose nodes never move.
+    bool parametric{false};
+    using ProgramEntryT = std::pair<std::string, std::string>;
+    std::list<ProgramEntryT> program_cache{};
+    std::unordered_map<std::string_view, std::list<ProgramEntryT>::iterator> program_index{};
+    static constexpr size_t program_cache_capacity = 128;
+    size_t program_cache_hits{0};
+
+    // Results of the analytic executions, enabled by the `result_cache_size` and/or
+    // `result_cache_dir` device kwargs.
+    std::unique_ptr<OpenQasm::QasmResultCache> result_cache{};
+    static constexpr size_t result_cache_default_capacity = 128;
+
+    // A measurement batch with one runner job per group of the batch. The batches submitted by
+    // `SubmitDeferred` are kept until collected.
+    struct MeasurementBatchJob {
+        OpenQasm::QasmMeasurementBatch batch;
+        std::vector<size_t> slots;
+        std::vector<OpenQasm::QasmJob> jobs;
+        std::vector<std::string> cache_keys;
+    };
+    std::unordered_map<size_t, MeasurementBatchJob> pending_jobs{};
+    size_t next_job_id{0};
+
     inline auto getDeviceWires(const std::vector<QubitIdType> &wires) -> std::vector<size_t>
     {
         std::vector<size_t> res;
@@ -53,6 +92,62 @@ class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
         return res;
     }
 
+    inline auto getDeviceInfo() const -> std::string
+    {
+        if (builder_type == OpenQasm::BuilderType::BraketRemote) {
+            return device_kwargs.at("device_arn");
+        }
+        else if (builder_type == OpenQasm::BuilderType::BraketLocal) {
+            return device_kwargs.at("backend");
+        }
+        return {};
+    }
+
+    inline auto getS3DestinationFolder() const -> std::string
+    {
+        auto it = device_kwargs.find("s3_destination_folder");
+        return it != device_kwargs.end() ? it->second : std::string{};
+    }
+
+    auto getCircuit() -> std::string;
+    auto getCircuitWithCustomInstructions(const std::string &, size_t = 5) -> std::string;
+    auto getCachedProgram(std::string, const std::function<std::string()> &) -> std::string;
+
+    inline auto getInputs() const -> std::string
+    {
+        return OpenQasm::serializeInputs(builder->getParameterValues());
+    }
+
+    // Only analytic executions are deterministic.
+    [[nodiscard]] inline auto isResultCached() const -> bool
+    {
+        return result_cache && !device_shots;
+    }
+
+    auto getCacheKey(std::string_view, const std::string &) const -> std::string;
+    void computeProbs(DataView<double, 1> &, const std::string &, size_t);
+    auto runCached(std::string_view, const std::string &,
+                   const std::function<std::vector<double>()> &) -> std::vector<double>;
+
+    // One integer per shot, in which the device wire 0 is the most significant bit. Circuits of
+    // more qubits are sampled with one element per bit by `getSamples`.
+    static constexpr size_t max_packed_qubits = 64;
+    auto getPackedSamples() -> std::vector<uint64_t>;
+    auto getSamples() -> std::vector<size_t>;
+
+    inline auto getWireShifts(const std::vector<size_t> &dev_wires) const -> std::vector<size_t>
+    {
+        std::vector<size_t> shifts(dev_wires.size());
+        std::transform(dev_wires.begin(), dev_wires.end(), shifts.begin(),
+                       [numQubits = GetNumQubits()](size_t wire) { return numQubits - 1 - wire; });
+        return shifts;
+    }
+
+    auto createMeasurementBatch() const -> OpenQasm::QasmMeasurementBatch;
+    void submitMeasurementBatch(MeasurementBatchJob &);
+    void collectMeasurementBatch(MeasurementBatchJob &);
+    void executeMeasurementBatch(MeasurementBatchJob &);
+
     inline auto isValidQubits(const std::vector<QubitIdType> &wires) -> bool
     {
         return std::all_of(wires.begin(), wires.end(),
@@ -82,20 +177,55 @@ class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
             else {
                 RT_ASSERT("Invalid OpenQasm device type");
             }
+
+            parametric =
+                device_kwargs.contains("parametric") && device_kwargs["parametric"] == "True";
+            peephole = device_kwargs.contains("peephole") && device_kwargs["peephole"] == "True";
+
+            if (device_kwargs.contains("result_cache_size") ||
+                device_kwargs.contains("result_cache_dir")) {
+                const size_t capacity = device_kwargs.contains("result_cache_size")
+                                            ? std::stoull(device_kwargs["result_cache_size"])
+                                            : result_cache_default_capacity;
+                auto dir_it = device_kwargs.find("result_cache_dir");
+                if (capacity) {
+                    result_cache = std::make_unique<OpenQasm::QasmResultCache>(
+                        capacity, dir_it != device_kwargs.end() ? dir_it->second : "");
+                }
+            }
         }
         else {
             builder_type = OpenQasm::BuilderType::Common;
             builder = std::make_unique<OpenQasm::OpenQasmBuilder>();
-            runner = std::make_unique<OpenQasm::OpenQasmRunner>();
+            runner = std::make_shared<OpenQasm::OpenQasmRunner>();
         }
 
-        if (builder_type != OpenQasm::BuilderType::Common) {
-            builder = std::make_unique<OpenQasm::BraketBuilder>();
-            runner = std::make_unique<OpenQasm::BraketRunner>();
+        if (builder_type == OpenQasm::BuilderType::BraketLocal &&
+            device_kwargs["backend"] == "native") {
+            // Execute the programs in-process without the Python/Braket stack.
+            std::optional<uint64_t> seed{};
+            if (device_kwargs.contains("seed")) {
+                seed = std::stoull(device_kwargs["seed"]);
+            }
+            builder = std::make_unique<OpenQasm::BraketBuilder>(parametric, peephole);
+            runner = std::make_shared<OpenQasm::NativeRunner>(seed);
+        }
+        else if (builder_type != OpenQasm::BuilderType::Common) {
+            builder = std::make_unique<OpenQasm::BraketBuilder>(parametric, peephole);
+            runner = std::make_shared<OpenQasm::BraketRunner>();
         }
     }
     ~OpenQasmDevice() = default;
 
+    /**
+     * Replace the runner executing the programs of the device, e.g. by a mock runner.
+     */
+    void SetRunner(std::unique_ptr<OpenQasm::OpenQasmRunner> _runner)
+    {
+        RT_FAIL_IF(!pending_jobs.empty(), "Unable to replace the runner of pending jobs");
+        runner = std::move(_runner);
+    }
+
     auto AllocateQubits(size_t) -> std::vector<QubitIdType> override;
     void ReleaseAllQubits() override;
     auto GetNumQubits() const -> size_t override;
@@ -129,7 +259,27 @@ class OpenQasmDevice final : public Catalyst::Runtime::QuantumDevice {
     auto Var(ObsIdType) -> double override;
     void State(DataView<std::complex<double>, 1> &) override;
 
+    // Deferred measurements RT. Like the asynchronous ones below, these are C++ methods of this
+    // device without a CAPI, so compiled programs execute their observables one at a time.
+    auto DeferExpval(ObsIdType) -> size_t;
+    auto DeferVar(ObsIdType) -> size_t;
+    auto ExecuteDeferred() -> std::vector<double>;
+
+    // Asynchronous deferred measurements RT. These are C++ methods of this device for hosts that
+    // drive it directly; they are not part of `QuantumDevice` and have no CAPI, so compiled
+    // programs only reach the synchronous path through the measurement methods above.
+    auto SubmitDeferred() -> size_t;
+    auto IsDeferredReady(size_t) -> bool;
+    auto CollectDeferred(size_t) -> std::vector<double>;
+    [[nodiscard]] auto GetNumPendingJobs() const -> size_t { return pending_jobs.size(); }
+
     // Circuit RT
     [[nodiscard]] auto Circuit() const -> std::string { return builder->toOpenQasm(); }
+    [[nodiscard]] auto GetProgramCacheSize() const -> size_t { return program_cache.size(); }
+    [[nodiscard]] auto GetProgramCacheHits() const -> size_t { return program_cache_hits; }
+    [[nodiscard]] auto GetPeepholeStats() const -> OpenQasm::QasmPeepholeStats
+    {
+        return builder->getPeepholeStats();
+    }
 };
 } // namespace Catalyst::Runtime::Device
@@ -0,0 +1,89 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime::Device::OpenQasm {
+
+/**
+ * The handle of an OpenQasm job submitted to a runner.
+ *
+ * The measurement values of the job are materialized lazily: `getValues` blocks until the job
+ * is completed, and then returns the same values on every call. Copies of a handle share the
+ * same job. Errors of the job are reported by `getValues`.
+ *
+ * @param future The shared state of the job
+ * @param poll Optional check of the completion of a job that runs outside of `future`, e.g. a
+ * remote task whose results are only fetched by the deferred `future`
+ */
+class QasmJob {
+  private:
+    std::shared_future<std::vector<double>> future{};
+    std::function<bool()> poll{};
+
+  public:
+    QasmJob() = default;
+    explicit QasmJob(std::shared_future<std::vector<double>> _future,
+                     std::function<bool()> _poll = {})
+        : future(std::move(_future)), poll(std::move(_poll))
+    {
+    }
+    ~QasmJob() = default;
+
+    QasmJob(const QasmJob &) = default;
+    QasmJob &operator=(const QasmJob &) = default;
+    QasmJob(QasmJob &&) = default;
+    QasmJob &operator=(QasmJob &&) = default;
+
+    /**
+     * Create the handle of a job whose values are already known, e.g. cached results.
+     */
+    [[nodiscard]] static auto fromValues(std::vector<double> values) -> QasmJob
+    {
+        std::promise<std::vector<double>> promise;
+        promise.set_value(std::move(values));
+        return QasmJob{promise.get_future().share()};
+    }
+
+    [[nodiscard]] auto isValid() const -> bool { return future.valid(); }
+
+    /**
+     * Check whether the values are available without blocking. Deferred jobs without a `poll`
+     * are only executed when their values are requested, and are never ready before that.
+     */
+    [[nodiscard]] auto isReady() const -> bool
+    {
+        RT_FAIL_IF(!isValid(), "Invalid OpenQasm job");
+        if (future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            return true;
+        }
+        return poll && poll();
+    }
+
+    [[nodiscard]] auto getValues() const -> const std::vector<double> &
+    {
+        RT_FAIL_IF(!isValid(), "Invalid OpenQasm job");
+        return future.get();
+    }
+};
+
+} // namespace Catalyst::Runtime::Device::OpenQasm
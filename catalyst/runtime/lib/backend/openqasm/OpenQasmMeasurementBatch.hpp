@@ -0,0 +1,206 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+#include "OpenQasmBuilder.hpp"
+#include "Utils.hpp"
+
+namespace Catalyst::Runtime::Device::OpenQasm {
+
+/**
+ * The OpenQasm measurement batch collects `expectation` and `variance` result pragmas of
+ * several observables, so that they can be computed by one circuit submission per group.
+ *
+ * Each call to `add` returns a slot index. Identical requests share the same slot, and
+ * `setGroupValues` demultiplexes the values returned by the runner back to the slots.
+ *
+ * With `exact = true` (analytic execution), all requests are placed in one group. Otherwise,
+ * requests are grouped by qubit-wise compatibility: within a group, every wire is measured in at
+ * most one basis, which is what shot-based Braket devices accept in a single program.
+ *
+ * @param qregister The quantum register the observables act on
+ * @param exact Whether the batch is executed without shots
+ * @param precision The precision of the serialized observables
+ */
+class QasmMeasurementBatch {
+  private:
+    struct Group {
+        std::vector<std::string> pragmas;
+        std::vector<size_t> slots;
+        std::unordered_map<size_t, std::string> wire_bases;
+    };
+
+    const QasmRegister qregister;
+    const bool exact;
+    const size_t precision;
+
+    std::vector<Group> groups{};
+    std::unordered_map<std::string, size_t> slot_keys{};
+    std::vector<double> results{};
+    std::vector<bool> computed{};
+
+    /**
+     * Collect the measurement basis of each wire the observable acts on. The identity
+     * doesn't constrain its wire.
+     */
+    static void collectWireBases(const QasmObs &obs,
+                                 std::vector<std::pair<size_t, std::string>> &bases,
+                                 const QasmRegister &qregister)
+    {
+        const auto &&name = obs.getName();
+        if (name == "QasmTensorObs") {
+            for (const auto &ob : static_cast<const QasmTensorObs &>(obs).getObs()) {
+                collectWireBases(*ob, bases, qregister);
+            }
+            return;
+        }
+
+        RT_FAIL_IF(name == "QasmHamiltonianObs",
+                   "Invalid observable to batch; Hamiltonian terms must be added separately");
+
+        if (name == "i") {
+            return;
+        }
+
+        // Hermitian observables are only compatible with an identical Hermitian observable.
+        const auto &&basis = (name == "QasmHermitianObs") ? obs.toOpenQasm(qregister) : name;
+        for (auto wire : obs.getWires()) {
+            bases.emplace_back(wire, basis);
+        }
+    }
+
+    [[nodiscard]] static auto
+    isCompatible(const Group &group, const std::vector<std::pair<size_t, std::string>> &bases)
+        -> bool
+    {
+        return std::all_of(bases.begin(), bases.end(), [&group](const auto &wire_basis) {
+            auto it = group.wire_bases.find(wire_basis.first);
+            return it == group.wire_bases.end() || it->second == wire_basis.second;
+        });
+    }
+
+  public:
+    explicit QasmMeasurementBatch(const QasmRegister &_qregister, bool _exact,
+                                  size_t _precision = 5)
+        : qregister(_qregister), exact(_exact), precision(_precision)
+    {
+    }
+    ~QasmMeasurementBatch() = default;
+
+    [[nodiscard]] auto getNumGroups() const -> size_t { return groups.size(); }
+    [[nodiscard]] auto getNumSlots() const -> size_t { return results.size(); }
+
+    /**
+     * Add a measurement request to the batch.
+     *
+     * @param type The measurement process (`MeasurementsT::Expval` or `MeasurementsT::Var`)
+     * @param obs The observable to measure
+     * @return size_t The slot index of the result
+     */
+    auto add(MeasurementsT type, const QasmObs &obs) -> size_t
+    {
+        std::string pragma{"#pragma braket result "};
+        switch (type) {
+        case MeasurementsT::Expval:
+            pragma += "expectation ";
+            break;
+        case MeasurementsT::Var:
+            pragma += "variance ";
+            break;
+        default:
+            RT_FAIL("Unsupported measurement process to batch");
+        }
+        pragma += obs.toOpenQasm(qregister, precision);
+
+        if (auto it = slot_keys.find(pragma); it != slot_keys.end()) {
+            return it->second;
+        }
+
+        std::vector<std::pair<size_t, std::string>> bases;
+        collectWireBases(obs, bases, qregister);
+
+        auto group_it = groups.begin();
+        if (!exact) {
+            group_it = std::find_if(groups.begin(), groups.end(), [&bases](const Group &group) {
+                return isCompatible(group, bases);
+            });
+        }
+        if (group_it == groups.end()) {
+            group_it = groups.emplace(groups.end());
+        }
+
+        const size_t slot = results.size();
+        results.push_back(0.0);
+        computed.push_back(false);
+        slot_keys.emplace(pragma, slot);
+
+        group_it->pragmas.push_back(std::move(pragma));
+        group_it->slots.push_back(slot);
+        for (auto &&[wire, basis] : bases) {
+            group_it->wire_bases.emplace(wire, std::move(basis));
+        }
+
+        return slot;
+    }
+
+    /**
+     * Serialize the result pragmas of a group as custom instructions for the builder.
+     */
+    [[nodiscard]] auto getGroupInstructions(size_t group) const -> std::string
+    {
+        RT_FAIL_IF(group >= groups.size(), "Invalid measurement group");
+
+        std::string instructions;
+        for (const auto &pragma : groups[group].pragmas) {
+            instructions += pragma;
+            instructions += "\n";
+        }
+        return instructions;
+    }
+
+    /**
+     * Demultiplex the values of an executed group (in the order of its pragmas) to the slots.
+     */
+    void setGroupValues(size_t group, const std::vector<double> &values)
+    {
+        RT_FAIL_IF(group >= groups.size(), "Invalid measurement group");
+
+        const auto &slots = groups[group].slots;
+        RT_FAIL_IF(values.size() != slots.size(),
+                   "Invalid number of results returned for the measurement group");
+
+        for (size_t idx = 0; idx < slots.size(); idx++) {
+            results[slots[idx]] = values[idx];
+            computed[slots[idx]] = true;
+        }
+    }
+
+    [[nodiscard]] auto getResult(size_t slot) const -> double
+    {
+        RT_FAIL_IF(slot >= results.size() || !computed[slot],
+                   "Invalid slot; the measurement result is not computed");
+        return results[slot];
+    }
+};
+
+} // namespace Catalyst::Runtime::Device::OpenQasm
@@ -0,0 +1,893 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <numbers>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+#include "OpenQasmBuilder.hpp"
+#include "OpenQasmRunner.hpp"
+#include "OpenQasmStateVector.hpp"
+
+namespace Catalyst::Runtime::Device::OpenQasm {
+
+/**
+ * The map of OpenQasm gates supported by the native runner.
+ */
+constexpr std::array native_qasm_gate_info = {
+    // (Qasm-GateName, NumWires, NumParams)
+    std::tuple<GateNameT, size_t, size_t>{"i", 1, 0},
+    std::tuple<GateNameT, size_t, size_t>{"x", 1, 0},
+    std::tuple<GateNameT, size_t, size_t>{"y", 1, 0},
+    std::tuple<GateNameT, size_t, size_t>{"z", 1, 0},
+    std::tuple<GateNameT, size_t, size_t>{"h", 1, 0},
+    std::tuple<GateNameT, size_t, size_t>{"s", 1, 0},
+    std::tuple<GateNameT, size_t, size_t>{"si", 1, 0},
+    std::tuple<GateNameT, size_t, size_t>{"t", 1, 0},
+    std::tuple<GateNameT, size_t, size_t>{"ti", 1, 0},
+    std::tuple<GateNameT, size_t, size_t>{"cnot", 2, 0},
+    std::tuple<GateNameT, size_t, size_t>{"cy", 2, 0},
+    std::tuple<GateNameT, size_t, size_t>{"cz", 2, 0},
+    std::tuple<GateNameT, size_t, size_t>{"swap", 2, 0},
+    std::tuple<GateNameT, size_t, size_t>{"phaseshift", 1, 1},
+    std::tuple<GateNameT, size_t, size_t>{"rx", 1, 1},
+    std::tuple<GateNameT, size_t, size_t>{"ry", 1, 1},
+    std::tuple<GateNameT, size_t, size_t>{"rz", 1, 1},
+    std::tuple<GateNameT, size_t, size_t>{"cswap", 3, 0},
+    std::tuple<GateNameT, size_t, size_t>{"pswap", 2, 1},
+    std::tuple<GateNameT, size_t, size_t>{"iswap", 2, 0},
+    std::tuple<GateNameT, size_t, size_t>{"ccnot", 3, 0},
+};
+
+/**
+ * Lookup the number of wires and parameters of OpenQasm gates supported by the native runner.
+ */
+constexpr auto lookup_native_gate_info(std::string_view gate_name) -> std::pair<size_t, size_t>
+{
+    for (auto &&[name, num_wires, num_params] : native_qasm_gate_info) {
+        if (name == gate_name) {
+            return {num_wires, num_params};
+        }
+    }
+
+    RT_FAIL("The given OpenQasm gate is not supported by the native runner.");
+}
+
+/**
+ * The matrices of the gates and observables of the native runner, in row-major order.
+ */
+struct NativeGateMatrix {
+    using ComplexT = std::complex<double>;
+    using MatrixT = std::vector<ComplexT>;
+
+    [[nodiscard]] static auto controlled(const MatrixT &matrix, size_t num_controls) -> MatrixT
+    {
+        const size_t base_dim = static_cast<size_t>(std::sqrt(matrix.size()));
+        const size_t dim = base_dim << num_controls;
+        const size_t offset = dim - base_dim;
+
+        MatrixT res(dim * dim, {0.0, 0.0});
+        for (size_t idx = 0; idx < offset; idx++) {
+            res[idx * dim + idx] = {1.0, 0.0};
+        }
+        for (size_t row = 0; row < base_dim; row++) {
+            for (size_t col = 0; col < base_dim; col++) {
+                res[(offset + row) * dim + offset + col] = matrix[row * base_dim + col];
+            }
+        }
+        return res;
+    }
+
+    [[nodiscard]] static auto get(std::string_view name, const std::vector<double> &params)
+        -> MatrixT
+    {
+        using namespace std::complex_literals;
+        constexpr double inv_sqrt2 = 1.0 / std::numbers::sqrt2;
+
+        const MatrixT x{0, 1, 1, 0};
+        const MatrixT y{0, -1i, 1i, 0};
+        const MatrixT z{1, 0, 0, -1};
+        const MatrixT swap{1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1};
+
+        if (name == "i") {
+            return {1, 0, 0, 1};
+        }
+        if (name == "x") {
+            return x;
+        }
+        if (name == "y") {
+            return y;
+        }
+        if (name == "z") {
+            return z;
+        }
+        if (name == "h") {
+            return {inv_sqrt2, inv_sqrt2, inv_sqrt2, -inv_sqrt2};
+        }
+        if (name == "s") {
+            return {1, 0, 0, 1i};
+        }
+        if (name == "si") {
+            return {1, 0, 0, -1i};
+        }
+        if (name == "t") {
+            return {1, 0, 0, std::exp(1i * std::numbers::pi / 4.0)};
+        }
+        if (name == "ti") {
+            return {1, 0, 0, std::exp(-1i * std::numbers::pi / 4.0)};
+        }
+        if (name == "cnot") {
+            return controlled(x, 1);
+        }
+        if (name == "cy") {
+            return controlled(y, 1);
+        }
+        if (name == "cz") {
+            return controlled(z, 1);
+        }
+        if (name == "swap") {
+            return swap;
+        }
+        if (name == "cswap") {
+            return controlled(swap, 1);
+        }
+        if (name == "ccnot") {
+            return controlled(x, 2);
+        }
+        if (name == "iswap") {
+            return {1, 0, 0, 0, 0, 0, 1i, 0, 0, 1i, 0, 0, 0, 0, 0, 1};
+        }
+
+        RT_FAIL_IF(params.size() != 1, "Invalid number of parameters");
+        const double theta = params[0];
+        const ComplexT c = std::cos(theta / 2);
+        const ComplexT s = std::sin(theta / 2);
+
+        if (name == "phaseshift") {
+            return {1, 0, 0, std::exp(1i * theta)};
+        }
+        if (name == "rx") {
+            return {c, -1i * s, -1i * s, c};
+        }
+        if (name == "ry") {
+            return {c, -s, s, c};
+        }
+        if (name == "rz") {
+            return {std::exp(-0.5i * theta), 0, 0, std::exp(0.5i * theta)};
+        }
+        if (name == "pswap") {
+            const ComplexT p = std::exp(1i * theta);
+            return {1, 0, 0, 0, 0, 0, p, 0, 0, p, 0, 0, 0, 0, 0, 1};
+        }
+
+        RT_FAIL("The given OpenQasm gate is not supported by the native runner.");
+    }
+};
+
+/**
+ * Types of the result pragmas supported by the native runner.
+ */
+enum class NativeResultType : uint8_t {
+    Expectation, // = 0
+    Variance,
+    Probability,
+    StateVector,
+};
+
+/**
+ * A factor of a tensor-product observable of a result pragma.
+ */
+struct NativeObsFactor {
+    std::string name; // x, y, z, h, i, or hermitian
+    std::vector<std::complex<double>> matrix;
+    std::vector<size_t> wires;
+};
+
+/**
+ * A result pragma (`#pragma braket result ...`) of a program.
+ */
+struct NativeResult {
+    NativeResultType type;
+    std::vector<NativeObsFactor> factors{};
+    std::vector<size_t> wires{};
+};
+
+/**
+ * A gate of a program, lowered to its matrix.
+ */
+struct NativeOp {
+    std::vector<std::complex<double>> matrix;
+    std::vector<size_t> wires;
+};
+
+/**
+ * A parsed OpenQasm program.
+ */
+struct NativeProgram {
+    size_t num_qubits{0};
+    std::vector<NativeOp> ops{};
+    std::vector<size_t> measured_wires{};
+    std::vector<NativeResult> results{};
+};
+
+/**
+ * A parser for the subset of OpenQasm 3 generated by `BraketBuilder`:
+ *
+ * - `OPENQASM 3.0;`
+ * - `input float name;` and `input float[64] name;`, bound via the serialized `inputs`
+ * - `qubit[n] name;` (a single quantum register) and `bit[n] name;`
+ * - the gates of `native_qasm_gate_info` with numeric or `input` parameters
+ * - `#pragma braket unitary(matrix) qubits`
+ * - `bits = measure qubits;`, `bits[i] = measure qubits[j];`, and `measure qubits[j];`
+ * - `#pragma braket result expectation|variance|probability|state_vector ...`
+ *
+ * Each statement is expected on its own line, as emitted by the builder.
+ */
+class NativeParser {
+  private:
+    const std::unordered_map<std::string, double> inputs;
+    std::unordered_map<std::string, double> variables{};
+    std::string qreg_name{};
+    NativeProgram program{};
+    bool measured{false};
+
+    [[nodiscard]] static auto trim(std::string_view str) -> std::string_view
+    {
+        const auto begin = str.find_first_not_of(" \t\r");
+        if (begin == std::string_view::npos) {
+            return {};
+        }
+        const auto end = str.find_last_not_of(" \t\r");
+        return str.substr(begin, end - begin + 1);
+    }
+
+    [[nodiscard]] static auto split(std::string_view str, char sep) -> std::vector<std::string_view>
+    {
+        std::vector<std::string_view> tokens;
+        size_t begin = 0;
+        while (begin <= str.size()) {
+            size_t end = str.find(sep, begin);
+            if (end == std::string_view::npos) {
+                end = str.size();
+            }
+            tokens.push_back(trim(str.substr(begin, end - begin)));
+            begin = end + 1;
+        }
+        return tokens;
+    }
+
+    [[nodiscard]] static auto parseNumber(std::string_view str) -> std::optional<double>
+    {
+        double value{0.0};
+        auto &&[ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+        if (ec != std::errc() || ptr != str.data() + str.size()) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    [[nodiscard]] auto parseParam(std::string_view str) const -> double
+    {
+        if (auto value = parseNumber(str)) {
+            return *value;
+        }
+
+        const bool negative = !str.empty() && str.front() == '-';
+        const auto name = trim(negative ? str.substr(1) : str);
+        double value{0.0};
+        if (name == "pi") {
+            value = std::numbers::pi;
+        }
+        else {
+            auto it = variables.find(std::string{name});
+            RT_FAIL_IF(it == variables.end(), "Invalid gate parameter for the native runner");
+            value = it->second;
+        }
+        return negative ? -value : value;
+    }
+
+    [[nodiscard]] auto parseRegisterSize(std::string_view decl, std::string &name) const -> size_t
+    {
+        // [n] name
+        const auto close = decl.find(']');
+        RT_FAIL_IF(decl.empty() || decl.front() != '[' || close == std::string_view::npos,
+                   "Invalid OpenQasm register declaration");
+
+        const auto size_str = decl.substr(1, close - 1);
+        size_t size{0};
+        auto &&[ptr, ec] =
+            std::from_chars(size_str.data(), size_str.data() + size_str.size(), size);
+        RT_FAIL_IF(ec != std::errc() || ptr != size_str.data() + size_str.size(),
+                   "Invalid OpenQasm register declaration");
+
+        name = std::string{trim(decl.substr(close + 1))};
+        return size;
+    }
+
+    /**
+     * Parse `name[i], name[j], ...` of the quantum register, or `name` for all of its qubits.
+     */
+    [[nodiscard]] auto parseQubits(std::string_view operands, bool allow_register) const
+        -> std::vector<size_t>
+    {
+        RT_FAIL_IF(qreg_name.empty(), "Invalid OpenQasm program; No quantum register declared");
+
+        std::vector<size_t> wires;
+        if (trim(operands) == qreg_name) {
+            RT_FAIL_IF(!allow_register, "Invalid OpenQasm operands for the native runner");
+            wires.resize(program.num_qubits);
+            std::iota(wires.begin(), wires.end(), 0);
+            return wires;
+        }
+
+        for (auto operand : split(operands, ',')) {
+            const auto open = operand.find('[');
+            RT_FAIL_IF(open == std::string_view::npos || operand.back() != ']' ||
+                           operand.substr(0, open) != qreg_name,
+                       "Invalid OpenQasm operands for the native runner");
+
+            const auto index_str = operand.substr(open + 1, operand.size() - open - 2);
+            size_t wire{0};
+            auto &&[ptr, ec] =
+                std::from_chars(index_str.data(), index_str.data() + index_str.size(), wire);
+            RT_FAIL_IF(ec != std::errc() || ptr != index_str.data() + index_str.size() ||
+                           wire >= program.num_qubits,
+                       "Invalid OpenQasm operands for the native runner");
+            wires.push_back(wire);
+        }
+        return wires;
+    }
+
+    /**
+     * Parse a matrix serialized by `MatrixBuilder`, e.g. `[[1+0im, 0], [0, 0.5-0.5im]]`.
+     */
+    [[nodiscard]] static auto parseMatrix(std::string_view str)
+        -> std::vector<std::complex<double>>
+    {
+        std::vector<std::complex<double>> matrix;
+        const char *iter = str.data();
+        const char *end = str.data() + str.size();
+        while (iter != end) {
+            if (*iter == '[' || *iter == ']' || *iter == ',' || *iter == ' ') {
+                iter++;
+                continue;
+            }
+
+            double real{0.0};
+            double imag{0.0};
+            auto &&[real_ptr, real_ec] = std::from_chars(iter, end, real);
+            RT_FAIL_IF(real_ec != std::errc(), "Invalid OpenQasm matrix");
+            iter = real_ptr;
+
+            if (iter != end && (*iter == '+' || *iter == '-')) {
+                // from_chars doesn't accept a leading '+'
+                auto &&[imag_ptr, imag_ec] = std::from_chars(iter + (*iter == '+'), end, imag);
+                RT_FAIL_IF(imag_ec != std::errc() ||
+                               !std::string_view(imag_ptr, end).starts_with("im"),
+                           "Invalid OpenQasm matrix");
+                iter = imag_ptr + 2;
+            }
+            matrix.emplace_back(real, imag);
+        }
+        return matrix;
+    }
+
+    [[nodiscard]] auto parseObservable(std::string_view str) const -> std::vector<NativeObsFactor>
+    {
+        std::vector<NativeObsFactor> factors;
+        size_t begin = 0;
+        while (begin < str.size()) {
+            size_t end = str.find(" @ ", begin);
+            if (end == std::string_view::npos) {
+                end = str.size();
+            }
+            const auto factor = trim(str.substr(begin, end - begin));
+            begin = end + 3;
+
+            NativeObsFactor ob;
+            if (factor.starts_with("hermitian(")) {
+                // hermitian(matrix) qubits
+                const auto close = factor.find("]])");
+                RT_FAIL_IF(close == std::string_view::npos, "Invalid OpenQasm observable");
+                ob.name = "hermitian";
+                ob.matrix = parseMatrix(factor.substr(10, close + 2 - 10));
+                ob.wires = parseQubits(factor.substr(close + 3), false);
+                RT_FAIL_IF(ob.matrix.size() != (1UL << (2 * ob.wires.size())),
+                           "Invalid OpenQasm observable");
+            }
+            else {
+                // name(qubits)
+                const auto open = factor.find('(');
+                RT_FAIL_IF(open == std::string_view::npos || factor.back() != ')',
+                           "Invalid OpenQasm observable");
+                ob.name = std::string{factor.substr(0, open)};
+                RT_FAIL_IF(ob.name != "x" && ob.name != "y" && ob.name != "z" && ob.name != "h" &&
+                               ob.name != "i",
+                           "The given OpenQasm observable is not supported by the native runner.");
+                ob.matrix = NativeGateMatrix::get(ob.name, {});
+                ob.wires = parseQubits(factor.substr(open + 1, factor.size() - open - 2), false);
+                RT_FAIL_IF(ob.wires.size() != 1, "Invalid OpenQasm observable");
+            }
+            factors.push_back(std::move(ob));
+        }
+        RT_FAIL_IF(factors.empty(), "Invalid OpenQasm observable");
+        return factors;
+    }
+
+    void parsePragma(std::string_view line)
+    {
+        constexpr std::string_view unitary_prefix = "#pragma braket unitary(";
+        constexpr std::string_view result_prefix = "#pragma braket result ";
+
+        if (line.starts_with(unitary_prefix)) {
+            const auto close = line.find("]])");
+            RT_FAIL_IF(close == std::string_view::npos, "Invalid OpenQasm unitary pragma");
+
+            NativeOp op;
+            op.matrix = parseMatrix(line.substr(unitary_prefix.size(),
+                                                close + 2 - unitary_prefix.size()));
+            op.wires = parseQubits(line.substr(close + 3), false);
+            RT_FAIL_IF(op.matrix.size() != (1UL << (2 * op.wires.size())),
+                       "Invalid OpenQasm unitary pragma");
+            addOp(std::move(op));
+            return;
+        }
+
+        RT_FAIL_IF(!line.starts_with(result_prefix),
+                   "The given OpenQasm pragma is not supported by the native runner.");
+        auto &&result = trim(line.substr(result_prefix.size()));
+
+        if (result.starts_with("expectation ")) {
+            program.results.push_back(
+                {NativeResultType::Expectation, parseObservable(result.substr(12)), {}});
+        }
+        else if (result.starts_with("variance ")) {
+            program.results.push_back(
+                {NativeResultType::Variance, parseObservable(result.substr(9)), {}});
+        }
+        else if (result == "probability") {
+            std::vector<size_t> wires(program.num_qubits);
+            std::iota(wires.begin(), wires.end(), 0);
+            program.results.push_back({NativeResultType::Probability, {}, std::move(wires)});
+        }
+        else if (result.starts_with("probability ")) {
+            program.results.push_back(
+                {NativeResultType::Probability, {}, parseQubits(result.substr(12), true)});
+        }
+        else if (result == "state_vector") {
+            program.results.push_back({NativeResultType::StateVector, {}, {}});
+        }
+        else {
+            RT_FAIL("The given OpenQasm result type is not supported by the native runner.");
+        }
+    }
+
+    void addOp(NativeOp &&op)
+    {
+        RT_FAIL_IF(measured, "Mid-circuit measurements are not supported by the native runner");
+        program.ops.push_back(std::move(op));
+    }
+
+    void parseGate(std::string_view stmt)
+    {
+        // name(param_1, ..., param_n) qubit_1, ..., qubit_m
+        std::string_view name;
+        std::vector<double> params;
+        std::string_view operands;
+
+        const auto open = stmt.find('(');
+        const auto space = stmt.find(' ');
+        if (open != std::string_view::npos && open < space) {
+            const auto close = stmt.find(')', open);
+            RT_FAIL_IF(close == std::string_view::npos, "Invalid OpenQasm gate");
+            name = stmt.substr(0, open);
+            for (auto param : split(stmt.substr(open + 1, close - open - 1), ',')) {
+                params.push_back(parseParam(param));
+            }
+            operands = stmt.substr(close + 1);
+        }
+        else {
+            RT_FAIL_IF(space == std::string_view::npos, "Invalid OpenQasm gate");
+            name = stmt.substr(0, space);
+            operands = stmt.substr(space + 1);
+        }
+
+        auto &&[num_wires, num_params] = lookup_native_gate_info(name);
+        NativeOp op;
+        op.wires = parseQubits(operands, false);
+        RT_FAIL_IF(op.wires.size() != num_wires, "Invalid number of qubits");
+        RT_FAIL_IF(params.size() != num_params, "Invalid number of parameters");
+        op.matrix = NativeGateMatrix::get(name, params);
+        addOp(std::move(op));
+    }
+
+    void parseStatement(std::string_view stmt)
+    {
+        if (stmt.starts_with("input ")) {
+            // input float name; or input float[64] name;
+            const auto name = std::string{trim(stmt.substr(stmt.rfind(' ') + 1))};
+            auto it = inputs.find(name);
+            RT_FAIL_IF(it == inputs.end(), "Missing value for an input variable of the program");
+            variables[name] = it->second;
+        }
+        else if (stmt.starts_with("qubit")) {
+            RT_FAIL_IF(!qreg_name.empty(), "Invalid number of quantum registers; Only one quantum "
+                                           "register is currently supported.");
+            program.num_qubits = parseRegisterSize(stmt.substr(5), qreg_name);
+        }
+        else if (auto pos = stmt.find("measure "); pos != std::string_view::npos) {
+            // [bits =] measure qubits;
+            measured = true;
+            for (auto wire : parseQubits(stmt.substr(pos + 8), true)) {
+                program.measured_wires.push_back(wire);
+            }
+        }
+        else if (stmt.starts_with("bit")) {
+            // Measurement results are returned by the runner methods instead.
+            std::string breg_name;
+            [[maybe_unused]] auto size = parseRegisterSize(stmt.substr(3), breg_name);
+        }
+        else if (stmt.starts_with("reset ")) {
+            RT_FAIL("Reset is not supported by the native runner");
+        }
+        else {
+            parseGate(stmt);
+        }
+    }
+
+  public:
+    explicit NativeParser(const std::string &_inputs) : inputs(deserializeInputs(_inputs)) {}
+    ~NativeParser() = default;
+
+    [[nodiscard]] auto parse(const std::string &circuit) -> NativeProgram
+    {
+        std::string_view source{circuit};
+        size_t begin = 0;
+        while (begin < source.size()) {
+            size_t end = source.find('\n', begin);
+            if (end == std::string_view::npos) {
+                end = source.size();
+            }
+            const auto line = trim(source.substr(begin, end - begin));
+            begin = end + 1;
+
+            if (line.empty() || line.starts_with("//")) {
+                continue;
+            }
+            if (line.starts_with("#pragma")) {
+                parsePragma(line);
+                continue;
+            }
+
+            RT_FAIL_IF(line.back() != ';', "Invalid OpenQasm statement; Missing semicolon");
+            const auto stmt = trim(line.substr(0, line.size() - 1));
+            if (stmt.starts_with("OPENQASM ")) {
+                RT_FAIL_IF(!trim(stmt.substr(9)).starts_with("3"),
+                           "Unsupported OpenQasm version by the native runner");
+                continue;
+            }
+            parseStatement(stmt);
+        }
+
+        RT_FAIL_IF(qreg_name.empty(), "Invalid OpenQasm program; No quantum register declared");
+        return std::move(program);
+    }
+};
+
+/**
+ * The native OpenQasm runner.
+ *
+ * It parses the OpenQasm 3 programs generated by `BraketBuilder` with `NativeParser` and
+ * executes them in-process on `QasmStateVector`, without the Python/Braket stack.
+ * Measurement results are analytic with zero shots, and estimated from samples otherwise.
+ *
+ * @param seed Optional seed of the random number generator used for sampling
+ */
+class NativeRunner final : public OpenQasmRunner {
+  private:
+    mutable std::mt19937_64 generator;
+    mutable std::mutex generator_mutex;
+
+    [[nodiscard]] static auto execute(const std::string &circuit, const std::string &inputs)
+        -> std::pair<NativeProgram, QasmStateVector>
+    {
+        NativeParser parser{inputs};
+        auto &&program = parser.parse(circuit);
+
+        QasmStateVector state{program.num_qubits};
+        for (const auto &op : program.ops) {
+            state.applyMatrix(op.matrix, op.wires);
+        }
+        return {std::move(program), std::move(state)};
+    }
+
+    [[nodiscard]] static auto getMeasuredWires(const NativeProgram &program) -> std::vector<size_t>
+    {
+        if (!program.measured_wires.empty()) {
+            return program.measured_wires;
+        }
+        std::vector<size_t> wires(program.num_qubits);
+        std::iota(wires.begin(), wires.end(), 0);
+        return wires;
+    }
+
+    [[nodiscard]] auto sample(const QasmStateVector &state, const std::vector<size_t> &wires,
+                              size_t shots) const -> std::vector<size_t>
+    {
+        std::lock_guard<std::mutex> lock(generator_mutex);
+        return state.sample(wires, shots, generator);
+    }
+
+    [[nodiscard]] auto samplePacked(const QasmStateVector &state,
+                                    const std::vector<size_t> &wires, size_t shots) const
+        -> std::vector<uint64_t>
+    {
+        std::lock_guard<std::mutex> lock(generator_mutex);
+        return state.samplePacked(wires, shots, generator);
+    }
+
+    /**
+     * Compute the expectation value or the variance of a tensor-product observable.
+     */
+    [[nodiscard]] auto observableValue(const QasmStateVector &state, const NativeResult &result,
+                                       size_t shots) const -> double
+    {
+        const bool variance = (result.type == NativeResultType::Variance);
+
+        if (!shots) {
+            QasmStateVector obs_state{state};
+            for (const auto &ob : result.factors) {
+                if (ob.name != "i") {
+                    obs_state.applyMatrix(ob.matrix, ob.wires);
+                }
+            }
+
+            const double expval = state.innerProduct(obs_state).real();
+            if (!variance) {
+                return expval;
+            }
+            return obs_state.innerProduct(obs_state).real() - expval * expval;
+        }
+
+        // Rotate the state to the eigenbasis of the observable and sample the eigenvalues.
+        QasmStateVector rotated{state};
+        std::vector<size_t> wires;
+        for (const auto &ob : result.factors) {
+            RT_FAIL_IF(ob.name == "hermitian",
+                       "Hermitian observables are only supported with zero shots by the native "
+                       "runner");
+            if (ob.name == "x") {
+                rotated.applyMatrix(NativeGateMatrix::get("h", {}), ob.wires);
+            }
+            else if (ob.name == "y") {
+                rotated.applyMatrix(NativeGateMatrix::get("si", {}), ob.wires);
+                rotated.applyMatrix(NativeGateMatrix::get("h", {}), ob.wires);
+            }
+            else if (ob.name == "h") {
+                rotated.applyMatrix(NativeGateMatrix::get("ry", {-std::numbers::pi / 4}),
+                                    ob.wires);
+            }
+            if (ob.name != "i") {
+                wires.insert(wires.end(), ob.wires.begin(), ob.wires.end());
+            }
+        }
+
+        if (wires.empty()) {
+            return variance ? 0.0 : 1.0;
+        }
+
+        auto &&samples = sample(rotated, wires, shots);
+        double sum{0.0};
+        double sum_sq{0.0};
+        for (size_t shot = 0; shot < shots; shot++) {
+            double eigval{1.0};
+            for (size_t idx = 0; idx < wires.size(); idx++) {
+                eigval *= samples[shot * wires.size() + idx] ? -1.0 : 1.0;
+            }
+            sum += eigval;
+            sum_sq += eigval * eigval;
+        }
+
+        const double mean = sum / static_cast<double>(shots);
+        return variance ? sum_sq / static_cast<double>(shots) - mean * mean : mean;
+    }
+
+    [[nodiscard]] auto computeValues(const NativeProgram &program, const QasmStateVector &state,
+                                     size_t shots) const -> std::vector<double>
+    {
+        std::vector<double> values;
+        values.reserve(program.results.size());
+        for (const auto &result : program.results) {
+            RT_FAIL_IF(result.type != NativeResultType::Expectation &&
+                           result.type != NativeResultType::Variance,
+                       "Unsupported result type to compute the measurement values of");
+            values.push_back(observableValue(state, result, shots));
+        }
+        return values;
+    }
+
+  public:
+    explicit NativeRunner(std::optional<uint64_t> seed = std::nullopt)
+        : generator(seed ? *seed : std::random_device{}())
+    {
+    }
+    ~NativeRunner() override = default;
+
+    NativeRunner(const NativeRunner &) = delete;
+    NativeRunner &operator=(const NativeRunner &) = delete;
+    NativeRunner(NativeRunner &&) = delete;
+    NativeRunner &operator=(NativeRunner &&) = delete;
+
+    [[nodiscard]] auto runCircuit(const std::string &circuit,
+                                  [[maybe_unused]] const std::string &device, size_t shots,
+                                  [[maybe_unused]] const std::string &kwargs = "",
+                                  const std::string &inputs = "") const -> std::string override
+    {
+        auto &&[program, state] = execute(circuit, inputs);
+
+        std::ostringstream oss;
+        oss << "NativeTaskResult(num_qubits=" << program.num_qubits << ", shots=" << shots;
+        if (shots) {
+            auto &&wires = getMeasuredWires(program);
+            auto &&samples = sample(state, wires, shots);
+
+            std::map<std::string, size_t> counts;
+            for (size_t shot = 0; shot < shots; shot++) {
+                std::string bitstring(wires.size(), '0');
+                for (size_t idx = 0; idx < wires.size(); idx++) {
+                    bitstring[idx] += static_cast<char>(samples[shot * wires.size() + idx]);
+                }
+                counts[bitstring]++;
+            }
+
+            oss << ", measurement_counts={";
+            for (auto it = counts.begin(); it != counts.end(); it++) {
+                oss << (it == counts.begin() ? "" : ", ") << "'" << it->first
+                    << "': " << it->second;
+            }
+            oss << "}";
+        }
+        oss << ")";
+        return oss.str();
+    }
+
+    [[nodiscard]] auto Probs(const std::string &circuit,
+                             [[maybe_unused]] const std::string &device, size_t shots,
+                             size_t num_qubits, [[maybe_unused]] const std::string &kwargs = "",
+                             const std::string &inputs = "") const -> std::vector<double> override
+    {
+        auto &&[program, state] = execute(circuit, inputs);
+
+        auto wires = getMeasuredWires(program);
+        for (const auto &result : program.results) {
+            if (result.type == NativeResultType::Probability) {
+                wires = result.wires;
+                break;
+            }
+        }
+        RT_FAIL_IF(wires.size() != num_qubits, "Invalid number of qubits for the probabilities");
+
+        if (!shots) {
+            return state.probabilities(wires);
+        }
+
+        std::vector<double> probs(1UL << num_qubits, 0.0);
+        for (auto state_index : samplePacked(state, wires, shots)) {
+            probs[state_index] += 1.0 / static_cast<double>(shots);
+        }
+        return probs;
+    }
+
+    [[nodiscard]] auto Sample(const std::string &circuit,
+                              [[maybe_unused]] const std::string &device, size_t shots,
+                              size_t num_qubits, [[maybe_unused]] const std::string &kwargs = "",
+                              const std::string &inputs = "") const -> std::vector<size_t> override
+    {
+        RT_FAIL_IF(!shots, "Unable to sample; The number of shots must be positive");
+
+        auto &&[program, state] = execute(circuit, inputs);
+
+        auto &&wires = getMeasuredWires(program);
+        RT_FAIL_IF(wires.size() != num_qubits, "Invalid number of qubits for the samples");
+
+        return sample(state, wires, shots);
+    }
+
+    [[nodiscard]] auto PackedSample(const std::string &circuit,
+                                    [[maybe_unused]] const std::string &device, size_t shots,
+                                    size_t num_qubits,
+                                    [[maybe_unused]] const std::string &kwargs = "",
+                                    const std::string &inputs = "") const
+        -> std::vector<uint64_t> override
+    {
+        RT_FAIL_IF(!shots, "Unable to sample; The number of shots must be positive");
+        RT_FAIL_IF(num_qubits > 64, "Unable to pack the samples of more than 64 qubits");
+
+        auto &&[program, state] = execute(circuit, inputs);
+
+        auto &&wires = getMeasuredWires(program);
+        RT_FAIL_IF(wires.size() != num_qubits, "Invalid number of qubits for the samples");
+
+        return samplePacked(state, wires, shots);
+    }
+
+    [[nodiscard]] auto Expval(const std::string &circuit,
+                              [[maybe_unused]] const std::string &device, size_t shots,
+                              [[maybe_unused]] const std::string &kwargs = "",
+                              const std::string &inputs = "") const -> double override
+    {
+        auto &&[program, state] = execute(circuit, inputs);
+        RT_FAIL_IF(program.results.empty() ||
+                       program.results[0].type != NativeResultType::Expectation,
+                   "Unable to compute expectation value; no measurement process was specified");
+        return observableValue(state, program.results[0], shots);
+    }
+
+    [[nodiscard]] auto Var(const std::string &circuit, [[maybe_unused]] const std::string &device,
+                           size_t shots, [[maybe_unused]] const std::string &kwargs = "",
+                           const std::string &inputs = "") const -> double override
+    {
+        auto &&[program, state] = execute(circuit, inputs);
+        RT_FAIL_IF(program.results.empty() ||
+                       program.results[0].type != NativeResultType::Variance,
+                   "Unable to compute variance; no measurement process was specified");
+        return observableValue(state, program.results[0], shots);
+    }
+
+    [[nodiscard]] auto Values(const std::string &circuit,
+                              [[maybe_unused]] const std::string &device, size_t shots,
+                              [[maybe_unused]] const std::string &kwargs = "",
+                              const std::string &inputs = "") const -> std::vector<double> override
+    {
+        auto &&[program, state] = execute(circuit, inputs);
+        RT_FAIL_IF(program.results.empty(),
+                   "Unable to compute measurement results; no measurement process was specified");
+        return computeValues(program, state, shots);
+    }
+
+    [[nodiscard]] auto State(const std::string &circuit,
+                             [[maybe_unused]] const std::string &device, size_t shots,
+                             size_t num_qubits, [[maybe_unused]] const std::string &kwargs = "",
+                             const std::string &inputs = "") const
+        -> std::vector<std::complex<double>> override
+    {
+        RT_FAIL_IF(shots, "Unable to compute the state vector; The number of shots must be zero");
+
+        auto &&[program, state] = execute(circuit, inputs);
+        RT_FAIL_IF(program.num_qubits != num_qubits,
+                   "Invalid number of qubits for the state vector");
+        return state.getData();
+    }
+};
+
+} // namespace Catalyst::Runtime::Device::OpenQasm
@@ -0,0 +1,260 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime::Device::OpenQasm {
+
+/**
+ * A content-addressed cache of execution results of the OpenQasm device.
+ *
+ * Results are addressed by the digest of everything that determines them (see `digest`), and
+ * the most recently used `capacity` results are kept in memory. With a non-empty `directory`,
+ * results are also persisted to `<directory>/<digest>.qrc` files, so that they are shared
+ * across devices and processes. The on-disk store is best effort: unreadable or unwritable
+ * entries are treated as cache misses, and it is never evicted.
+ *
+ * @note Only deterministic executions (e.g. analytic ones) must be cached.
+ *
+ * @param capacity The maximum number of results kept in memory
+ * @param directory Optional directory of the on-disk store
+ */
+class QasmResultCache {
+  private:
+    using EntryT = std::pair<std::string, std::vector<double>>;
+
+    static constexpr std::array<char, 4> file_magic = {'Q', 'R', 'C', '1'};
+
+    const size_t capacity;
+    const std::filesystem::path directory;
+
+    std::list<EntryT> entries{};
+    std::unordered_map<std::string, std::list<EntryT>::iterator> index{};
+
+    size_t hits{0};
+    size_t misses{0};
+
+    [[nodiscard]] auto getFilePath(const std::string &key) const -> std::filesystem::path
+    {
+        return directory / (key + ".qrc");
+    }
+
+    [[nodiscard]] auto load(const std::string &key) const -> std::optional<std::vector<double>>
+    {
+        std::ifstream file(getFilePath(key), std::ios::binary);
+        if (!file) {
+            return std::nullopt;
+        }
+
+        std::array<char, 4> magic{};
+        uint64_t key_size{0};
+        file.read(magic.data(), magic.size());
+        file.read(reinterpret_cast<char *>(&key_size), sizeof(key_size));
+        if (!file || magic != file_magic || key_size != key.size()) {
+            return std::nullopt;
+        }
+
+        std::string stored_key(key_size, '\0');
+        uint64_t num_values{0};
+        file.read(stored_key.data(), static_cast<std::streamsize>(key_size));
+        file.read(reinterpret_cast<char *>(&num_values), sizeof(num_values));
+        if (!file || stored_key != key) {
+            return std::nullopt;
+        }
+
+        std::vector<double> values(num_values);
+        file.read(reinterpret_cast<char *>(values.data()),
+                  static_cast<std::streamsize>(num_values * sizeof(double)));
+        if (!file) {
+            return std::nullopt;
+        }
+        return values;
+    }
+
+    void store(const std::string &key, const std::vector<double> &values) const
+    {
+        // Write to a temporary file first so that readers never observe partial entries.
+        const auto path = getFilePath(key);
+        auto tmp_path = path;
+        tmp_path += ".tmp";
+        {
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            const uint64_t key_size = key.size();
+            const uint64_t num_values = values.size();
+            file.write(file_magic.data(), file_magic.size());
+            file.write(reinterpret_cast<const char *>(&key_size), sizeof(key_size));
+            file.write(key.data(), static_cast<std::streamsize>(key_size));
+            file.write(reinterpret_cast<const char *>(&num_values), sizeof(num_values));
+            file.write(reinterpret_cast<const char *>(values.data()),
+                       static_cast<std::streamsize>(num_values * sizeof(double)));
+            if (!file) {
+                return;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tmp_path, path, ec);
+        if (ec) {
+            std::filesystem::remove(tmp_path, ec);
+        }
+    }
+
+    void insertInMemory(const std::string &key, std::vector<double> values)
+    {
+        if (auto it = index.find(key); it != index.end()) {
+            it->second->second = std::move(values);
+            entries.splice(entries.begin(), entries, it->second);
+            return;
+        }
+
+        entries.emplace_front(key, std::move(values));
+        index.emplace(key, entries.begin());
+
+        if (entries.size() > capacity) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+
+  public:
+    explicit QasmResultCache(size_t _capacity, const std::string &_directory = "")
+        : capacity(_capacity), directory(_directory)
+    {
+        RT_FAIL_IF(!capacity, "Invalid capacity of the result cache");
+
+        if (!directory.empty()) {
+            std::error_code ec;
+            std::filesystem::create_directories(directory, ec);
+            RT_FAIL_IF(ec || !std::filesystem::is_directory(directory),
+                       "Failed to create the directory of the result cache");
+        }
+    }
+    ~QasmResultCache() = default;
+
+    QasmResultCache(const QasmResultCache &) = delete;
+    QasmResultCache &operator=(const QasmResultCache &) = delete;
+    QasmResultCache(QasmResultCache &&) = delete;
+    QasmResultCache &operator=(QasmResultCache &&) = delete;
+
+    [[nodiscard]] auto getCapacity() const -> size_t { return capacity; }
+    [[nodiscard]] auto getSize() const -> size_t { return entries.size(); }
+    [[nodiscard]] auto getHits() const -> size_t { return hits; }
+    [[nodiscard]] auto getMisses() const -> size_t { return misses; }
+    [[nodiscard]] auto isPersistent() const -> bool { return !directory.empty(); }
+
+    /**
+     * Compute the (non-cryptographic) 128-bit digest of the given parts as a hex string.
+     *
+     * Each part is length-prefixed so that different splits of the same text differ. The
+     * digest is stable across processes and platforms, as required by the on-disk store.
+     */
+    [[nodiscard]] static auto digest(std::initializer_list<std::string_view> parts) -> std::string
+    {
+        // Two FNV-1a streams with different offset bases, each finalized with the splitmix64
+        // mixer.
+        constexpr uint64_t fnv_prime = 0x100000001b3ULL;
+        std::array<uint64_t, 2> state = {0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL};
+
+        auto update = [&state](unsigned char byte) {
+            state[0] = (state[0] ^ byte) * fnv_prime;
+            state[1] = (state[1] ^ static_cast<unsigned char>(byte + 0x5b)) * fnv_prime;
+        };
+
+        for (auto part : parts) {
+            uint64_t size = part.size();
+            for (size_t idx = 0; idx < sizeof(size); idx++) {
+                update(static_cast<unsigned char>(size >> (8 * idx)));
+            }
+            for (char c : part) {
+                update(static_cast<unsigned char>(c));
+            }
+        }
+
+        constexpr std::string_view hex_digits = "0123456789abcdef";
+        std::string res;
+        res.reserve(32);
+        for (uint64_t hash : state) {
+            hash ^= hash >> 30;
+            hash *= 0xbf58476d1ce4e5b9ULL;
+            hash ^= hash >> 27;
+            hash *= 0x94d049bb133111ebULL;
+            hash ^= hash >> 31;
+            for (int shift = 60; shift >= 0; shift -= 4) {
+                res += hex_digits[(hash >> shift) & 0xF];
+            }
+        }
+        return res;
+    }
+
+    /**
+     * Lookup the result of the given digest, in memory and then in the on-disk store.
+     */
+    [[nodiscard]] auto lookup(const std::string &key) -> std::optional<std::vector<double>>
+    {
+        if (auto it = index.find(key); it != index.end()) {
+            entries.splice(entries.begin(), entries, it->second);
+            hits++;
+            return it->second->second;
+        }
+
+        if (isPersistent()) {
+            if (auto values = load(key)) {
+                insertInMemory(key, *values);
+                hits++;
+                return values;
+            }
+        }
+
+        misses++;
+        return std::nullopt;
+    }
+
+    /**
+     * Insert the result of the given digest, evicting the least recently used one when full.
+     */
+    void insert(const std::string &key, const std::vector<double> &values)
+    {
+        if (isPersistent()) {
+            store(key, values);
+        }
+        insertInMemory(key, values);
+    }
+
+    /**
+     * Clear the results kept in memory. The on-disk store isn't modified.
+     */
+    void clear()
+    {
+        entries.clear();
+        index.clear();
+    }
+};
+
+} // namespace Catalyst::Runtime::Device::OpenQasm
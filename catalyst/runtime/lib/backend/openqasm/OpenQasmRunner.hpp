@@ -14,29 +14,64 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <complex>
+#include <cstdint>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
+#include <system_error>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "DynamicLibraryLoader.hpp"
 #include "Exception.hpp"
+#include "OpenQasmJob.hpp"
 
 namespace Catalyst::Runtime::Device::OpenQasm {
 
+/**
+ * Pack the flattened samples of size `shots * num_qubits` into one integer per shot, in which
+ * the first qubit is the most significant bit.
+ */
+inline auto packSamples(const std::vector<size_t> &samples, size_t shots, size_t num_qubits)
+    -> std::vector<uint64_t>
+{
+    RT_FAIL_IF(num_qubits > 64, "Unable to pack the samples of more than 64 qubits");
+    RT_FAIL_IF(samples.size() != shots * num_qubits, "Invalid number of samples to pack");
+
+    std::vector<uint64_t> packed(shots, 0);
+    auto iter = samples.begin();
+    for (auto &state : packed) {
+        for (size_t idx = 0; idx < num_qubits; idx++) {
+            state = (state << 1) | static_cast<uint64_t>(*(iter++) & 1UL);
+        }
+    }
+    return packed;
+}
+
 /**
  * The OpenQasm circuit runner interface.
+ *
+ * The optional `inputs` argument binds the values of the `input` variables of a parametric
+ * program, serialized as `name:value` pairs separated by commas (see `serializeInputs`).
+ *
+ * Runners owned by a `std::shared_ptr` are kept alive by the jobs they submitted.
  */
-struct OpenQasmRunner {
+struct OpenQasmRunner : public std::enable_shared_from_this<OpenQasmRunner> {
     explicit OpenQasmRunner() = default;
     virtual ~OpenQasmRunner() = default;
     [[nodiscard]] virtual auto runCircuit([[maybe_unused]] const std::string &circuit,
                                           [[maybe_unused]] const std::string &device,
                                           [[maybe_unused]] size_t shots,
-                                          [[maybe_unused]] const std::string &kwargs = "") const
+                                          [[maybe_unused]] const std::string &kwargs = "",
+                                          [[maybe_unused]] const std::string &inputs = "") const
         -> std::string
     {
         RT_FAIL("Not implemented method");
@@ -45,7 +80,8 @@ struct OpenQasmRunner {
     [[nodiscard]] virtual auto
     Probs([[maybe_unused]] const std::string &circuit, [[maybe_unused]] const std::string &device,
           [[maybe_unused]] size_t shots, [[maybe_unused]] size_t num_qubits,
-          [[maybe_unused]] const std::string &kwargs = "") const -> std::vector<double>
+          [[maybe_unused]] const std::string &kwargs = "",
+          [[maybe_unused]] const std::string &inputs = "") const -> std::vector<double>
     {
         RT_FAIL("Not implemented method");
         return {};
@@ -53,15 +89,54 @@ struct OpenQasmRunner {
     [[nodiscard]] virtual auto
     Sample([[maybe_unused]] const std::string &circuit, [[maybe_unused]] const std::string &device,
            [[maybe_unused]] size_t shots, [[maybe_unused]] size_t num_qubits,
-           [[maybe_unused]] const std::string &kwargs = "") const -> std::vector<size_t>
+           [[maybe_unused]] const std::string &kwargs = "",
+           [[maybe_unused]] const std::string &inputs = "") const -> std::vector<size_t>
     {
         RT_FAIL("Not implemented method");
         return {};
     }
+    /**
+     * Compute the probabilities (see `Probs`) directly into the caller's contiguous `buffer` of
+     * `size` elements.
+     */
+    virtual void ProbsInto(double *buffer, size_t size, const std::string &circuit,
+                           const std::string &device, size_t shots, size_t num_qubits,
+                           const std::string &kwargs = "", const std::string &inputs = "") const
+    {
+        auto &&probs = Probs(circuit, device, shots, num_qubits, kwargs, inputs);
+        RT_FAIL_IF(probs.size() != size, "Invalid size for the pre-allocated probabilities");
+        std::copy(probs.begin(), probs.end(), buffer);
+    }
+    /**
+     * Sample the computational basis states (see `Sample`) directly into the caller's
+     * contiguous `buffer` of `size = shots * num_qubits` elements.
+     */
+    virtual void SampleInto(double *buffer, size_t size, const std::string &circuit,
+                            const std::string &device, size_t shots, size_t num_qubits,
+                            const std::string &kwargs = "", const std::string &inputs = "") const
+    {
+        auto &&samples = Sample(circuit, device, shots, num_qubits, kwargs, inputs);
+        RT_FAIL_IF(samples.size() != size, "Invalid size for the pre-allocated samples");
+        std::transform(samples.begin(), samples.end(), buffer,
+                       [](size_t bit) { return static_cast<double>(bit); });
+    }
+    /**
+     * Sample the computational basis states with one packed integer per shot, in which wire 0
+     * is the most significant bit. The default implementation packs the bits of `Sample`.
+     */
+    [[nodiscard]] virtual auto PackedSample(const std::string &circuit, const std::string &device,
+                                            size_t shots, size_t num_qubits,
+                                            const std::string &kwargs = "",
+                                            const std::string &inputs = "") const
+        -> std::vector<uint64_t>
+    {
+        return packSamples(Sample(circuit, device, shots, num_qubits, kwargs, inputs), shots,
+                           num_qubits);
+    }
     [[nodiscard]] virtual auto
     Expval([[maybe_unused]] const std::string &circuit, [[maybe_unused]] const std::string &device,
-           [[maybe_unused]] size_t shots, [[maybe_unused]] const std::string &kwargs = "") const
-        -> double
+           [[maybe_unused]] size_t shots, [[maybe_unused]] const std::string &kwargs = "",
+           [[maybe_unused]] const std::string &inputs = "") const -> double
     {
         RT_FAIL("Not implemented method");
         return {};
@@ -69,15 +144,54 @@ struct OpenQasmRunner {
     [[nodiscard]] virtual auto Var([[maybe_unused]] const std::string &circuit,
                                    [[maybe_unused]] const std::string &device,
                                    [[maybe_unused]] size_t shots,
-                                   [[maybe_unused]] const std::string &kwargs = "") const -> double
+                                   [[maybe_unused]] const std::string &kwargs = "",
+                                   [[maybe_unused]] const std::string &inputs = "") const -> double
     {
         RT_FAIL("Not implemented method");
         return {};
     }
+    [[nodiscard]] virtual auto Values([[maybe_unused]] const std::string &circuit,
+                                      [[maybe_unused]] const std::string &device,
+                                      [[maybe_unused]] size_t shots,
+                                      [[maybe_unused]] const std::string &kwargs = "",
+                                      [[maybe_unused]] const std::string &inputs = "") const
+        -> std::vector<double>
+    {
+        RT_FAIL("Not implemented method");
+        return {};
+    }
+    /**
+     * Submit the program without waiting for its measurement values (see `Values`). The default
+     * implementation executes `Values` on another thread, which shares the ownership of the
+     * runner. Runners that are not owned by a `std::shared_ptr` execute `Values` before
+     * returning the job instead.
+     */
+    [[nodiscard]] virtual auto SubmitValues(const std::string &circuit, const std::string &device,
+                                            size_t shots, const std::string &kwargs = "",
+                                            const std::string &inputs = "") const -> QasmJob
+    {
+        auto self = weak_from_this().lock();
+        if (!self) {
+            std::promise<std::vector<double>> promise;
+            try {
+                promise.set_value(Values(circuit, device, shots, kwargs, inputs));
+            }
+            catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+            return QasmJob{promise.get_future().share()};
+        }
+
+        auto run = [self = std::move(self), circuit, device, shots, kwargs, inputs]() {
+            return self->Values(circuit, device, shots, kwargs, inputs);
+        };
+        return QasmJob{std::async(std::launch::async, std::move(run)).share()};
+    }
     [[nodiscard]] virtual auto
     State([[maybe_unused]] const std::string &circuit, [[maybe_unused]] const std::string &device,
           [[maybe_unused]] size_t shots, [[maybe_unused]] size_t num_qubits,
-          [[maybe_unused]] const std::string &kwargs = "") const
+          [[maybe_unused]] const std::string &kwargs = "",
+          [[maybe_unused]] const std::string &inputs = "") const
         -> std::vector<std::complex<double>>
     {
         RT_FAIL("Not implemented method");
@@ -87,7 +201,8 @@ struct OpenQasmRunner {
                                         [[maybe_unused]] const std::string &device,
                                         [[maybe_unused]] size_t shots,
                                         [[maybe_unused]] size_t num_qubits,
-                                        [[maybe_unused]] const std::string &kwargs = "") const
+                                        [[maybe_unused]] const std::string &kwargs = "",
+                                        [[maybe_unused]] const std::string &inputs = "") const
         -> std::vector<double>
     {
         RT_FAIL("Not implemented method");
@@ -95,78 +210,425 @@ struct OpenQasmRunner {
     }
 };
 
+/**
+ * Serialize the values of the `input` variables of a parametric program for the runners.
+ * Values are written in their shortest round-trip representation.
+ */
+inline auto serializeInputs(const std::vector<std::pair<std::string, double>> &inputs)
+    -> std::string
+{
+    std::string serialized;
+    std::array<char, 32> buffer{};
+    for (const auto &[name, value] : inputs) {
+        if (!serialized.empty()) {
+            serialized += ",";
+        }
+        serialized += name;
+        serialized += ":";
+        auto &&[ptr, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        RT_FAIL_IF(ec != std::errc(), "Failed to serialize the input value");
+        serialized.append(buffer.data(), ptr);
+    }
+    return serialized;
+}
+
+/**
+ * Deserialize the values of the `input` variables of a parametric program (see
+ * `serializeInputs`).
+ */
+inline auto deserializeInputs(const std::string &inputs) -> std::unordered_map<std::string, double>
+{
+    std::unordered_map<std::string, double> values;
+    size_t begin = 0;
+    while (begin < inputs.size()) {
+        size_t end = inputs.find(',', begin);
+        if (end == std::string::npos) {
+            end = inputs.size();
+        }
+
+        const size_t sep = inputs.find(':', begin);
+        RT_FAIL_IF(sep == std::string::npos || sep >= end, "Invalid serialized input value");
+
+        double value{0.0};
+        auto &&[ptr, ec] = std::from_chars(inputs.data() + sep + 1, inputs.data() + end, value);
+        RT_FAIL_IF(ec != std::errc() || ptr != inputs.data() + end,
+                   "Invalid serialized input value");
+
+        values[inputs.substr(begin, sep - begin)] = value;
+        begin = end + 1;
+    }
+    return values;
+}
+
 /**
  * The OpenQasm circuit runner to execute an OpenQasm circuit on Braket Devices backed by
  * Amazon Braket Python SDK.
+ *
+ * The runner owns a long-lived session: the `OPENQASM_PY` library is loaded and its symbols are
+ * resolved once, and the Python namespace holding the Braket helpers and the device objects is
+ * created on first use and kept alive until `closeSession()` is called or the runner is destroyed.
  */
 struct BraketRunner : public OpenQasmRunner {
-    [[nodiscard]] auto runCircuit(const std::string &circuit, const std::string &device,
-                                  size_t shots, const std::string &kwargs = "") const
-        -> std::string override
+  private:
+    using openSession_t = void *(*)();
+    using closeSession_t = void (*)(void *);
+    using runCircuitImpl_t =
+        char *(*)(void *, const char *, const char *, size_t, const char *, const char *);
+    using probsImpl_t = void *(*)(void *, const char *, const char *, size_t, size_t, const char *,
+                                  const char *, void *);
+    using samplesImpl_t = void *(*)(void *, const char *, const char *, size_t, size_t,
+                                    const char *, const char *, void *);
+    using packedSamplesImpl_t = void *(*)(void *, const char *, const char *, size_t, size_t,
+                                          const char *, const char *, void *);
+    using probsIntoImpl_t = void (*)(void *, const char *, const char *, size_t, size_t,
+                                     const char *, const char *, double *, size_t);
+    using samplesIntoImpl_t = void (*)(void *, const char *, const char *, size_t, size_t,
+                                       const char *, const char *, double *, size_t);
+    using expvalImpl_t =
+        double (*)(void *, const char *, const char *, size_t, const char *, const char *);
+    using varImpl_t =
+        double (*)(void *, const char *, const char *, size_t, const char *, const char *);
+    using valuesImpl_t =
+        void (*)(void *, const char *, const char *, size_t, const char *, const char *, void *);
+    using submitImpl_t =
+        size_t (*)(void *, const char *, const char *, size_t, const char *, const char *);
+    using collectValuesImpl_t = void (*)(void *, size_t, void *);
+    using isTaskDoneImpl_t = bool (*)(void *, size_t);
+    using releaseTaskImpl_t = void (*)(void *, size_t);
+
+    /**
+     * The session of the runner. It is shared with the submitted tasks, so that their jobs may
+     * outlive the runner. The calls into the session hold `mutex` in shared mode, while opening
+     * and closing it hold `mutex` exclusively, so that the handle is never closed during a call.
+     */
+    struct Session {
+        std::shared_mutex mutex{};
+
+        std::unique_ptr<DynamicLibraryLoader> libLoader{};
+        void *handle{nullptr};
+        // Incremented whenever the session is closed, as the ids of the submitted tasks are only
+        // valid within the session that created them.
+        size_t generation{0};
+
+        openSession_t openSessionImpl{nullptr};
+        closeSession_t closeSessionImpl{nullptr};
+        runCircuitImpl_t runCircuitImpl{nullptr};
+        probsImpl_t probsImpl{nullptr};
+        samplesImpl_t samplesImpl{nullptr};
+        packedSamplesImpl_t packedSamplesImpl{nullptr};
+        probsIntoImpl_t probsIntoImpl{nullptr};
+        samplesIntoImpl_t samplesIntoImpl{nullptr};
+        expvalImpl_t expvalImpl{nullptr};
+        varImpl_t varImpl{nullptr};
+        valuesImpl_t valuesImpl{nullptr};
+        submitImpl_t submitImpl{nullptr};
+        collectValuesImpl_t collectValuesImpl{nullptr};
+        isTaskDoneImpl_t isTaskDoneImpl{nullptr};
+        releaseTaskImpl_t releaseTaskImpl{nullptr};
+
+        Session() = default;
+        ~Session() { close(); }
+
+        Session(const Session &) = delete;
+        Session &operator=(const Session &) = delete;
+        Session(Session &&) = delete;
+        Session &operator=(Session &&) = delete;
+
+        // Requires the exclusive lock
+        void open()
+        {
+            if (!libLoader) {
+                auto loader = std::make_unique<DynamicLibraryLoader>(OPENQASM_PY);
+                openSessionImpl = loader->getSymbol<openSession_t>("openSession");
+                closeSessionImpl = loader->getSymbol<closeSession_t>("closeSession");
+                runCircuitImpl = loader->getSymbol<runCircuitImpl_t>("runCircuit");
+                probsImpl = loader->getSymbol<probsImpl_t>("probs");
+                samplesImpl = loader->getSymbol<samplesImpl_t>("samples");
+                packedSamplesImpl = loader->getSymbol<packedSamplesImpl_t>("packedSamples");
+                probsIntoImpl = loader->getSymbol<probsIntoImpl_t>("probsInto");
+                samplesIntoImpl = loader->getSymbol<samplesIntoImpl_t>("samplesInto");
+                expvalImpl = loader->getSymbol<expvalImpl_t>("expval");
+                varImpl = loader->getSymbol<varImpl_t>("var");
+                valuesImpl = loader->getSymbol<valuesImpl_t>("values");
+                submitImpl = loader->getSymbol<submitImpl_t>("submit");
+                collectValuesImpl = loader->getSymbol<collectValuesImpl_t>("collectValues");
+                isTaskDoneImpl = loader->getSymbol<isTaskDoneImpl_t>("isTaskDone");
+                releaseTaskImpl = loader->getSymbol<releaseTaskImpl_t>("releaseTask");
+                libLoader = std::move(loader);
+            }
+
+            if (!handle) {
+                handle = openSessionImpl();
+            }
+        }
+
+        // Requires the exclusive lock
+        void close()
+        {
+            if (handle) {
+                closeSessionImpl(handle);
+                handle = nullptr;
+                generation++;
+            }
+        }
+    };
+
+    /**
+     * A Braket task submitted by `SubmitValues`, shared by the copies of its job. The task is
+     * released from its session with the last copy, whether or not it was collected.
+     */
+    struct SubmittedTask {
+        std::shared_ptr<Session> session;
+        size_t id;
+        size_t generation;
+
+        SubmittedTask(std::shared_ptr<Session> _session, size_t _id, size_t _generation)
+            : session(std::move(_session)), id(_id), generation(_generation)
+        {
+        }
+        ~SubmittedTask()
+        {
+            // Closing the session already released its tasks.
+            auto &&lock = lockSession();
+            if (lock.owns_lock()) {
+                try {
+                    session->releaseTaskImpl(session->handle, id);
+                }
+                catch (...) {
+                }
+            }
+        }
+
+        SubmittedTask(const SubmittedTask &) = delete;
+        SubmittedTask &operator=(const SubmittedTask &) = delete;
+        SubmittedTask(SubmittedTask &&) = delete;
+        SubmittedTask &operator=(SubmittedTask &&) = delete;
+
+        /**
+         * Lock the session of the task for a call, or return an empty lock if the session was
+         * closed since the submission.
+         */
+        [[nodiscard]] auto lockSession() const -> std::shared_lock<std::shared_mutex>
+        {
+            std::shared_lock<std::shared_mutex> lock(session->mutex);
+            if (!session->handle || session->generation != generation) {
+                lock.unlock();
+            }
+            return lock;
+        }
+    };
+
+    const std::shared_ptr<Session> session = std::make_shared<Session>();
+
+    /**
+     * Lock the session for a call, after opening it if needed.
+     */
+    [[nodiscard]] auto lockSession() const -> std::shared_lock<std::shared_mutex>
+    {
+        while (true) {
+            std::shared_lock<std::shared_mutex> lock(session->mutex);
+            if (session->handle) {
+                return lock;
+            }
+            lock.unlock();
+
+            // The session may be closed again before it is locked for the call
+            std::unique_lock<std::shared_mutex> exclusive(session->mutex);
+            session->open();
+        }
+    }
+
+  public:
+    BraketRunner() = default;
+    ~BraketRunner() override { closeSession(); }
+
+    BraketRunner(const BraketRunner &) = delete;
+    BraketRunner &operator=(const BraketRunner &) = delete;
+    BraketRunner(BraketRunner &&) = delete;
+    BraketRunner &operator=(BraketRunner &&) = delete;
+
+    /**
+     * Open the runner session eagerly. Otherwise, it is opened by the first execution.
+     */
+    void openSession() const
+    {
+        std::unique_lock<std::shared_mutex> lock(session->mutex);
+        session->open();
+    }
+
+    /**
+     * Release the Python namespace and the cached Braket device objects. The shared library
+     * stays loaded, and a new session is opened by the next execution. Pending calls into the
+     * session are completed first, and the jobs of the session can no longer be collected.
+     */
+    void closeSession() const
+    {
+        std::unique_lock<std::shared_mutex> lock(session->mutex);
+        session->close();
+    }
+
+    [[nodiscard]] auto isSessionOpen() const -> bool
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
+        std::shared_lock<std::shared_mutex> lock(session->mutex);
+        return session->handle != nullptr;
+    }
 
-        using func_ptr_t = char *(*)(const char *, const char *, size_t, const char *);
-        auto runCircuitImpl = libLoader.getSymbol<func_ptr_t>("runCircuit");
+    [[nodiscard]] auto runCircuit(const std::string &circuit, const std::string &device,
+                                  size_t shots, const std::string &kwargs = "",
+                                  const std::string &inputs = "") const -> std::string override
+    {
+        auto &&lock = lockSession();
+        auto &s = *session;
 
-        char *message = runCircuitImpl(circuit.c_str(), device.c_str(), shots, kwargs.c_str());
+        char *message = s.runCircuitImpl(s.handle, circuit.c_str(), device.c_str(), shots,
+                                         kwargs.c_str(), inputs.c_str());
         std::string messageStr(message);
         free(message);
         return messageStr;
     }
 
     [[nodiscard]] auto Probs(const std::string &circuit, const std::string &device, size_t shots,
-                             size_t num_qubits, const std::string &kwargs = "") const
-        -> std::vector<double> override
+                             size_t num_qubits, const std::string &kwargs = "",
+                             const std::string &inputs = "") const -> std::vector<double> override
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
-
-        using probsImpl_t =
-            void *(*)(const char *, const char *, size_t, size_t, const char *, void *);
-        auto probsImpl = libLoader.getSymbol<probsImpl_t>("probs");
+        auto &&lock = lockSession();
+        auto &s = *session;
 
         std::vector<double> probs;
-        probsImpl(circuit.c_str(), device.c_str(), shots, num_qubits, kwargs.c_str(), &probs);
+        s.probsImpl(s.handle, circuit.c_str(), device.c_str(), shots, num_qubits, kwargs.c_str(),
+                    inputs.c_str(), &probs);
 
         return probs;
     }
 
     [[nodiscard]] auto Sample(const std::string &circuit, const std::string &device, size_t shots,
-                              size_t num_qubits, const std::string &kwargs = "") const
-        -> std::vector<size_t> override
+                              size_t num_qubits, const std::string &kwargs = "",
+                              const std::string &inputs = "") const -> std::vector<size_t> override
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
-
-        using samplesImpl_t =
-            void *(*)(const char *, const char *, size_t, size_t, const char *, void *);
-        auto samplesImpl = libLoader.getSymbol<samplesImpl_t>("samples");
+        auto &&lock = lockSession();
+        auto &s = *session;
 
         std::vector<size_t> samples;
-        samplesImpl(circuit.c_str(), device.c_str(), shots, num_qubits, kwargs.c_str(), &samples);
+        s.samplesImpl(s.handle, circuit.c_str(), device.c_str(), shots, num_qubits,
+                      kwargs.c_str(), inputs.c_str(), &samples);
 
         return samples;
     }
 
-    [[nodiscard]] auto Expval(const std::string &circuit, const std::string &device, size_t shots,
-                              const std::string &kwargs = "") const -> double override
+    void ProbsInto(double *buffer, size_t size, const std::string &circuit,
+                   const std::string &device, size_t shots, size_t num_qubits,
+                   const std::string &kwargs = "", const std::string &inputs = "") const override
+    {
+        RT_FAIL_IF(num_qubits >= 64, "Unable to compute the probabilities of 64 qubits or more");
+        RT_FAIL_IF(size != (1UL << num_qubits), "Invalid size for the pre-allocated probabilities");
+
+        auto &&lock = lockSession();
+        auto &s = *session;
+        s.probsIntoImpl(s.handle, circuit.c_str(), device.c_str(), shots, num_qubits,
+                        kwargs.c_str(), inputs.c_str(), buffer, size);
+    }
+
+    void SampleInto(double *buffer, size_t size, const std::string &circuit,
+                    const std::string &device, size_t shots, size_t num_qubits,
+                    const std::string &kwargs = "", const std::string &inputs = "") const override
+    {
+        RT_FAIL_IF(size != shots * num_qubits, "Invalid size for the pre-allocated samples");
+
+        auto &&lock = lockSession();
+        auto &s = *session;
+        s.samplesIntoImpl(s.handle, circuit.c_str(), device.c_str(), shots, num_qubits,
+                          kwargs.c_str(), inputs.c_str(), buffer, size);
+    }
+
+    [[nodiscard]] auto PackedSample(const std::string &circuit, const std::string &device,
+                                    size_t shots, size_t num_qubits,
+                                    const std::string &kwargs = "",
+                                    const std::string &inputs = "") const
+        -> std::vector<uint64_t> override
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
+        RT_FAIL_IF(num_qubits > 64, "Unable to pack the samples of more than 64 qubits");
 
-        using expvalImpl_t = double (*)(const char *, const char *, size_t, const char *);
-        auto expvalImpl = libLoader.getSymbol<expvalImpl_t>("expval");
+        auto &&lock = lockSession();
+        auto &s = *session;
 
-        return expvalImpl(circuit.c_str(), device.c_str(), shots, kwargs.c_str());
+        std::vector<uint64_t> samples;
+        s.packedSamplesImpl(s.handle, circuit.c_str(), device.c_str(), shots, num_qubits,
+                            kwargs.c_str(), inputs.c_str(), &samples);
+
+        return samples;
+    }
+
+    [[nodiscard]] auto Expval(const std::string &circuit, const std::string &device, size_t shots,
+                              const std::string &kwargs = "", const std::string &inputs = "") const
+        -> double override
+    {
+        auto &&lock = lockSession();
+        auto &s = *session;
+        return s.expvalImpl(s.handle, circuit.c_str(), device.c_str(), shots, kwargs.c_str(),
+                            inputs.c_str());
     }
 
     [[nodiscard]] auto Var(const std::string &circuit, const std::string &device, size_t shots,
-                           const std::string &kwargs = "") const -> double override
+                           const std::string &kwargs = "", const std::string &inputs = "") const
+        -> double override
+    {
+        auto &&lock = lockSession();
+        auto &s = *session;
+        return s.varImpl(s.handle, circuit.c_str(), device.c_str(), shots, kwargs.c_str(),
+                         inputs.c_str());
+    }
+
+    [[nodiscard]] auto Values(const std::string &circuit, const std::string &device, size_t shots,
+                              const std::string &kwargs = "", const std::string &inputs = "") const
+        -> std::vector<double> override
     {
-        DynamicLibraryLoader libLoader(OPENQASM_PY);
+        auto &&lock = lockSession();
+        auto &s = *session;
+
+        std::vector<double> values;
+        s.valuesImpl(s.handle, circuit.c_str(), device.c_str(), shots, kwargs.c_str(),
+                     inputs.c_str(), &values);
+
+        return values;
+    }
+
+    /**
+     * Create the Braket task without waiting for it. The job is ready once the task reaches a
+     * final state, and its result is fetched by the first call to `getValues` of the job, within
+     * the same session. Tasks that are never collected are cancelled, if still running, and
+     * released with the last copy of the job.
+     */
+    [[nodiscard]] auto SubmitValues(const std::string &circuit, const std::string &device,
+                                    size_t shots, const std::string &kwargs = "",
+                                    const std::string &inputs = "") const -> QasmJob override
+    {
+        size_t id{0};
+        size_t generation{0};
+        {
+            auto &&lock = lockSession();
+            id = session->submitImpl(session->handle, circuit.c_str(), device.c_str(), shots,
+                                     kwargs.c_str(), inputs.c_str());
+            generation = session->generation;
+        }
+        // Created once the session is unlocked, as the task locks it again to be released
+        auto task = std::make_shared<SubmittedTask>(session, id, generation);
+
+        auto collect = [task]() {
+            auto &&lock = task->lockSession();
+            RT_FAIL_IF(!lock.owns_lock(), "Invalid job; the session of its task was closed");
 
-        using varImpl_t = double (*)(const char *, const char *, size_t, const char *);
-        auto varImpl = libLoader.getSymbol<varImpl_t>("var");
+            std::vector<double> values;
+            task->session->collectValuesImpl(task->session->handle, task->id, &values);
 
-        return varImpl(circuit.c_str(), device.c_str(), shots, kwargs.c_str());
+            return values;
+        };
+        auto poll = [task]() {
+            auto &&lock = task->lockSession();
+            return !lock.owns_lock() ||
+                   task->session->isTaskDoneImpl(task->session->handle, task->id);
+        };
+        return QasmJob{std::async(std::launch::deferred, std::move(collect)).share(),
+                       std::move(poll)};
     }
 };
 
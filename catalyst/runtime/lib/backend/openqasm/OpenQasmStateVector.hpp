@@ -0,0 +1,203 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "Exception.hpp"
+
+namespace Catalyst::Runtime::Device::OpenQasm {
+
+/**
+ * A dense state-vector engine for the native OpenQasm runner.
+ *
+ * The wire ordering follows the OpenQasm/Braket convention: wire 0 is the most significant
+ * bit of a basis-state index, and the first wire of a gate is the most significant bit of the
+ * row/column index of its matrix.
+ *
+ * @param num_qubits The number of qubits, initialized in the |0...0> state
+ */
+class QasmStateVector {
+  private:
+    size_t num_qubits;
+    std::vector<std::complex<double>> data;
+
+    [[nodiscard]] auto getBit(size_t wire) const -> size_t { return num_qubits - 1 - wire; }
+
+    [[nodiscard]] auto isValidWires(const std::vector<size_t> &wires) const -> bool
+    {
+        std::vector<bool> used(num_qubits, false);
+        return std::all_of(wires.begin(), wires.end(), [this, &used](size_t wire) {
+            if (wire >= num_qubits || used[wire]) {
+                return false;
+            }
+            used[wire] = true;
+            return true;
+        });
+    }
+
+  public:
+    explicit QasmStateVector(size_t _num_qubits)
+        : num_qubits(_num_qubits), data(1UL << _num_qubits, {0.0, 0.0})
+    {
+        data[0] = {1.0, 0.0};
+    }
+    ~QasmStateVector() = default;
+
+    [[nodiscard]] auto getNumQubits() const -> size_t { return num_qubits; }
+    [[nodiscard]] auto getData() const -> const std::vector<std::complex<double>> & { return data; }
+
+    /**
+     * Apply a (row-major) matrix of size `2^k x 2^k` to `k` distinct wires.
+     */
+    void applyMatrix(const std::vector<std::complex<double>> &matrix,
+                     const std::vector<size_t> &wires)
+    {
+        RT_FAIL_IF(wires.empty() || !isValidWires(wires), "Invalid wires to apply the matrix to");
+
+        const size_t k = wires.size();
+        const size_t dim = 1UL << k;
+        RT_FAIL_IF(matrix.size() != dim * dim, "Invalid size of the matrix for the given wires");
+
+        // Offsets of the 2^k amplitudes of a block relative to the index of its first amplitude
+        std::vector<size_t> offsets(dim, 0);
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t idx = 0; idx < k; idx++) {
+                if ((row >> (k - 1 - idx)) & 1UL) {
+                    offsets[row] |= 1UL << getBit(wires[idx]);
+                }
+            }
+        }
+
+        std::vector<size_t> bits(k);
+        std::transform(wires.begin(), wires.end(), bits.begin(),
+                       [this](size_t wire) { return getBit(wire); });
+        std::sort(bits.begin(), bits.end());
+
+        std::vector<std::complex<double>> block(dim);
+        const size_t num_blocks = data.size() >> k;
+        for (size_t outer = 0; outer < num_blocks; outer++) {
+            // Insert a zero at each target bit to get the index of the first amplitude
+            size_t base = outer;
+            for (auto bit : bits) {
+                const size_t low = base & ((1UL << bit) - 1);
+                base = ((base >> bit) << (bit + 1)) | low;
+            }
+
+            for (size_t row = 0; row < dim; row++) {
+                block[row] = data[base + offsets[row]];
+            }
+            for (size_t row = 0; row < dim; row++) {
+                std::complex<double> acc{0.0, 0.0};
+                for (size_t col = 0; col < dim; col++) {
+                    acc += matrix[row * dim + col] * block[col];
+                }
+                data[base + offsets[row]] = acc;
+            }
+        }
+    }
+
+    /**
+     * Compute `<this|other>`.
+     */
+    [[nodiscard]] auto innerProduct(const QasmStateVector &other) const -> std::complex<double>
+    {
+        RT_FAIL_IF(other.num_qubits != num_qubits, "Invalid number of qubits");
+        return std::inner_product(data.begin(), data.end(), other.data.begin(),
+                                  std::complex<double>{0.0, 0.0}, std::plus<>{},
+                                  [](auto lhs, auto rhs) { return std::conj(lhs) * rhs; });
+    }
+
+    /**
+     * Compute the marginal probabilities of the basis states of the given wires.
+     */
+    [[nodiscard]] auto probabilities(const std::vector<size_t> &wires) const -> std::vector<double>
+    {
+        RT_FAIL_IF(!isValidWires(wires), "Invalid wires to compute the probabilities of");
+
+        const size_t k = wires.size();
+        std::vector<double> probs(1UL << k, 0.0);
+
+        bool all_wires = (k == num_qubits);
+        for (size_t idx = 0; all_wires && idx < k; idx++) {
+            all_wires = (wires[idx] == idx);
+        }
+
+        for (size_t index = 0; index < data.size(); index++) {
+            size_t sub_index = index;
+            if (!all_wires) {
+                sub_index = 0;
+                for (size_t idx = 0; idx < k; idx++) {
+                    sub_index |= ((index >> getBit(wires[idx])) & 1UL) << (k - 1 - idx);
+                }
+            }
+            probs[sub_index] += std::norm(data[index]);
+        }
+        return probs;
+    }
+
+    /**
+     * Sample the computational basis states of the given wires, packed into one integer per
+     * shot. The first wire is the most significant bit of each sample.
+     *
+     * @return std::vector<uint64_t> The packed samples of size `shots`
+     */
+    template <typename GeneratorT>
+    [[nodiscard]] auto samplePacked(const std::vector<size_t> &wires, size_t shots,
+                                    GeneratorT &generator) const -> std::vector<uint64_t>
+    {
+        auto &&probs = probabilities(wires);
+        std::partial_sum(probs.begin(), probs.end(), probs.begin());
+
+        std::uniform_real_distribution<double> distribution(0.0, probs.back());
+
+        std::vector<uint64_t> samples(shots);
+        for (auto &state : samples) {
+            auto pos = std::upper_bound(probs.begin(), probs.end(), distribution(generator));
+            state = std::min(static_cast<size_t>(pos - probs.begin()), probs.size() - 1);
+        }
+        return samples;
+    }
+
+    /**
+     * Sample the computational basis states of the given wires.
+     *
+     * @return std::vector<size_t> The flattened samples of size `shots * wires.size()`
+     */
+    template <typename GeneratorT>
+    [[nodiscard]] auto sample(const std::vector<size_t> &wires, size_t shots,
+                              GeneratorT &generator) const -> std::vector<size_t>
+    {
+        auto &&packed = samplePacked(wires, shots, generator);
+
+        const size_t k = wires.size();
+        std::vector<size_t> samples(shots * k);
+        auto iter = samples.begin();
+        for (auto state : packed) {
+            for (size_t idx = 0; idx < k; idx++) {
+                *(iter++) = (state >> (k - 1 - idx)) & 1UL;
+            }
+        }
+        return samples;
+    }
+};
+
+} // namespace Catalyst::Runtime::Device::OpenQasm
@@ -12,26 +12,42 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <vector>
 
 #include <nanobind/eval.h>
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <nanobind/stl/string.h>
 
 const std::string program = R"(
+import itertools
 import numpy as np
 from braket.aws import AwsDevice
 from braket.devices import LocalSimulator
 from braket.ir.openqasm import Program as OpenQasmProgram
 
+# Device objects are created once per session and reused across executions.
+_device_cache = {}
+
 def py_sanitize_device(user_submitted_device):
+    if user_submitted_device in _device_cache:
+        return _device_cache[user_submitted_device]
+
     if user_submitted_device in {"default", "braket_sv", "braket_dm"}:
-        return LocalSimulator(user_submitted_device)
+        device = LocalSimulator(user_submitted_device)
     elif "arn:aws:braket" in user_submitted_device:
-        return AwsDevice(user_submitted_device)
+        device = AwsDevice(user_submitted_device)
+    else:
+        device = None
+
+    if device is not None:
+        _device_cache[user_submitted_device] = device
+        return device
 
     msg = "device must be either 'braket.devices.LocalSimulator' or 'braket.aws.AwsDevice'"
     raise ValueError(msg)
@@ -46,47 +62,160 @@ def py_sanitize_kwargs(user_submitted_kwargs):
         raise ValueError(msg)
     return kwargs
 
-def py_run_circuit(circuit, braket_device, kwargs, shots):
+def py_sanitize_inputs(user_submitted_inputs):
+    if user_submitted_inputs == "":
+        return None
+    inputs = (item.split(":") for item in user_submitted_inputs.split(","))
+    return {name: float(value) for name, value in inputs}
+
+def py_create_task(circuit, braket_device, kwargs, shots, inputs=""):
     device = py_sanitize_device(braket_device)
     kwargs = py_sanitize_kwargs(kwargs)
-    if not kwargs:
-        result = device.run(OpenQasmProgram(source=circuit), shots=int(shots)).result()
-    else:
-        result = device.run(OpenQasmProgram(source=circuit), shots=int(shots), s3_destination_folder=tuple(kwargs)).result()
-    return result
+    run_kwargs = {}
+    if kwargs:
+        run_kwargs["s3_destination_folder"] = tuple(kwargs)
+    inputs = py_sanitize_inputs(inputs)
+    if inputs:
+        run_kwargs["inputs"] = inputs
+    return device.run(OpenQasmProgram(source=circuit), shots=int(shots), **run_kwargs)
+
+def py_run_circuit(circuit, braket_device, kwargs, shots, inputs=""):
+    return py_create_task(circuit, braket_device, kwargs, shots, inputs).result()
+
+# Tasks submitted without waiting for their results, keyed by their job id.
+_tasks = {}
+_task_ids = itertools.count()
+
+def py_submit(circuit, braket_device, kwargs, shots, inputs=""):
+    task_id = next(_task_ids)
+    _tasks[task_id] = py_create_task(circuit, braket_device, kwargs, shots, inputs)
+    return task_id
+
+# Final states of the Braket tasks, whose results are then available without waiting.
+_final_states = {"COMPLETED", "FAILED", "CANCELLED"}
+
+def py_is_task_done(task_id):
+    task = _tasks.get(task_id)
+    return task is None or task.state() in _final_states
+
+def py_release_task(task_id):
+    task = _tasks.pop(task_id, None)
+    if task is None:
+        return
+    try:
+        if task.state() not in _final_states:
+            task.cancel()
+    except Exception:
+        # Local tasks can't be cancelled, and are dropped with the task object.
+        pass
+
+def py_collect_values(task_id):
+    task = _tasks.pop(task_id, None)
+    if task is None:
+        raise RuntimeError("Invalid job; the task was already collected or its session closed")
+    values = task.result().values
+    if not values:
+        raise RuntimeError(
+            "Unable to compute measurement results; no measurement process was specified")
+    return [float(value) for value in values]
 
-def py_var(circuit, braket_device, kwargs, shots):
-    values = py_run_circuit(circuit, braket_device, kwargs, shots).values
+def py_var(circuit, braket_device, kwargs, shots, inputs=""):
+    values = py_run_circuit(circuit, braket_device, kwargs, shots, inputs).values
     if not values:
         raise RuntimeError(
             "Unable to compute variance; no measurement process was specified")
     return values
 
-def py_expval(circuit, braket_device, kwargs, shots):
-    values = py_run_circuit(circuit, braket_device, kwargs, shots).values
+def py_expval(circuit, braket_device, kwargs, shots, inputs=""):
+    values = py_run_circuit(circuit, braket_device, kwargs, shots, inputs).values
     if not values:
         raise RuntimeError(
             "Unable to compute expectation value; no measurement process was specified")
     return values
 
-def py_samples(circuit, braket_device, kwargs, shots):
-    result = py_run_circuit(circuit, braket_device, kwargs, shots)
+def py_values(circuit, braket_device, kwargs, shots, inputs=""):
+    values = py_run_circuit(circuit, braket_device, kwargs, shots, inputs).values
+    if not values:
+        raise RuntimeError(
+            "Unable to compute measurement results; no measurement process was specified")
+    return [float(value) for value in values]
+
+def py_samples(circuit, braket_device, kwargs, shots, inputs=""):
+    result = py_run_circuit(circuit, braket_device, kwargs, shots, inputs)
     return np.array(result.measurements).flatten()
 
-def py_probs(circuit, braket_device, kwargs, shots, num_qubits):
-    result = py_run_circuit(circuit, braket_device, kwargs, shots)
+def py_packed_samples(circuit, braket_device, kwargs, shots, num_qubits, inputs=""):
+    result = py_run_circuit(circuit, braket_device, kwargs, shots, inputs)
+    num_qubits = int(num_qubits)
+    measurements = np.asarray(result.measurements, dtype=np.uint64).reshape(-1, num_qubits)
+    weights = np.left_shift(np.uint64(1), np.arange(num_qubits - 1, -1, -1, dtype=np.uint64))
+    return measurements @ weights
+
+def py_probs(circuit, braket_device, kwargs, shots, num_qubits, inputs=""):
+    result = py_run_circuit(circuit, braket_device, kwargs, shots, inputs)
     probs_dict = {int(s, 2): p for s, p in result.measurement_probabilities.items()}
     probs_list = []
     for i in range(2 ** int(num_qubits)):
         probs_list.append(probs_dict[i] if i in probs_dict else 0)
     return probs_list
 
-def py_get_results(circuit, braket_device, kwargs, shots):
-    return str(py_run_circuit(circuit, braket_device, kwargs, shots))
+# The `*_into` variants write the results into `out`, a NumPy array borrowing the caller's
+# buffer, instead of returning them.
+def py_probs_into(circuit, braket_device, kwargs, shots, num_qubits, out, inputs=""):
+    result = py_run_circuit(circuit, braket_device, kwargs, shots, inputs)
+    out.fill(0.0)
+    for state, prob in result.measurement_probabilities.items():
+        out[int(state, 2)] = prob
+
+def py_samples_into(circuit, braket_device, kwargs, shots, num_qubits, out, inputs=""):
+    result = py_run_circuit(circuit, braket_device, kwargs, shots, inputs)
+    np.copyto(out, np.asarray(result.measurements).reshape(out.shape), casting="unsafe")
+
+def py_get_results(circuit, braket_device, kwargs, shots, inputs=""):
+    return str(py_run_circuit(circuit, braket_device, kwargs, shots, inputs))
 )";
 
-extern "C" NB_EXPORT double var(const char *_circuit, const char *_device, size_t shots,
-                                const char *_kwargs)
+/**
+ * A runner session keeps the Python namespace, in which `program` has been evaluated, alive
+ * across executions. The namespace owns the cached Braket device objects.
+ */
+struct OpenQasmSession {
+    nanobind::dict scope;
+};
+
+extern "C" NB_EXPORT void *openSession()
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    auto *session = new OpenQasmSession{};
+    session->scope["__builtins__"] = nb::module_::import_("builtins");
+    try {
+        nb::exec(nb::str(program.c_str()), session->scope);
+    }
+    catch (...) {
+        delete session;
+        throw;
+    }
+    return session;
+}
+
+extern "C" NB_EXPORT void closeSession(void *_session)
+{
+    namespace nb = nanobind;
+
+    // The interpreter may already be torn down when the device is destroyed at process exit,
+    // in which case the Python objects are released with it.
+    if (!_session || !Py_IsInitialized()) {
+        return;
+    }
+
+    nb::gil_scoped_acquire lock;
+    delete reinterpret_cast<OpenQasmSession *>(_session);
+}
+
+extern "C" NB_EXPORT double var(void *_session, const char *_circuit, const char *_device,
+                                size_t shots, const char *_kwargs, const char *_inputs)
 {
     namespace nb = nanobind;
     nb::gil_scoped_acquire lock;
@@ -94,15 +223,15 @@ extern "C" NB_EXPORT double var(const char *_circuit, const char *_device, size_
     std::string circuit(_circuit);
     std::string device(_device);
     std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
-    return nb::cast<double>(scope["py_var"](circuit, device, kwargs, shots).attr("__getitem__")(0));
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    return nb::cast<double>(
+        scope["py_var"](circuit, device, kwargs, shots, inputs).attr("__getitem__")(0));
 }
 
-extern "C" NB_EXPORT double expval(const char *_circuit, const char *_device, size_t shots,
-                                   const char *_kwargs)
+extern "C" NB_EXPORT double expval(void *_session, const char *_circuit, const char *_device,
+                                   size_t shots, const char *_kwargs, const char *_inputs)
 {
     namespace nb = nanobind;
     nb::gil_scoped_acquire lock;
@@ -110,16 +239,90 @@ extern "C" NB_EXPORT double expval(const char *_circuit, const char *_device, si
     std::string circuit(_circuit);
     std::string device(_device);
     std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
     return nb::cast<double>(
-        scope["py_expval"](circuit, device, kwargs, shots).attr("__getitem__")(0));
+        scope["py_expval"](circuit, device, kwargs, shots, inputs).attr("__getitem__")(0));
+}
+
+extern "C" NB_EXPORT void values(void *_session, const char *_circuit, const char *_device,
+                                 size_t shots, const char *_kwargs, const char *_inputs,
+                                 void *_vector)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    std::string circuit(_circuit);
+    std::string device(_device);
+    std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
+
+    std::vector<double> *values = reinterpret_cast<std::vector<double> *>(_vector);
+
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    auto results = scope["py_values"](circuit, device, kwargs, shots, inputs);
+
+    for (nb::handle item : results) {
+        values->push_back(nb::cast<double>(item));
+    }
+
+    return;
+}
+
+extern "C" NB_EXPORT size_t submit(void *_session, const char *_circuit, const char *_device,
+                                  size_t shots, const char *_kwargs, const char *_inputs)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    std::string circuit(_circuit);
+    std::string device(_device);
+    std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
+
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    return nb::cast<size_t>(scope["py_submit"](circuit, device, kwargs, shots, inputs));
+}
+
+extern "C" NB_EXPORT void collectValues(void *_session, size_t task, void *_vector)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    std::vector<double> *values = reinterpret_cast<std::vector<double> *>(_vector);
+
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    auto results = scope["py_collect_values"](task);
+
+    for (nb::handle item : results) {
+        values->push_back(nb::cast<double>(item));
+    }
+
+    return;
+}
+
+extern "C" NB_EXPORT bool isTaskDone(void *_session, size_t task)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    return nb::cast<bool>(scope["py_is_task_done"](task));
 }
 
-extern "C" NB_EXPORT void samples(const char *_circuit, const char *_device, size_t shots,
-                                  size_t num_qubits, const char *_kwargs, void *_vector)
+extern "C" NB_EXPORT void releaseTask(void *_session, size_t task)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    scope["py_release_task"](task);
+}
+
+extern "C" NB_EXPORT void samples(void *_session, const char *_circuit, const char *_device,
+                                  size_t shots, size_t num_qubits, const char *_kwargs,
+                                  const char *_inputs, void *_vector)
 {
     namespace nb = nanobind;
     nb::gil_scoped_acquire lock;
@@ -127,13 +330,12 @@ extern "C" NB_EXPORT void samples(const char *_circuit, const char *_device, siz
     std::string circuit(_circuit);
     std::string device(_device);
     std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
 
     std::vector<size_t> *samples = reinterpret_cast<std::vector<size_t> *>(_vector);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
-    auto results = scope["py_samples"](circuit, device, kwargs, shots);
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    auto results = scope["py_samples"](circuit, device, kwargs, shots, inputs);
 
     samples->reserve(shots * num_qubits);
     for (nb::handle item : results) {
@@ -143,8 +345,9 @@ extern "C" NB_EXPORT void samples(const char *_circuit, const char *_device, siz
     return;
 }
 
-extern "C" NB_EXPORT void probs(const char *_circuit, const char *_device, size_t shots,
-                                size_t num_qubits, const char *_kwargs, void *_vector)
+extern "C" NB_EXPORT void packedSamples(void *_session, const char *_circuit,
+                                        const char *_device, size_t shots, size_t num_qubits,
+                                        const char *_kwargs, const char *_inputs, void *_vector)
 {
     namespace nb = nanobind;
     nb::gil_scoped_acquire lock;
@@ -152,13 +355,38 @@ extern "C" NB_EXPORT void probs(const char *_circuit, const char *_device, size_
     std::string circuit(_circuit);
     std::string device(_device);
     std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
+
+    std::vector<uint64_t> *samples = reinterpret_cast<std::vector<uint64_t> *>(_vector);
+
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    auto results =
+        scope["py_packed_samples"](circuit, device, kwargs, shots, num_qubits, inputs);
+
+    // One integer per shot is copied out of the contiguous numpy array, instead of one Python
+    // object per measured bit.
+    auto packed = nb::cast<nb::ndarray<const uint64_t, nb::ndim<1>, nb::c_contig>>(results);
+    samples->assign(packed.data(), packed.data() + packed.shape(0));
+
+    return;
+}
+
+extern "C" NB_EXPORT void probs(void *_session, const char *_circuit, const char *_device,
+                                size_t shots, size_t num_qubits, const char *_kwargs,
+                                const char *_inputs, void *_vector)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    std::string circuit(_circuit);
+    std::string device(_device);
+    std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
 
     std::vector<double> *probs = reinterpret_cast<std::vector<double> *>(_vector);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
-    auto results = scope["py_probs"](circuit, device, kwargs, shots, num_qubits);
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    auto results = scope["py_probs"](circuit, device, kwargs, shots, num_qubits, inputs);
 
     probs->reserve(std::pow(2, num_qubits));
     for (nb::handle item : results) {
@@ -168,8 +396,57 @@ extern "C" NB_EXPORT void probs(const char *_circuit, const char *_device, size_
     return;
 }
 
-extern "C" NB_EXPORT char *runCircuit(const char *_circuit, const char *_device, size_t shots,
-                                      const char *_kwargs)
+/**
+ * Wrap the caller's buffer into a NumPy array without copying it. The buffer is owned by the
+ * caller, so the capsule tying its lifetime to the array doesn't release it.
+ */
+template <typename... Shape> auto borrowBuffer(double *buffer, Shape... shape)
+{
+    namespace nb = nanobind;
+
+    nb::capsule owner(buffer, [](void *) noexcept {});
+    return nb::ndarray<nb::numpy, double, nb::ndim<sizeof...(Shape)>>(
+        buffer, {static_cast<size_t>(shape)...}, owner);
+}
+
+extern "C" NB_EXPORT void probsInto(void *_session, const char *_circuit, const char *_device,
+                                    size_t shots, size_t num_qubits, const char *_kwargs,
+                                    const char *_inputs, double *buffer, size_t size)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    std::string circuit(_circuit);
+    std::string device(_device);
+    std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
+
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    scope["py_probs_into"](circuit, device, kwargs, shots, num_qubits, borrowBuffer(buffer, size),
+                           inputs);
+}
+
+extern "C" NB_EXPORT void samplesInto(void *_session, const char *_circuit, const char *_device,
+                                      size_t shots, size_t num_qubits, const char *_kwargs,
+                                      const char *_inputs, double *buffer, size_t size)
+{
+    namespace nb = nanobind;
+    nb::gil_scoped_acquire lock;
+
+    std::string circuit(_circuit);
+    std::string device(_device);
+    std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
+
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    scope["py_samples_into"](circuit, device, kwargs, shots, num_qubits,
+                             borrowBuffer(buffer, size / std::max<size_t>(num_qubits, 1),
+                                          num_qubits),
+                             inputs);
+}
+
+extern "C" NB_EXPORT char *runCircuit(void *_session, const char *_circuit, const char *_device,
+                                      size_t shots, const char *_kwargs, const char *_inputs)
 {
     namespace nb = nanobind;
     nb::gil_scoped_acquire lock;
@@ -177,11 +454,11 @@ extern "C" NB_EXPORT char *runCircuit(const char *_circuit, const char *_device,
     std::string circuit(_circuit);
     std::string device(_device);
     std::string kwargs(_kwargs);
+    std::string inputs(_inputs);
 
-    // Evaluate in scope of main module
-    nb::object scope = nb::module_::import_("__main__").attr("__dict__");
-    nb::exec(nb::str(program.c_str()), scope);
-    auto retval = nb::cast<std::string>(scope["py_get_results"](circuit, device, kwargs, shots));
+    auto &scope = reinterpret_cast<OpenQasmSession *>(_session)->scope;
+    auto retval =
+        nb::cast<std::string>(scope["py_get_results"](circuit, device, kwargs, shots, inputs));
     auto retptr = static_cast<char *>(malloc(retval.size() + 1)); // string is a sequences of `char`
     std::memcpy(retptr, retval.c_str(), retval.size() + 1);
     return retptr;
@@ -48,8 +48,6 @@ class OQDDevice final : public Catalyst::Runtime::QuantumDevice {
   public:
     explicit OQDDevice(const std::string &kwargs = "{device_type : oqd, backend : default}")
     {
-        __catalyst__oqd__rt__initialize();
-
         // The OQD kwarg string format is:
         // deviceKwargs.str() + "ION:" + std::string(ion_json.dump()) + "PHONON:" +
         // std::string(phonon_json1.dump()) + ... where deviceKwargs are the usual keyword arguments
@@ -81,8 +79,11 @@ class OQDDevice final : public Catalyst::Runtime::QuantumDevice {
         openapl_file_name = device_kwargs.contains("openapl_file_name")
                                 ? device_kwargs["openapl_file_name"]
                                 : "__openapl__output.json";
+
+        // The protocol of the program is streamed into the output file as it is recorded.
+        __catalyst__oqd__rt__initialize(openapl_file_name);
     }
-    ~OQDDevice() { __catalyst__oqd__rt__finalize(openapl_file_name); };
+    ~OQDDevice() { __catalyst__oqd__rt__finalize(); };
 
     auto AllocateQubits(size_t) -> std::vector<QubitIdType> override;
     void ReleaseAllQubits() override;
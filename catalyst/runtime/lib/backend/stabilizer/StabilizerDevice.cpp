@@ -0,0 +1,349 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <numeric>
+#include <unordered_set>
+
+#include "Exception.hpp"
+#include "Utils.hpp"
+
+#include "StabilizerDevice.hpp"
+
+namespace {
+using WordT = Catalyst::Runtime::Devices::StabilizerTableau::WordT;
+using Catalyst::Runtime::Devices::StabilizerTableau;
+
+static constexpr bool GLOBAL_RESULT_TRUE_CONST = true;
+static constexpr bool GLOBAL_RESULT_FALSE_CONST = false;
+
+auto getBit(const WordT *sample, size_t wire) -> bool
+{
+    return (sample[wire / StabilizerTableau::word_bits] >> (wire % StabilizerTableau::word_bits)) &
+           1U;
+}
+} // namespace
+
+namespace Catalyst::Runtime::Devices {
+
+StabilizerDevice::StabilizerDevice(const std::string &kwargs)
+    : device_kwargs(Catalyst::Runtime::parse_kwargs(kwargs)), fallback_gen(std::random_device{}())
+{
+    if (auto it = device_kwargs.find("seed"); it != device_kwargs.end()) {
+        fallback_gen.seed(std::stoul(it->second));
+    }
+}
+
+auto StabilizerDevice::AllocateQubits(size_t num_new) -> std::vector<QubitIdType>
+{
+    if (!num_new) {
+        return {};
+    }
+
+    tableau.addQubits(num_new);
+    auto ids = qubit_manager.AllocateRange(num_qubits, num_new);
+    num_qubits += num_new;
+    return ids;
+}
+
+void StabilizerDevice::ReleaseAllQubits()
+{
+    num_qubits = 0;
+    qubit_manager.ReleaseAll();
+    tableau = StabilizerTableau{};
+    observables.clear();
+}
+
+auto StabilizerDevice::GetNumQubits() const -> size_t { return num_qubits; }
+
+void StabilizerDevice::SetDeviceShots(size_t shots) { device_shots = shots; }
+
+auto StabilizerDevice::GetDeviceShots() const -> size_t { return device_shots; }
+
+void StabilizerDevice::SetDevicePRNG(std::mt19937 *gen) { device_gen = gen; }
+
+/**
+ * Apply a rotation of `power` quarter turns about the X, Y, or Z axis, up to a global phase.
+ */
+void StabilizerDevice::applyRotation(char axis, int power, size_t wire)
+{
+    // RX = H RZ H, and RY = S RX S^dagger
+    if (axis == 'Y') {
+        tableau.Sdg(wire);
+    }
+    if (axis != 'Z') {
+        tableau.H(wire);
+    }
+    switch (power) {
+    case 1:
+        tableau.S(wire);
+        break;
+    case 2:
+        tableau.Z(wire);
+        break;
+    case 3:
+        tableau.Sdg(wire);
+        break;
+    default:
+        break;
+    }
+    if (axis != 'Z') {
+        tableau.H(wire);
+    }
+    if (axis == 'Y') {
+        tableau.S(wire);
+    }
+}
+
+void StabilizerDevice::NamedOperation(const std::string &name, const std::vector<double> &params,
+                                      const std::vector<QubitIdType> &wires, bool inverse,
+                                      const std::vector<QubitIdType> &controlled_wires,
+                                      [[maybe_unused]] const std::vector<bool> &controlled_values)
+{
+    RT_FAIL_IF(!controlled_wires.empty(),
+               "StabilizerDevice does not support controlled operations");
+
+    const auto &&dev_wires = qubit_manager.getDeviceIds(wires);
+    auto checkWires = [&](size_t expected) {
+        RT_FAIL_IF(dev_wires.size() != expected, "Invalid number of wires");
+    };
+
+    if (name == "Identity") {
+        return;
+    }
+    else if (name == "Hadamard") {
+        checkWires(1);
+        tableau.H(dev_wires[0]);
+    }
+    else if (name == "S") {
+        checkWires(1);
+        if (inverse) {
+            tableau.Sdg(dev_wires[0]);
+        }
+        else {
+            tableau.S(dev_wires[0]);
+        }
+    }
+    else if (name == "PauliX") {
+        checkWires(1);
+        tableau.X(dev_wires[0]);
+    }
+    else if (name == "PauliY") {
+        checkWires(1);
+        tableau.Y(dev_wires[0]);
+    }
+    else if (name == "PauliZ") {
+        checkWires(1);
+        tableau.Z(dev_wires[0]);
+    }
+    else if (name == "CNOT") {
+        checkWires(2);
+        tableau.CNOT(dev_wires[0], dev_wires[1]);
+    }
+    else if (name == "CY") {
+        // CY = S_t CNOT S^dagger_t
+        checkWires(2);
+        tableau.Sdg(dev_wires[1]);
+        tableau.CNOT(dev_wires[0], dev_wires[1]);
+        tableau.S(dev_wires[1]);
+    }
+    else if (name == "CZ") {
+        checkWires(2);
+        tableau.CZ(dev_wires[0], dev_wires[1]);
+    }
+    else if (name == "SWAP") {
+        checkWires(2);
+        tableau.SWAP(dev_wires[0], dev_wires[1]);
+    }
+    else if (name == "RX" || name == "RY" || name == "RZ" || name == "PhaseShift") {
+        checkWires(1);
+        RT_FAIL_IF(params.size() != 1, "Invalid number of parameters");
+        auto power = getCliffordPower(inverse ? -params[0] : params[0]);
+        RT_FAIL_IF(!power.has_value(), "StabilizerDevice only supports Clifford rotation angles");
+        applyRotation(name == "RX" ? 'X' : (name == "RY" ? 'Y' : 'Z'), power.value(),
+                      dev_wires[0]);
+    }
+    else {
+        RT_FAIL("Unsupported gate by StabilizerDevice");
+    }
+}
+
+auto StabilizerDevice::Measure(QubitIdType wire, std::optional<int32_t> postselect) -> Result
+{
+    using Catalyst::Runtime::Simulator::Lightning::simulateDraw;
+
+    // The outcome is drawn beforehand, and only used if the measurement is random
+    const bool draw = simulateDraw({0.5, 0.5}, postselect, getGenerator());
+    auto [outcome, random] = tableau.Measure(qubit_manager.getDeviceId(wire), draw);
+    RT_FAIL_IF(!random && postselect.has_value() && outcome != (postselect.value() == 1),
+               "Probability of postselect value is 0");
+
+    return const_cast<Result>(outcome ? &GLOBAL_RESULT_TRUE_CONST : &GLOBAL_RESULT_FALSE_CONST);
+}
+
+auto StabilizerDevice::Observable(ObsId id,
+                                  [[maybe_unused]] const std::vector<std::complex<double>> &matrix,
+                                  const std::vector<QubitIdType> &wires) -> ObsIdType
+{
+    RT_FAIL_IF(id == ObsId::Hadamard || id == ObsId::Hermitian,
+               "StabilizerDevice only supports Pauli observables");
+    RT_FAIL_IF(wires.size() != 1, "Invalid number of wires");
+
+    PauliTerm term{1.0, {}, {}};
+    if (id != ObsId::Identity) {
+        term.wires.push_back(qubit_manager.getDeviceId(wires[0]));
+        term.paulis.push_back(id == ObsId::PauliX ? 'X' : (id == ObsId::PauliY ? 'Y' : 'Z'));
+    }
+    observables.push_back({std::move(term)});
+    return static_cast<ObsIdType>(observables.size() - 1);
+}
+
+auto StabilizerDevice::TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType
+{
+    PauliTerm product{1.0, {}, {}};
+    std::unordered_set<size_t> wires;
+    for (auto key : obs) {
+        const auto &terms = getObservable(key);
+        RT_FAIL_IF(terms.size() != 1, "Invalid tensor product of a Hamiltonian observable");
+
+        const auto &term = terms[0];
+        product.coeff *= term.coeff;
+        for (size_t k = 0; k < term.wires.size(); k++) {
+            RT_FAIL_IF(!wires.insert(term.wires[k]).second,
+                       "Invalid tensor product of observables sharing wires");
+            product.wires.push_back(term.wires[k]);
+            product.paulis.push_back(term.paulis[k]);
+        }
+    }
+    observables.push_back({std::move(product)});
+    return static_cast<ObsIdType>(observables.size() - 1);
+}
+
+auto StabilizerDevice::HamiltonianObservable(const std::vector<double> &coeffs,
+                                             const std::vector<ObsIdType> &obs) -> ObsIdType
+{
+    RT_FAIL_IF(coeffs.size() != obs.size(), "Incompatible list of observables and coefficients");
+
+    std::vector<PauliTerm> sum;
+    for (size_t idx = 0; idx < obs.size(); idx++) {
+        for (auto term : getObservable(obs[idx])) {
+            term.coeff *= coeffs[idx];
+            sum.push_back(std::move(term));
+        }
+    }
+    observables.push_back(std::move(sum));
+    return static_cast<ObsIdType>(observables.size() - 1);
+}
+
+auto StabilizerDevice::getObservable(ObsIdType obsKey) const -> const std::vector<PauliTerm> &
+{
+    RT_FAIL_IF(obsKey < 0 || static_cast<size_t>(obsKey) >= observables.size(),
+               "Invalid key for cached observables");
+    return observables[obsKey];
+}
+
+auto StabilizerDevice::Expval(ObsIdType obsKey) -> double
+{
+    double expval{0.0};
+    for (const auto &term : getObservable(obsKey)) {
+        expval += term.coeff * tableau.ExpectationValue(term.wires, term.paulis);
+    }
+    return expval;
+}
+
+auto StabilizerDevice::Var(ObsIdType obsKey) -> double
+{
+    const auto &terms = getObservable(obsKey);
+    RT_FAIL_IF(terms.size() != 1, "Unsupported observable: Hamiltonian");
+
+    const auto &term = terms[0];
+    const int expval = tableau.ExpectationValue(term.wires, term.paulis);
+    return term.coeff * term.coeff * (1.0 - expval * expval);
+}
+
+auto StabilizerDevice::getPackedSamples() -> std::vector<WordT>
+{
+    return tableau.Sample(device_shots, *getGenerator());
+}
+
+void StabilizerDevice::Sample(DataView<double, 2> &samples)
+{
+    RT_FAIL_IF(samples.size() != device_shots * num_qubits,
+               "Invalid size for the pre-allocated samples");
+
+    const size_t num_words = tableau.getNumWords();
+    auto &&packed = getPackedSamples();
+
+    auto samplesIter = samples.begin();
+    for (size_t shot = 0; shot < device_shots; shot++) {
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            *(samplesIter++) = static_cast<double>(getBit(&packed[shot * num_words], wire));
+        }
+    }
+}
+
+void StabilizerDevice::PartialSample(DataView<double, 2> &samples,
+                                     const std::vector<QubitIdType> &wires)
+{
+    RT_FAIL_IF(samples.size() != device_shots * wires.size(),
+               "Invalid size for the pre-allocated partial-samples");
+
+    const auto &&dev_wires = qubit_manager.getDeviceIds(wires);
+    const size_t num_words = tableau.getNumWords();
+    auto &&packed = getPackedSamples();
+
+    auto samplesIter = samples.begin();
+    for (size_t shot = 0; shot < device_shots; shot++) {
+        for (auto wire : dev_wires) {
+            *(samplesIter++) = static_cast<double>(getBit(&packed[shot * num_words], wire));
+        }
+    }
+}
+
+void StabilizerDevice::Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts)
+{
+    std::vector<QubitIdType> wires = qubit_manager.getAllQubitIds();
+    PartialCounts(eigvals, counts, wires);
+}
+
+void StabilizerDevice::PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                                     const std::vector<QubitIdType> &wires)
+{
+    const size_t numWires = wires.size();
+    RT_FAIL_IF(numWires >= 64, "Unable to return the counts of 64 qubits or more");
+
+    const size_t numElements = 1UL << numWires;
+    RT_FAIL_IF((eigvals.size() != numElements || counts.size() != numElements),
+               "Invalid size for the pre-allocated counts");
+
+    const auto &&dev_wires = qubit_manager.getDeviceIds(wires);
+    const size_t num_words = tableau.getNumWords();
+    auto &&packed = getPackedSamples();
+
+    // The first wire is the most significant bit of the basis state
+    std::vector<int64_t> histogram(numElements, 0);
+    for (size_t shot = 0; shot < device_shots; shot++) {
+        size_t index = 0;
+        for (auto wire : dev_wires) {
+            index = (index << 1) | static_cast<size_t>(getBit(&packed[shot * num_words], wire));
+        }
+        histogram[index]++;
+    }
+
+    std::iota(eigvals.begin(), eigvals.end(), 0);
+    std::copy(histogram.begin(), histogram.end(), counts.begin());
+}
+
+} // namespace Catalyst::Runtime::Devices
+
+GENERATE_DEVICE_FACTORY(StabilizerDevice, Catalyst::Runtime::Devices::StabilizerDevice);
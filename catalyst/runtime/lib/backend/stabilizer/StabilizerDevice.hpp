@@ -0,0 +1,118 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DataView.hpp"
+#include "QuantumDevice.hpp"
+#include "QubitManager.hpp"
+#include "StabilizerTableau.hpp"
+#include "Types.h"
+
+namespace Catalyst::Runtime::Devices {
+
+/**
+ * A simulator of Clifford circuits on a bit-packed stabilizer tableau.
+ *
+ * Gates cost O(n) and measurements O(n^2 / 64) operations on n qubits, so circuits of thousands
+ * of qubits execute in milliseconds. Samples and counts are drawn from the affine space of the
+ * outcomes of the state, without measuring the tableau for every shot. Only Pauli words, and
+ * linear combinations of them, are supported as observables.
+ *
+ * The supported gates are the Clifford gates, and rotations by multiples of pi/2.
+ *
+ * Device kwargs:
+ * - `seed`: the seed of the device generator, used if the runtime provides none
+ */
+class StabilizerDevice final : public Catalyst::Runtime::QuantumDevice {
+  private:
+    // A Pauli word with a coefficient, on device wires
+    struct PauliTerm {
+        double coeff;
+        std::vector<size_t> wires;
+        std::string paulis;
+    };
+
+    Catalyst::Runtime::QubitManager<QubitIdType, size_t> qubit_manager{};
+    std::unordered_map<std::string, std::string> device_kwargs;
+    size_t device_shots{0};
+    size_t num_qubits{0};
+
+    std::mt19937 *device_gen{nullptr};
+    std::mt19937 fallback_gen;
+
+    StabilizerTableau tableau{};
+
+    // The observables, as sums of Pauli terms
+    std::vector<std::vector<PauliTerm>> observables{};
+
+    [[nodiscard]] auto getGenerator() -> std::mt19937 *
+    {
+        return device_gen != nullptr ? device_gen : &fallback_gen;
+    }
+
+    [[nodiscard]] auto getObservable(ObsIdType obsKey) const -> const std::vector<PauliTerm> &;
+    [[nodiscard]] auto getPackedSamples() -> std::vector<StabilizerTableau::WordT>;
+    void applyRotation(char axis, int power, size_t wire);
+
+  public:
+    explicit StabilizerDevice(const std::string &kwargs = "{}");
+    ~StabilizerDevice() override = default;
+
+    StabilizerDevice &operator=(const StabilizerDevice &) = delete;
+    StabilizerDevice(const StabilizerDevice &) = delete;
+    StabilizerDevice(StabilizerDevice &&) = delete;
+    StabilizerDevice &operator=(StabilizerDevice &&) = delete;
+
+    auto AllocateQubits(size_t num_qubits) -> std::vector<QubitIdType> override;
+    void ReleaseAllQubits() override;
+    [[nodiscard]] auto GetNumQubits() const -> size_t override;
+    void SetDeviceShots(size_t shots) override;
+    [[nodiscard]] auto GetDeviceShots() const -> size_t override;
+    void SetDevicePRNG(std::mt19937 *gen) override;
+
+    void NamedOperation(const std::string &name, const std::vector<double> &params,
+                        const std::vector<QubitIdType> &wires, bool inverse = false,
+                        const std::vector<QubitIdType> &controlled_wires = {},
+                        const std::vector<bool> &controlled_values = {}) override;
+    auto Measure(QubitIdType wire, std::optional<int32_t> postselect = std::nullopt)
+        -> Result override;
+
+    auto Observable(ObsId id, const std::vector<std::complex<double>> &matrix,
+                    const std::vector<QubitIdType> &wires) -> ObsIdType override;
+    auto TensorObservable(const std::vector<ObsIdType> &obs) -> ObsIdType override;
+    auto HamiltonianObservable(const std::vector<double> &coeffs,
+                               const std::vector<ObsIdType> &obs) -> ObsIdType override;
+    auto Expval(ObsIdType obsKey) -> double override;
+    auto Var(ObsIdType obsKey) -> double override;
+
+    void Sample(DataView<double, 2> &samples) override;
+    void PartialSample(DataView<double, 2> &samples,
+                       const std::vector<QubitIdType> &wires) override;
+    void Counts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts) override;
+    void PartialCounts(DataView<double, 1> &eigvals, DataView<int64_t, 1> &counts,
+                       const std::vector<QubitIdType> &wires) override;
+
+    [[nodiscard]] auto getTableau() const -> const StabilizerTableau & { return tableau; }
+};
+
+} // namespace Catalyst::Runtime::Devices
@@ -201,6 +201,22 @@ class RTDevice {
             rtd_name = "OpenQasmDevice";
             _complete_dylib_os_extension(rtd_lib, "openqasm");
         }
+        else if (rtd_lib == "mbqc.qubit") {
+            rtd_name = "MBQCDevice";
+            _complete_dylib_os_extension(rtd_lib, "mbqc");
+        }
+        else if (rtd_lib == "stabilizer.qubit") {
+            rtd_name = "StabilizerDevice";
+            _complete_dylib_os_extension(rtd_lib, "stabilizer");
+        }
+        else if (rtd_lib == "mps.qubit") {
+            rtd_name = "MPSDevice";
+            _complete_dylib_os_extension(rtd_lib, "mps");
+        }
+        else if (rtd_lib == "density_matrix.qubit") {
+            rtd_name = "DensityMatrixDevice";
+            _complete_dylib_os_extension(rtd_lib, "density_matrix");
+        }
         else if (rtd_lib == "oqd.qubit") {
             rtd_name = "oqd";
             _complete_dylib_os_extension(rtd_lib, "oqd_device");
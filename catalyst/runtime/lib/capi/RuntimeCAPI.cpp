@@ -1073,10 +1073,9 @@ int8_t *__catalyst__rt__array_get_element_ptr_1d(QirArray *ptr, int64_t idx)
 // MBQC Runtime CAPI
 // -------------------------------------------------------------------------- //
 
-// NOTE: Currently this runtime operations is exactly the same as __catalyst__qis__Measure();
-//       we effectively treat it as a no-op for now. When hardware devices that natively support
-//       mid-circuit measurements in an arbitrary basis are available, we will create a new
-//       QuantumDevice to implement this functionality according to the hardware specs.
+// NOTE: Devices without a native support for arbitrary-basis measurements, e.g. null.qubit,
+//       fall back to __catalyst__qis__Measure() through the default QuantumDevice::MeasureInBasis.
+//       The mbqc.qubit device simulates them natively.
 RESULT *__catalyst__mbqc__measure_in_basis(QUBIT *wire, uint32_t plane, double angle,
                                            int32_t postselect)
 {
@@ -1088,6 +1087,7 @@ RESULT *__catalyst__mbqc__measure_in_basis(QUBIT *wire, uint32_t plane, double a
         postselectOpt = std::nullopt;
     }
 
-    return getQuantumDevicePtr()->Measure(reinterpret_cast<QubitIdType>(wire), postselectOpt);
+    return getQuantumDevicePtr()->MeasureInBasis(reinterpret_cast<QubitIdType>(wire), plane, angle,
+                                                 postselectOpt);
 }
 }
@@ -0,0 +1,215 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <complex>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "CustomDevice.hpp"
+#include "DensityMatrixDevice.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Catch::Matchers;
+using namespace Catalyst::Runtime::Devices;
+
+namespace {
+/**
+ * Apply the same noisy circuit on two wires to any device.
+ */
+void applyCircuit(Catalyst::Runtime::QuantumDevice &device,
+                  const std::vector<QubitIdType> &qubits)
+{
+    device.NamedOperation("RX", {0.7}, {qubits[0]});
+    device.NamedOperation("CNOT", {}, {qubits[0], qubits[1]});
+    device.NamedOperation("RY", {1.1}, {qubits[1]});
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    device.NamedOperation("PauliX", {}, {qubits[1]});
+}
+
+/**
+ * The expectation values of Z on the first wire and X on the second one, and the probabilities
+ * of the outcomes on both wires.
+ */
+auto getResults(Catalyst::Runtime::QuantumDevice &device, const std::vector<QubitIdType> &qubits)
+    -> std::pair<std::vector<double>, std::vector<double>>
+{
+    auto z0 = device.Observable(ObsId::PauliZ, {}, {qubits[0]});
+    auto x1 = device.Observable(ObsId::PauliX, {}, {qubits[1]});
+    std::vector<double> expvals{device.Expval(z0), device.Expval(x1)};
+
+    std::vector<double> probs(4);
+    DataView<double, 1> view(probs);
+    device.Probs(view);
+    return {expvals, probs};
+}
+} // namespace
+
+TEST_CASE("Test the ThreadPool of CustomDevice", "[custom_device]")
+{
+    ThreadPool pool(3);
+    CHECK(pool.size() == 3);
+
+    // Every iteration runs once, on a valid worker, across several loops of the same pool
+    for (size_t count : {0UL, 1UL, 100UL, 7UL}) {
+        std::vector<std::atomic<size_t>> runs(count);
+        std::atomic<bool> valid_workers{true};
+        pool.parallelFor(count, [&](size_t iteration, size_t worker) {
+            runs[iteration]++;
+            if (worker >= pool.size()) {
+                valid_workers = false;
+            }
+        });
+        for (const auto &run : runs) {
+            CHECK(run == 1);
+        }
+        CHECK(valid_workers);
+    }
+
+    // Errors of the iterations are rethrown once all of them are done
+    std::atomic<size_t> done{0};
+    REQUIRE_THROWS_WITH(pool.parallelFor(10,
+                                         [&](size_t iteration, size_t) {
+                                             done++;
+                                             if (iteration == 3) {
+                                                 throw std::runtime_error("iteration failed");
+                                             }
+                                         }),
+                        ContainsSubstring("iteration failed"));
+    CHECK(done == 10);
+
+    // The pool is still usable after an error
+    std::atomic<size_t> sum{0};
+    pool.parallelFor(5, [&](size_t iteration, size_t) { sum += iteration; });
+    CHECK(sum == 10);
+}
+
+TEST_CASE("Test the trajectories of CustomDevice against DensityMatrixDevice", "[custom_device]")
+{
+    const std::string noise = "depolarizing : 0.05, amplitude_damping : 0.1";
+    CustomDevice trajectories("{trajectories : 4000, threads : 2, seed : 7, " + noise + "}");
+    DensityMatrixDevice density_matrix("{" + noise + "}");
+
+    auto trajectory_qubits = trajectories.AllocateQubits(2);
+    auto density_matrix_qubits = density_matrix.AllocateQubits(2);
+    applyCircuit(trajectories, trajectory_qubits);
+    applyCircuit(density_matrix, density_matrix_qubits);
+
+    auto [expvals, probs] = getResults(trajectories, trajectory_qubits);
+    auto [expected_expvals, expected_probs] = getResults(density_matrix, density_matrix_qubits);
+
+    // The standard error of 4000 trajectories is below 0.016
+    for (size_t idx = 0; idx < expvals.size(); idx++) {
+        CHECK(expvals[idx] == Catch::Approx(expected_expvals[idx]).margin(0.06));
+    }
+    for (size_t idx = 0; idx < probs.size(); idx++) {
+        CHECK(probs[idx] == Catch::Approx(expected_probs[idx]).margin(0.03));
+    }
+    CHECK(std::accumulate(probs.begin(), probs.end(), 0.0) == Catch::Approx(1.0));
+
+    // Amplitude damping from |1> only ever takes the decay branch with gamma = 1, where the
+    // no-decay branch has probability 0
+    CustomDevice damping("{trajectories : 50, threads : 2, seed : 3, amplitude_damping : 1.0}");
+    auto qubits = damping.AllocateQubits(1);
+    damping.NamedOperation("PauliX", {}, {qubits[0]}, false, {}, {});
+    std::vector<double> damped(2);
+    DataView<double, 1> damped_view(damped);
+    damping.Probs(damped_view);
+    CHECK(damped[0] == Catch::Approx(1.0));
+    CHECK(damped[1] == Catch::Approx(0.0).margin(1e-12));
+}
+
+TEST_CASE("Test the determinism of the trajectories of CustomDevice", "[custom_device]")
+{
+    const std::string noise = "seed : 11, depolarizing : 0.1, amplitude_damping : 0.2";
+    CustomDevice serial("{trajectories : 200, threads : 1, " + noise + "}");
+    CustomDevice parallel("{trajectories : 200, threads : 4, " + noise + "}");
+
+    auto serial_qubits = serial.AllocateQubits(2);
+    auto parallel_qubits = parallel.AllocateQubits(2);
+    applyCircuit(serial, serial_qubits);
+    applyCircuit(parallel, parallel_qubits);
+
+    // The trajectories are seeded in order, whatever the number of threads. The expectation
+    // values are summed in order, while the probabilities are summed per thread.
+    auto [serial_expvals, serial_probs] = getResults(serial, serial_qubits);
+    auto [parallel_expvals, parallel_probs] = getResults(parallel, parallel_qubits);
+    CHECK(serial_expvals == parallel_expvals);
+    for (size_t idx = 0; idx < serial_probs.size(); idx++) {
+        CHECK(serial_probs[idx] == Catch::Approx(parallel_probs[idx]).epsilon(1e-12));
+    }
+
+    serial.SetDeviceShots(1000);
+    parallel.SetDeviceShots(1000);
+    std::vector<double> eigvals(4);
+    std::vector<int64_t> serial_counts(4);
+    std::vector<int64_t> parallel_counts(4);
+    DataView<double, 1> eigvals_view(eigvals);
+    DataView<int64_t, 1> serial_view(serial_counts);
+    DataView<int64_t, 1> parallel_view(parallel_counts);
+    serial.Counts(eigvals_view, serial_view);
+    parallel.Counts(eigvals_view, parallel_view);
+    CHECK(serial_counts == parallel_counts);
+}
+
+TEST_CASE("Test the counts of the trajectories of CustomDevice", "[custom_device]")
+{
+    CustomDevice device("{trajectories : 100, threads : 3, seed : 5, depolarizing : 0.1}");
+    auto qubits = device.AllocateQubits(2);
+    applyCircuit(device, qubits);
+
+    // Fewer shots than trajectories, then shots that aren't a multiple of the trajectories
+    for (size_t shots : {37UL, 1UL, 250UL}) {
+        device.SetDeviceShots(shots);
+        std::vector<double> eigvals(4);
+        std::vector<int64_t> counts(4);
+        DataView<double, 1> eigvals_view(eigvals);
+        DataView<int64_t, 1> counts_view(counts);
+        device.Counts(eigvals_view, counts_view);
+        CHECK(std::accumulate(counts.begin(), counts.end(), int64_t{0}) ==
+              static_cast<int64_t>(shots));
+        CHECK(eigvals == std::vector<double>{0, 1, 2, 3});
+
+        std::vector<double> partial_eigvals(2);
+        std::vector<int64_t> partial_counts(2);
+        DataView<double, 1> partial_eigvals_view(partial_eigvals);
+        DataView<int64_t, 1> partial_counts_view(partial_counts);
+        device.PartialCounts(partial_eigvals_view, partial_counts_view, {qubits[1]});
+        CHECK(partial_counts[0] + partial_counts[1] == static_cast<int64_t>(shots));
+    }
+}
+
+TEST_CASE("Test the errors of the trajectories of CustomDevice", "[custom_device]")
+{
+    REQUIRE_THROWS_WITH(CustomDevice("{depolarizing : 0.1}"),
+                        ContainsSubstring("Noise channels require the trajectory mode"));
+    REQUIRE_THROWS_WITH(CustomDevice("{trajectories : 10, depolarizing : 1.5}"),
+                        ContainsSubstring("Invalid probability of the depolarizing channel"));
+
+    CustomDevice device("{trajectories : 10, threads : 2, seed : 1}");
+    auto qubits = device.AllocateQubits(1);
+    device.NamedOperation("Hadamard", {}, {qubits[0]}, false, {}, {});
+
+    std::vector<std::complex<double>> state(2);
+    DataView<std::complex<double>, 1> state_view(state);
+    REQUIRE_THROWS_WITH(device.State(state_view),
+                        ContainsSubstring("State is not available in trajectory mode"));
+    REQUIRE_THROWS_WITH(device.Measure(qubits[0], std::nullopt),
+                        ContainsSubstring("Mid-circuit measurements are not supported"));
+}
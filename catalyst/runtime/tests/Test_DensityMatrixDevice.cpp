@@ -0,0 +1,302 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <complex>
+#include <numbers>
+#include <random>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "DensityMatrixDevice.hpp"
+#include "GateMatrices.hpp"
+
+using namespace Catch::Matchers;
+using namespace Catalyst::Runtime::Devices;
+
+namespace {
+using ComplexT = std::complex<double>;
+
+/**
+ * Apply a matrix to a state vector, where the first qubit is the most significant one.
+ */
+void applyDense(std::vector<ComplexT> &state, size_t num_qubits,
+                const std::vector<ComplexT> &matrix, const std::vector<size_t> &wires)
+{
+    const size_t dim = 1UL << wires.size();
+    std::vector<ComplexT> result(state.size());
+    for (size_t index = 0; index < state.size(); index++) {
+        size_t row = 0;
+        for (auto wire : wires) {
+            row = (row << 1) | ((index >> (num_qubits - 1 - wire)) & 1U);
+        }
+        for (size_t col = 0; col < dim; col++) {
+            size_t source = index;
+            for (size_t k = 0; k < wires.size(); k++) {
+                const size_t bit = 1UL << (num_qubits - 1 - wires[k]);
+                source = ((col >> (wires.size() - 1 - k)) & 1U) ? (source | bit) : (source & ~bit);
+            }
+            result[index] += matrix[row * dim + col] * state[source];
+        }
+    }
+    state = std::move(result);
+}
+} // namespace
+
+TEST_CASE("Test DensityMatrixDevice against a state vector without noise", "[density_matrix]")
+{
+    constexpr size_t num_qubits = 4;
+    const ComplexT i{0.0, 1.0};
+    const ComplexT h{1.0 / std::numbers::sqrt2, 0.0};
+    const std::vector<ComplexT> hadamard{h, h, h, -h};
+
+    DensityMatrixDevice device;
+    auto qubits = device.AllocateQubits(num_qubits);
+
+    std::vector<ComplexT> expected(1UL << num_qubits, 0.0);
+    expected[0] = 1.0;
+
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    applyDense(expected, num_qubits, hadamard, {0});
+    device.NamedOperation("RY", {0.7}, {qubits[2]});
+    applyDense(expected, num_qubits, GateMatrices::getRotationMatrix('Y', 0.7), {2});
+    device.NamedOperation("CNOT", {}, {qubits[0], qubits[3]});
+    applyDense(expected, num_qubits, GateMatrices::getGateMatrix("CNOT", {}).first, {0, 3});
+    device.NamedOperation("Toffoli", {}, {qubits[3], qubits[2], qubits[1]});
+    applyDense(expected, num_qubits, GateMatrices::getGateMatrix("Toffoli", {}).first, {3, 2, 1});
+    device.NamedOperation("S", {}, {qubits[1]}, true);
+    applyDense(expected, num_qubits, {1.0, 0, 0, -i}, {1});
+
+    // A Hadamard on wire 2, controlled by wires 1 and 3 in the state |0, 1>
+    device.NamedOperation("Hadamard", {}, {qubits[2]}, false, {qubits[1], qubits[3]},
+                          {false, true});
+    applyDense(expected, num_qubits, GateMatrices::getControlledMatrix(hadamard, 1, {false, true}),
+               {1, 3, 2});
+
+    const std::vector<ComplexT> matrix{h, 0, 0, h * i, 0, 1.0, 0, 0, 0, 0, 1.0, 0, h * i, 0, 0, h};
+    device.MatrixOperation(matrix, {qubits[3], qubits[0]});
+    applyDense(expected, num_qubits, matrix, {3, 0});
+
+    const auto &data = device.getState().getData();
+    const size_t dim = 1UL << num_qubits;
+    for (size_t row = 0; row < dim; row++) {
+        for (size_t col = 0; col < dim; col++) {
+            const ComplexT entry = expected[row] * std::conj(expected[col]);
+            CHECK(data[row * dim + col].real() == Catch::Approx(entry.real()).margin(1e-12));
+            CHECK(data[row * dim + col].imag() == Catch::Approx(entry.imag()).margin(1e-12));
+        }
+    }
+
+    std::vector<double> probs(dim);
+    DataView<double, 1> probs_view(probs);
+    device.Probs(probs_view);
+    for (size_t idx = 0; idx < dim; idx++) {
+        CHECK(probs[idx] == Catch::Approx(std::norm(expected[idx])).margin(1e-12));
+    }
+
+    // Qubits allocated later are appended in the state |0>
+    auto extra = device.AllocateQubits(1);
+    std::vector<double> partial(4);
+    DataView<double, 1> partial_view(partial);
+    device.PartialProbs(partial_view, {extra[0], qubits[0]});
+    CHECK(partial[0] == Catch::Approx(0.5).margin(1e-12));
+    CHECK(partial[1] == Catch::Approx(0.5).margin(1e-12));
+    CHECK(partial[2] == Catch::Approx(0.0).margin(1e-12));
+    CHECK(partial[3] == Catch::Approx(0.0).margin(1e-12));
+}
+
+TEST_CASE("Test DensityMatrixDevice noise channels", "[density_matrix]")
+{
+    SECTION("Depolarizing")
+    {
+        DensityMatrixDevice device("{'depolarizing': 0.3}");
+        auto qubits = device.AllocateQubits(1);
+        auto z = device.Observable(ObsId::PauliZ, {}, {qubits[0]});
+
+        // The Bloch vector shrinks by 1 - 4p/3 after every gate
+        device.NamedOperation("PauliX", {}, {qubits[0]});
+        CHECK(device.Expval(z) == Catch::Approx(-0.6));
+        device.NamedOperation("PauliX", {}, {qubits[0]});
+        CHECK(device.Expval(z) == Catch::Approx(0.36));
+
+        const auto trace = device.getState().getTrace();
+        CHECK(trace.real() == Catch::Approx(1.0));
+        CHECK(trace.imag() == Catch::Approx(0.0).margin(1e-12));
+    }
+
+    SECTION("Amplitude damping")
+    {
+        DensityMatrixDevice device("{'amplitude_damping': 0.2}");
+        auto qubits = device.AllocateQubits(2);
+        auto x0 = device.Observable(ObsId::PauliX, {}, {qubits[0]});
+        auto z1 = device.Observable(ObsId::PauliZ, {}, {qubits[1]});
+
+        device.NamedOperation("Hadamard", {}, {qubits[0]});
+        device.NamedOperation("PauliX", {}, {qubits[1]});
+        CHECK(device.Expval(x0) == Catch::Approx(std::sqrt(0.8)));
+        CHECK(device.Expval(z1) == Catch::Approx(-0.6));
+
+        // Both wires of a controlled gate decay
+        device.NamedOperation("CZ", {}, {qubits[1], qubits[0]});
+        CHECK(device.Expval(z1) == Catch::Approx(1.0 - 2 * 0.64));
+    }
+
+    SECTION("Depolarizing followed by amplitude damping")
+    {
+        DensityMatrixDevice device("{'depolarizing': 0.3, 'amplitude_damping': 0.2}");
+        auto qubits = device.AllocateQubits(1);
+        auto z = device.Observable(ObsId::PauliZ, {}, {qubits[0]});
+
+        device.NamedOperation("PauliX", {}, {qubits[0]});
+        CHECK(device.Expval(z) == Catch::Approx(1.0 - 2 * 0.8 * 0.8));
+    }
+
+    SECTION("Readout error")
+    {
+        DensityMatrixDevice device("{'readout_error': 0.1, 'seed': 42}");
+        auto qubits = device.AllocateQubits(2);
+        device.NamedOperation("PauliX", {}, {qubits[0]});
+
+        std::vector<double> probs(4);
+        DataView<double, 1> probs_view(probs);
+        device.Probs(probs_view);
+        CHECK(probs[0] == Catch::Approx(0.09));
+        CHECK(probs[1] == Catch::Approx(0.01));
+        CHECK(probs[2] == Catch::Approx(0.81));
+        CHECK(probs[3] == Catch::Approx(0.09));
+
+        auto z0 = device.Observable(ObsId::PauliZ, {}, {qubits[0]});
+        auto z1 = device.Observable(ObsId::PauliZ, {}, {qubits[1]});
+        CHECK(device.Expval(z0) == Catch::Approx(-0.8));
+        CHECK(device.Expval(z1) == Catch::Approx(0.8));
+
+        constexpr size_t shots = 10000;
+        device.SetDeviceShots(shots);
+        std::vector<double> eigvals(2);
+        std::vector<int64_t> counts(2);
+        DataView<double, 1> eigvals_view(eigvals);
+        DataView<int64_t, 1> counts_view(counts);
+        device.PartialCounts(eigvals_view, counts_view, {qubits[0]});
+        CHECK(counts[0] + counts[1] == shots);
+        CHECK(static_cast<double>(counts[0]) / shots == Catch::Approx(0.1).margin(0.02));
+
+        // Mid-circuit measurements collapse on the actual outcome
+        size_t flipped = 0;
+        for (size_t k = 0; k < 1000; k++) {
+            flipped += !*device.Measure(qubits[0]);
+        }
+        CHECK(static_cast<double>(flipped) / 1000 == Catch::Approx(0.1).margin(0.04));
+        CHECK(device.getState().getProbabilities()[2] == Catch::Approx(1.0));
+        CHECK(*device.Measure(qubits[0], 1));
+    }
+
+    SECTION("Invalid probabilities")
+    {
+        REQUIRE_THROWS_WITH(DensityMatrixDevice("{'depolarizing': 1.5}"),
+                            ContainsSubstring("Invalid probability of a noise channel"));
+        REQUIRE_THROWS_WITH(DensityMatrixDevice("{'readout_error': -0.1}"),
+                            ContainsSubstring("Invalid probability of a noise channel"));
+    }
+}
+
+TEST_CASE("Test DensityMatrixDevice observables", "[density_matrix]")
+{
+    DensityMatrixDevice device;
+    auto qubits = device.AllocateQubits(3);
+
+    // A Bell state on wires 0 and 1, and |-> on wire 2
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    device.NamedOperation("CNOT", {}, {qubits[0], qubits[1]});
+    device.NamedOperation("PauliX", {}, {qubits[2]});
+    device.NamedOperation("Hadamard", {}, {qubits[2]});
+
+    auto x0 = device.Observable(ObsId::PauliX, {}, {qubits[0]});
+    auto z0 = device.Observable(ObsId::PauliZ, {}, {qubits[0]});
+    auto z1 = device.Observable(ObsId::PauliZ, {}, {qubits[1]});
+    auto x2 = device.Observable(ObsId::PauliX, {}, {qubits[2]});
+    auto h2 = device.Observable(ObsId::Hadamard, {}, {qubits[2]});
+    auto zz = device.TensorObservable({z0, z1});
+    CHECK(device.Expval(x0) == Catch::Approx(0.0).margin(1e-12));
+    CHECK(device.Var(x0) == Catch::Approx(1.0));
+    CHECK(device.Expval(zz) == Catch::Approx(1.0));
+    CHECK(device.Var(zz) == Catch::Approx(0.0).margin(1e-12));
+    CHECK(device.Expval(x2) == Catch::Approx(-1.0));
+    CHECK(device.Expval(h2) == Catch::Approx(-1.0 / std::numbers::sqrt2));
+
+    // The XX - YY - ZZ Hermitian, of which the Bell state is an eigenstate
+    const std::vector<ComplexT> hermitian{-1, 0, 0, 2, 0, 1, 0, 0, 0, 0, 1, 0, 2, 0, 0, -1};
+    auto herm = device.Observable(ObsId::Hermitian, hermitian, {qubits[0], qubits[1]});
+    CHECK(device.Expval(herm) == Catch::Approx(1.0));
+    CHECK(device.Var(herm) == Catch::Approx(0.0).margin(1e-12));
+
+    auto ham = device.HamiltonianObservable({0.5, 0.5, 2.0}, {z0, z1, x2});
+    CHECK(device.Expval(ham) == Catch::Approx(-2.0));
+    CHECK(device.Var(ham) == Catch::Approx(1.0));
+
+    REQUIRE_THROWS_WITH(device.TensorObservable({z0, zz}),
+                        ContainsSubstring("Invalid tensor product of observables sharing wires"));
+    REQUIRE_THROWS_WITH(device.TensorObservable({ham, z0}),
+                        ContainsSubstring("Invalid tensor product of a Hamiltonian observable"));
+    REQUIRE_THROWS_WITH(device.Expval(100),
+                        ContainsSubstring("Invalid key for cached observables"));
+}
+
+TEST_CASE("Test DensityMatrixDevice measurements", "[density_matrix]")
+{
+    DensityMatrixDevice device("{'seed': 7}");
+    auto qubits = device.AllocateQubits(3);
+
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    device.NamedOperation("CNOT", {}, {qubits[0], qubits[1]});
+    device.NamedOperation("PauliX", {}, {qubits[2]});
+
+    constexpr size_t shots = 100;
+    device.SetDeviceShots(shots);
+    std::vector<double> samples(shots * 3);
+    size_t sizes[2] = {shots, 3};
+    size_t strides[2] = {3, 1};
+    DataView<double, 2> samples_view(samples.data(), 0, sizes, strides);
+    device.Sample(samples_view);
+    for (size_t shot = 0; shot < shots; shot++) {
+        CHECK(samples[shot * 3] == samples[shot * 3 + 1]);
+        CHECK(samples[shot * 3 + 2] == 1.0);
+    }
+
+    std::vector<double> eigvals(8);
+    std::vector<int64_t> counts(8);
+    DataView<double, 1> eigvals_view(eigvals);
+    DataView<int64_t, 1> counts_view(counts);
+    device.Counts(eigvals_view, counts_view);
+    CHECK(counts[1] + counts[7] == shots);
+    CHECK(eigvals[7] == 7.0);
+
+    const bool outcome = *device.Measure(qubits[1]);
+    std::vector<double> probs(8);
+    DataView<double, 1> probs_view(probs);
+    device.Probs(probs_view);
+    CHECK(probs[outcome ? 7 : 1] == Catch::Approx(1.0));
+
+    REQUIRE_THROWS_WITH(device.Measure(qubits[0], !outcome),
+                        ContainsSubstring("Probability of postselect value is 0"));
+
+    std::vector<ComplexT> state(8);
+    DataView<ComplexT, 1> state_view(state);
+    REQUIRE_THROWS_WITH(device.State(state_view),
+                        ContainsSubstring("State is unsupported by device"));
+    REQUIRE_THROWS_WITH(device.NamedOperation("MultiRZ", {0.1}, {qubits[0], qubits[1]}),
+                        ContainsSubstring("Unsupported gate"));
+    REQUIRE_THROWS_WITH(device.MatrixOperation({1.0, 0, 0}, {qubits[0]}),
+                        ContainsSubstring("Invalid size of the matrix"));
+}
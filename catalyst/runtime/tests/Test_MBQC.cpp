@@ -12,11 +12,20 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <numbers>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
 
 #include "RuntimeCAPI.h"
 
+#include "MBQCDevice.hpp"
+#include "StabilizerTableau.hpp"
+
+using namespace Catch::Matchers;
+using namespace Catalyst::Runtime::Devices;
+
 // -------------------------------------------------------------------------- //
 // MBQC Runtime Tests
 // -------------------------------------------------------------------------- //
@@ -46,3 +55,191 @@ TEST_CASE("Test __catalyst__mbqc__measure_in_basis, device=null.qubit", "[MBQC]"
     __catalyst__rt__device_release();
     __catalyst__rt__finalize();
 }
+
+TEST_CASE("Test __catalyst__mbqc__measure_in_basis, device=mbqc.qubit", "[MBQC]")
+{
+    __catalyst__rt__initialize(nullptr);
+
+    const std::string rtd_name{"mbqc.qubit"};
+    __catalyst__rt__device_init((int8_t *)rtd_name.c_str(), nullptr, nullptr, 0, false);
+
+    QirArray *qs = __catalyst__rt__qubit_allocate_array(2);
+    QUBIT **q0 = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 0);
+    QUBIT **q1 = (QUBIT **)__catalyst__rt__array_get_element_ptr_1d(qs, 1);
+
+    // |+> and |-> are the basis states of the XY plane with a rotation angle of 0
+    __catalyst__qis__Hadamard(*q0, nullptr);
+    __catalyst__qis__PauliX(*q1, nullptr);
+    __catalyst__qis__Hadamard(*q1, nullptr);
+
+    CHECK(*__catalyst__mbqc__measure_in_basis(*q0, 0U, 0.0, -1) == false);
+    CHECK(*__catalyst__mbqc__measure_in_basis(*q1, 0U, 0.0, -1) == true);
+
+    __catalyst__rt__device_release();
+    __catalyst__rt__finalize();
+}
+
+TEST_CASE("Test StabilizerTableau measurements of a GHZ state", "[MBQC]")
+{
+    constexpr size_t num_qubits = 500;
+    StabilizerTableau tableau(num_qubits);
+
+    tableau.H(0);
+    for (size_t i = 1; i < num_qubits; i++) {
+        tableau.CNOT(i - 1, i);
+    }
+
+    auto [first, random] = tableau.Measure(0, true);
+    CHECK(first == true);
+    CHECK(random);
+    for (size_t i = 1; i < num_qubits; i++) {
+        auto [outcome, random] = tableau.Measure(i, false);
+        CHECK(outcome == first);
+        CHECK(!random);
+    }
+
+    // S^2 = Z, and H Z H = X
+    StabilizerTableau flip(1);
+    flip.H(0);
+    flip.S(0);
+    flip.S(0);
+    flip.H(0);
+    CHECK(flip.Measure(0, false) == std::pair{true, false});
+
+    // Sdg S Y = Y, and Y|0> = i|1>
+    StabilizerTableau phase(2);
+    phase.addQubits(1);
+    phase.Y(2);
+    phase.S(2);
+    phase.Sdg(2);
+    phase.SWAP(1, 2);
+    CHECK(phase.Measure(1, false) == std::pair{true, false});
+    CHECK(phase.Measure(2, true) == std::pair{false, false});
+}
+
+TEST_CASE("Test MBQCDevice on a 1D cluster state with Pauli measurements", "[MBQC]")
+{
+    constexpr size_t num_qubits = 400;
+    MBQCDevice device("{'seed': 42}");
+    auto qubits = device.AllocateQubits(num_qubits);
+
+    for (auto q : qubits) {
+        device.NamedOperation("Hadamard", {}, {q});
+    }
+    for (size_t i = 1; i < num_qubits; i++) {
+        device.NamedOperation("CZ", {}, {qubits[i - 1], qubits[i]});
+    }
+
+    // Measuring Z on the neighbours of a qubit leaves it in a X eigenstate given by the
+    // stabilizer Z_{i-1} X_i Z_{i+1} of the cluster state
+    std::vector<bool> outcomes(num_qubits);
+    for (size_t i = 0; i < num_qubits; i += 2) {
+        outcomes[i] = *device.Measure(qubits[i]);
+    }
+    for (size_t i = 1; i < num_qubits; i += 2) {
+        outcomes[i] = *device.MeasureInBasis(qubits[i], 0U, 0.0);
+        const bool right = i + 1 < num_qubits ? outcomes[i + 1] : false;
+        CHECK(outcomes[i] == (outcomes[i - 1] != right));
+    }
+
+    CHECK(device.isCliffordMode());
+    CHECK(device.getPeakDenseQubits() == 0);
+}
+
+TEST_CASE("Test MBQCDevice teleportation of a non-Clifford rotation", "[MBQC]")
+{
+    constexpr double phi = 0.3;
+    MBQCDevice device("{'seed': 7}");
+
+    for (size_t trial = 0; trial < 16; trial++) {
+        auto qubits = device.AllocateQubits(2);
+        device.NamedOperation("Hadamard", {}, {qubits[0]});
+        device.NamedOperation("Hadamard", {}, {qubits[1]});
+        device.NamedOperation("CZ", {}, {qubits[0], qubits[1]});
+
+        // The second qubit is in the state X^s H RZ(-phi)|+>, up to a global phase
+        const bool s = *device.MeasureInBasis(qubits[0], 0U, phi);
+        CHECK(!device.isCliffordMode());
+        if (s) {
+            device.NamedOperation("PauliX", {}, {qubits[1]});
+        }
+        device.NamedOperation("Hadamard", {}, {qubits[1]});
+
+        CHECK(*device.MeasureInBasis(qubits[1], 0U, -phi) == false);
+        CHECK(*device.MeasureInBasis(qubits[1], 0U, -phi) == false);
+        device.ReleaseAllQubits();
+    }
+
+    // The same rotation in the YZ and ZX planes
+    auto qubits = device.AllocateQubits(2);
+    device.NamedOperation("RX", {-phi}, {qubits[0]});
+    device.NamedOperation("RY", {phi}, {qubits[1]});
+    CHECK(*device.MeasureInBasis(qubits[0], 1U, phi) == false);
+    CHECK(*device.MeasureInBasis(qubits[1], 2U, phi) == false);
+    CHECK(*device.MeasureInBasis(qubits[1], 2U, phi + std::numbers::pi) == true);
+}
+
+TEST_CASE("Test MBQCDevice Clifford-angle measurements", "[MBQC]")
+{
+    MBQCDevice device("{'seed': 3}");
+    auto qubits = device.AllocateQubits(3);
+
+    // |+_{pi/2}> = S|+> in the XY plane, and |+_{pi/2}> = RX(-pi/2)|0> in the YZ plane
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    device.NamedOperation("S", {}, {qubits[0]});
+    device.NamedOperation("RX", {-std::numbers::pi / 2}, {qubits[1]});
+    device.NamedOperation("RY", {std::numbers::pi}, {qubits[2]});
+
+    CHECK(*device.MeasureInBasis(qubits[0], 0U, std::numbers::pi / 2) == false);
+    CHECK(*device.MeasureInBasis(qubits[0], 0U, -std::numbers::pi / 2) == true);
+    CHECK(*device.MeasureInBasis(qubits[1], 1U, std::numbers::pi / 2) == false);
+    CHECK(*device.MeasureInBasis(qubits[2], 2U, std::numbers::pi) == false);
+    CHECK(*device.Measure(qubits[2]) == true);
+    CHECK(device.isCliffordMode());
+
+    REQUIRE_THROWS_WITH(device.Measure(qubits[2], 0), ContainsSubstring("postselect value is 0"));
+    REQUIRE_THROWS_WITH(device.MeasureInBasis(qubits[2], 3U, 0.0),
+                        ContainsSubstring("Invalid plane"));
+    REQUIRE_THROWS_WITH(device.NamedOperation("Toffoli", {}, {qubits[0], qubits[1], qubits[2]}),
+                        ContainsSubstring("Unsupported gate"));
+}
+
+TEST_CASE("Test MBQCDevice lazy simulation of a large non-Clifford pattern", "[MBQC]")
+{
+    constexpr size_t num_qubits = 200;
+    MBQCDevice device("{'seed': 11, 'max_dense_qubits': 4}");
+    auto qubits = device.AllocateQubits(num_qubits);
+
+    for (auto q : qubits) {
+        device.NamedOperation("Hadamard", {}, {q});
+    }
+    for (size_t i = 1; i < num_qubits; i++) {
+        device.NamedOperation("CZ", {}, {qubits[i - 1], qubits[i]});
+    }
+
+    // The sign of each angle depends on the previous outcome, as in the adaptive corrections of
+    // a sequence of J(angle) rotations
+    bool previous = false;
+    for (size_t i = 0; i + 1 < num_qubits; i++) {
+        const double angle = 0.1 * static_cast<double>(i + 1);
+        previous = *device.MeasureInBasis(qubits[i], 0U, previous ? -angle : angle);
+    }
+    CHECK(!device.isCliffordMode());
+    CHECK(device.getPeakDenseQubits() <= 2);
+
+    // A star graph of non-Clifford states doesn't fit in the dense register
+    REQUIRE_THROWS_WITH(
+        [&] {
+            auto others = device.AllocateQubits(6);
+            for (auto q : others) {
+                device.NamedOperation("Hadamard", {}, {q});
+                device.NamedOperation("T", {}, {q});
+                device.NamedOperation("Hadamard", {}, {q});
+            }
+            for (size_t i = 1; i < others.size(); i++) {
+                device.NamedOperation("CNOT", {}, {others[0], others[i]});
+            }
+            (void)device.Measure(others[0]);
+        }(),
+        ContainsSubstring("maximum number of dense qubits"));
+}
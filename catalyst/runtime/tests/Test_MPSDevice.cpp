@@ -0,0 +1,456 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <complex>
+#include <numbers>
+#include <random>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "MPSDevice.hpp"
+
+using namespace Catch::Matchers;
+using namespace Catalyst::Runtime::Devices;
+
+namespace {
+using ComplexT = std::complex<double>;
+
+/**
+ * A random unitary matrix of dimension `dim`, by Gram-Schmidt orthonormalization of the rows of
+ * a random complex matrix.
+ */
+auto getRandomUnitary(size_t dim, std::mt19937 &gen) -> std::vector<ComplexT>
+{
+    std::normal_distribution<double> dis(0.0, 1.0);
+    std::vector<ComplexT> matrix(dim * dim);
+    for (auto &entry : matrix) {
+        entry = ComplexT{dis(gen), dis(gen)};
+    }
+    for (size_t row = 0; row < dim; row++) {
+        for (size_t prev = 0; prev < row; prev++) {
+            ComplexT overlap = 0;
+            for (size_t col = 0; col < dim; col++) {
+                overlap += std::conj(matrix[prev * dim + col]) * matrix[row * dim + col];
+            }
+            for (size_t col = 0; col < dim; col++) {
+                matrix[row * dim + col] -= overlap * matrix[prev * dim + col];
+            }
+        }
+        double norm = 0;
+        for (size_t col = 0; col < dim; col++) {
+            norm += std::norm(matrix[row * dim + col]);
+        }
+        for (size_t col = 0; col < dim; col++) {
+            matrix[row * dim + col] /= std::sqrt(norm);
+        }
+    }
+    return matrix;
+}
+
+/**
+ * Apply a one- or two-qubit matrix to a state vector, where the first qubit is the most
+ * significant one.
+ */
+void applyDense(std::vector<ComplexT> &state, size_t num_qubits,
+                const std::vector<ComplexT> &matrix, const std::vector<size_t> &wires)
+{
+    const size_t dim = 1UL << wires.size();
+    std::vector<ComplexT> result(state.size());
+    for (size_t index = 0; index < state.size(); index++) {
+        size_t row = 0;
+        for (auto wire : wires) {
+            row = (row << 1) | ((index >> (num_qubits - 1 - wire)) & 1U);
+        }
+        for (size_t col = 0; col < dim; col++) {
+            size_t source = index;
+            for (size_t k = 0; k < wires.size(); k++) {
+                const size_t bit = (col >> (wires.size() - 1 - k)) & 1U;
+                const size_t shift = num_qubits - 1 - wires[k];
+                source = (source & ~(1UL << shift)) | (bit << shift);
+            }
+            result[index] += matrix[row * dim + col] * state[source];
+        }
+    }
+    state = std::move(result);
+}
+} // namespace
+
+TEST_CASE("Test the Jacobi SVD of the MPS device", "[mps]")
+{
+    std::mt19937 gen(11);
+    std::normal_distribution<double> dis(0.0, 1.0);
+
+    for (auto [m, n] : std::vector<std::pair<size_t, size_t>>{{6, 4}, {3, 8}, {5, 5}}) {
+        std::vector<ComplexT> matrix(m * n);
+        for (auto &entry : matrix) {
+            entry = ComplexT{dis(gen), dis(gen)};
+        }
+
+        auto [U, S, Vh] = MPS::jacobiSVD(matrix, m, n);
+        const size_t k = std::min(m, n);
+        REQUIRE(S.size() == k);
+        for (size_t j = 1; j < k; j++) {
+            CHECK(S[j - 1] >= S[j]);
+        }
+
+        double error = 0;
+        for (size_t row = 0; row < m; row++) {
+            for (size_t col = 0; col < n; col++) {
+                ComplexT entry = 0;
+                for (size_t j = 0; j < k; j++) {
+                    entry += U[row * k + j] * S[j] * Vh[j * n + col];
+                }
+                error = std::max(error, std::abs(entry - matrix[row * n + col]));
+            }
+        }
+        CHECK(error < 1e-12);
+    }
+}
+
+TEST_CASE("Test loading the LAPACK library of the MPS device", "[mps]")
+{
+    CHECK_FALSE(MPS::loadLapackSVD("/nonexistent/liblapack.so"));
+    REQUIRE_THROWS_WITH(MPSDevice("{'lapack_library': '/nonexistent/liblapack.so'}"),
+                        ContainsSubstring("Unable to load zgesdd"));
+}
+
+#ifdef MPS_TEST_LAPACK_LIBRARY
+TEST_CASE("Test the LAPACK SVD of the MPS device against the Jacobi SVD", "[mps]")
+{
+    const auto lapack = MPS::loadLapackSVD(MPS_TEST_LAPACK_LIBRARY);
+    REQUIRE(lapack);
+
+    std::mt19937 gen(13);
+    std::normal_distribution<double> dis(0.0, 1.0);
+
+    for (auto [m, n] : std::vector<std::pair<size_t, size_t>>{{6, 4}, {3, 8}, {5, 5}}) {
+        std::vector<ComplexT> matrix(m * n);
+        for (auto &entry : matrix) {
+            entry = ComplexT{dis(gen), dis(gen)};
+        }
+
+        auto result = MPS::lapackSVD(lapack, matrix, m, n);
+        REQUIRE(result.has_value());
+        auto [U, S, Vh] = std::move(*result);
+        auto [jacobiU, jacobiS, jacobiVh] = MPS::jacobiSVD(matrix, m, n);
+
+        const size_t k = std::min(m, n);
+        REQUIRE(S.size() == k);
+        for (size_t j = 0; j < k; j++) {
+            CHECK(S[j] == Catch::Approx(jacobiS[j]).epsilon(1e-10));
+
+            // The singular values are distinct, so the singular vectors agree up to opposite
+            // phases on both sides
+            ComplexT left = 0;
+            for (size_t row = 0; row < m; row++) {
+                left += std::conj(U[row * k + j]) * jacobiU[row * k + j];
+            }
+            ComplexT right = 0;
+            for (size_t col = 0; col < n; col++) {
+                right += std::conj(Vh[j * n + col]) * jacobiVh[j * n + col];
+            }
+            CHECK(std::abs(left) == Catch::Approx(1.0).margin(1e-10));
+            CHECK(std::abs(left - std::conj(right)) < 1e-10);
+        }
+
+        double error = 0;
+        for (size_t row = 0; row < m; row++) {
+            for (size_t col = 0; col < n; col++) {
+                ComplexT entry = 0;
+                for (size_t j = 0; j < k; j++) {
+                    entry += U[row * k + j] * S[j] * Vh[j * n + col];
+                }
+                error = std::max(error, std::abs(entry - matrix[row * n + col]));
+            }
+        }
+        CHECK(error < 1e-12);
+    }
+
+    // The device takes the LAPACK path, and agrees with the Jacobi method on a circuit
+    constexpr size_t num_qubits = 5;
+    MPSDevice lapack_device(std::string("{'lapack_library': '") + MPS_TEST_LAPACK_LIBRARY + "'}");
+    REQUIRE(lapack_device.UsesLapack());
+    MPSState jacobi_state(128, 1e-12, MPS::LapackSVD{});
+    REQUIRE_FALSE(jacobi_state.usesLapack());
+
+    auto qubits = lapack_device.AllocateQubits(num_qubits);
+    jacobi_state.addQubits(num_qubits);
+    for (size_t layer = 0; layer < 10; layer++) {
+        const size_t wire0 = layer % num_qubits;
+        const size_t wire1 = (layer + 2) % num_qubits;
+        auto unitary = getRandomUnitary(4, gen);
+        lapack_device.MatrixOperation(unitary, {qubits[wire0], qubits[wire1]});
+        jacobi_state.apply(unitary, 2, wire0, wire1);
+    }
+
+    auto x0 = lapack_device.Observable(ObsId::PauliX, {}, {qubits[0]});
+    auto y2 = lapack_device.Observable(ObsId::PauliY, {}, {qubits[2]});
+    auto z4 = lapack_device.Observable(ObsId::PauliZ, {}, {qubits[4]});
+    auto word = lapack_device.TensorObservable({x0, y2, z4});
+    CHECK(lapack_device.Expval(word) ==
+          Catch::Approx(jacobi_state.ExpectationValue({0, 2, 4}, "XYZ")).margin(1e-10));
+
+    auto z1 = lapack_device.Observable(ObsId::PauliZ, {}, {qubits[1]});
+    auto z3 = lapack_device.Observable(ObsId::PauliZ, {}, {qubits[3]});
+    auto zz = lapack_device.TensorObservable({z1, z3});
+    CHECK(lapack_device.Expval(zz) ==
+          Catch::Approx(jacobi_state.ExpectationValue({1, 3}, "ZZ")).margin(1e-10));
+}
+#endif
+
+TEST_CASE("Test MPSDevice against a state vector on random circuits", "[mps]")
+{
+    constexpr size_t num_qubits = 6;
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<size_t> wire_dis(0, num_qubits - 1);
+    std::uniform_real_distribution<double> angle_dis(-std::numbers::pi, std::numbers::pi);
+
+    MPSDevice device;
+    auto qubits = device.AllocateQubits(num_qubits);
+
+    std::vector<ComplexT> expected(1UL << num_qubits);
+    expected[0] = 1.0;
+
+    for (size_t layer = 0; layer < 40; layer++) {
+        // A random two-qubit unitary on distant wires, then named gates
+        const size_t wire0 = wire_dis(gen);
+        size_t wire1 = wire_dis(gen);
+        while (wire1 == wire0) {
+            wire1 = wire_dis(gen);
+        }
+        auto unitary = getRandomUnitary(4, gen);
+        device.MatrixOperation(unitary, {qubits[wire0], qubits[wire1]});
+        applyDense(expected, num_qubits, unitary, {wire0, wire1});
+
+        const double angle = angle_dis(gen);
+        device.NamedOperation("RY", {angle}, {qubits[wire1]});
+        const double c = std::cos(angle / 2);
+        const double s = std::sin(angle / 2);
+        applyDense(expected, num_qubits, {c, -s, s, c}, {wire1});
+
+        device.NamedOperation("CNOT", {}, {qubits[wire1], qubits[(wire1 + 3) % num_qubits]});
+        applyDense(expected, num_qubits, {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0},
+                   {wire1, (wire1 + 3) % num_qubits});
+    }
+
+    std::vector<ComplexT> state(1UL << num_qubits);
+    DataView<ComplexT, 1> state_view(state);
+    device.State(state_view);
+
+    ComplexT overlap = 0;
+    for (size_t index = 0; index < state.size(); index++) {
+        overlap += std::conj(expected[index]) * state[index];
+    }
+    CHECK(std::abs(overlap) == Catch::Approx(1.0).margin(1e-10));
+    CHECK(device.getState().getTruncationError() < 1e-10);
+
+    // The expectation values of Pauli words on any wires
+    auto x1 = device.Observable(ObsId::PauliX, {}, {qubits[1]});
+    auto y4 = device.Observable(ObsId::PauliY, {}, {qubits[4]});
+    auto z2 = device.Observable(ObsId::PauliZ, {}, {qubits[2]});
+    auto word = device.TensorObservable({x1, y4, z2});
+
+    auto pauli_state = expected;
+    applyDense(pauli_state, num_qubits, {0, 1, 1, 0}, {1});
+    applyDense(pauli_state, num_qubits, {0, ComplexT{0, -1}, ComplexT{0, 1}, 0}, {4});
+    applyDense(pauli_state, num_qubits, {1, 0, 0, -1}, {2});
+    ComplexT expval = 0;
+    for (size_t index = 0; index < state.size(); index++) {
+        expval += std::conj(expected[index]) * pauli_state[index];
+    }
+    CHECK(device.Expval(word) == Catch::Approx(expval.real()).margin(1e-10));
+}
+
+TEST_CASE("Test MPSDevice named gates", "[mps]")
+{
+    MPSDevice device;
+    auto qubits = device.AllocateQubits(2);
+    std::vector<ComplexT> state(4);
+    DataView<ComplexT, 1> state_view(state);
+
+    auto checkState = [&](const std::vector<ComplexT> &expected) {
+        device.State(state_view);
+        for (size_t index = 0; index < 4; index++) {
+            CHECK(std::abs(state[index] - expected[index]) < 1e-12);
+        }
+    };
+
+    const double h = 1 / std::numbers::sqrt2;
+
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    device.NamedOperation("CNOT", {}, {qubits[0], qubits[1]});
+    checkState({h, 0, 0, h});
+
+    // CNOT with the control and target exchanged
+    device.NamedOperation("CNOT", {}, {qubits[1], qubits[0]});
+    checkState({h, h, 0, 0});
+
+    device.NamedOperation("S", {}, {qubits[1]});
+    checkState({h, ComplexT{0, h}, 0, 0});
+    device.NamedOperation("S", {}, {qubits[1]}, true);
+    checkState({h, h, 0, 0});
+
+    // A PauliX controlled by |0> on the second wire
+    device.NamedOperation("PauliX", {}, {qubits[0]}, false, {qubits[1]}, {false});
+    checkState({0, h, h, 0});
+
+    device.NamedOperation("SWAP", {}, {qubits[0], qubits[1]});
+    device.NamedOperation("IsingZZ", {std::numbers::pi}, {qubits[0], qubits[1]});
+    checkState({0, ComplexT{0, h}, ComplexT{0, h}, 0});
+
+    REQUIRE_THROWS_WITH(device.NamedOperation("MultiRZ", {0.1}, {qubits[0], qubits[1]}),
+                        ContainsSubstring("Unsupported gate"));
+    REQUIRE_THROWS_WITH(device.NamedOperation("RX", {}, {qubits[0]}),
+                        ContainsSubstring("Invalid number of parameters"));
+    REQUIRE_THROWS_WITH(device.NamedOperation("CNOT", {}, {qubits[0]}),
+                        ContainsSubstring("Invalid number of wires"));
+    REQUIRE_THROWS_WITH(
+        device.NamedOperation("CNOT", {}, {qubits[0], qubits[1]}, false, {qubits[0]}, {true}),
+        ContainsSubstring("one or two wires"));
+    REQUIRE_THROWS_WITH(device.MatrixOperation({1, 0, 0}, {qubits[0]}),
+                        ContainsSubstring("Invalid size of the matrix"));
+}
+
+TEST_CASE("Test MPSDevice on a large GHZ state", "[mps]")
+{
+    constexpr size_t num_qubits = 120;
+    constexpr size_t shots = 100;
+
+    MPSDevice device("{'seed': 42}");
+    auto qubits = device.AllocateQubits(num_qubits);
+
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    for (size_t i = 1; i < num_qubits; i++) {
+        device.NamedOperation("CNOT", {}, {qubits[i - 1], qubits[i]});
+    }
+    CHECK(device.getState().getMaxBondDim() == 2);
+
+    auto z0 = device.Observable(ObsId::PauliZ, {}, {qubits[0]});
+    auto z_last = device.Observable(ObsId::PauliZ, {}, {qubits[num_qubits - 1]});
+    auto zz = device.TensorObservable({z0, z_last});
+    CHECK(device.Expval(zz) == Catch::Approx(1.0));
+    CHECK(device.Expval(z0) == Catch::Approx(0.0).margin(1e-12));
+    CHECK(device.Var(z0) == Catch::Approx(1.0));
+
+    std::vector<ObsIdType> xs;
+    for (auto qubit : qubits) {
+        xs.push_back(device.Observable(ObsId::PauliX, {}, {qubit}));
+    }
+    CHECK(device.Expval(device.TensorObservable(xs)) == Catch::Approx(1.0));
+
+    auto ham = device.HamiltonianObservable({0.5, -2.0}, {zz, z0});
+    CHECK(device.Expval(ham) == Catch::Approx(0.5));
+    REQUIRE_THROWS_WITH(device.Var(ham), ContainsSubstring("Unsupported observable"));
+
+    device.SetDeviceShots(shots);
+    std::vector<double> samples(shots * num_qubits);
+    size_t sizes[2] = {shots, num_qubits};
+    size_t strides[2] = {num_qubits, 1};
+    DataView<double, 2> samples_view(samples.data(), 0, sizes, strides);
+    device.Sample(samples_view);
+
+    size_t num_ones = 0;
+    for (size_t shot = 0; shot < shots; shot++) {
+        const double first = samples[shot * num_qubits];
+        num_ones += first == 1.0;
+        bool all_equal = true;
+        for (size_t i = 1; i < num_qubits; i++) {
+            all_equal = all_equal && samples[shot * num_qubits + i] == first;
+        }
+        CHECK(all_equal);
+    }
+    CHECK(num_ones > 0);
+    CHECK(num_ones < shots);
+
+    // A long-range gate brings the qubits together, without changing the state of the others
+    device.NamedOperation("CNOT", {}, {qubits[0], qubits[num_qubits - 1]});
+    auto z1 = device.Observable(ObsId::PauliZ, {}, {qubits[1]});
+    CHECK(device.Expval(device.TensorObservable({z0, z1})) == Catch::Approx(1.0));
+    CHECK(device.Expval(z_last) == Catch::Approx(1.0));
+
+    const bool outcome = *device.Measure(qubits[0]);
+    CHECK(*device.Measure(qubits[num_qubits / 2]) == outcome);
+    CHECK(*device.Measure(qubits[num_qubits - 1]) == false);
+}
+
+TEST_CASE("Test MPSDevice truncation and counts", "[mps]")
+{
+    constexpr size_t shots = 1000;
+
+    MPSDevice device("{'max_bond_dim': 1, 'seed': 3}");
+    auto qubits = device.AllocateQubits(3);
+    device.SetDeviceShots(shots);
+
+    // A product state is exact with a bond dimension 1
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    device.NamedOperation("PauliX", {}, {qubits[2]});
+    device.NamedOperation("SWAP", {}, {qubits[0], qubits[2]});
+    CHECK(device.getState().getTruncationError() < 1e-12);
+
+    std::vector<double> eigvals(8);
+    std::vector<int64_t> counts(8);
+    DataView<double, 1> eigvals_view(eigvals);
+    DataView<int64_t, 1> counts_view(counts);
+    device.Counts(eigvals_view, counts_view);
+
+    // q0 q1 q2 = 1 0 b
+    CHECK(counts[4] + counts[5] == shots);
+    CHECK(counts[4] > 400);
+    CHECK(counts[5] > 400);
+    for (size_t state = 0; state < 8; state++) {
+        CHECK(eigvals[state] == static_cast<double>(state));
+    }
+
+    std::vector<double> partial_eigvals(4);
+    std::vector<int64_t> partial_counts(4);
+    DataView<double, 1> partial_eigvals_view(partial_eigvals);
+    DataView<int64_t, 1> partial_counts_view(partial_counts);
+    device.PartialCounts(partial_eigvals_view, partial_counts_view, {qubits[1], qubits[0]});
+    CHECK(partial_counts[1] == shots);
+
+    // A Bell state is truncated to one of its branches
+    device.NamedOperation("CNOT", {}, {qubits[2], qubits[1]});
+    CHECK(device.getState().getMaxBondDim() == 1);
+    CHECK(device.getState().getTruncationError() == Catch::Approx(0.5));
+
+    REQUIRE_THROWS_WITH(MPSDevice("{'max_bond_dim': 0}"),
+                        ContainsSubstring("Invalid maximum bond dimension"));
+    REQUIRE_THROWS_WITH(MPSDevice("{'cutoff': 2}"), ContainsSubstring("Invalid truncation cutoff"));
+}
+
+TEST_CASE("Test MPSDevice measurements", "[mps]")
+{
+    MPSDevice device("{'seed': 9}");
+    auto qubits = device.AllocateQubits(3);
+
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    device.NamedOperation("CNOT", {}, {qubits[0], qubits[2]});
+    device.NamedOperation("RX", {std::numbers::pi}, {qubits[1]});
+
+    CHECK(*device.Measure(qubits[2], 1) == true);
+    CHECK(*device.Measure(qubits[0]) == true);
+    CHECK(*device.Measure(qubits[1]) == true);
+    REQUIRE_THROWS_WITH(device.Measure(qubits[1], 0), ContainsSubstring("postselect value is 0"));
+
+    REQUIRE_THROWS_WITH(device.Observable(ObsId::Hermitian, {}, {qubits[0]}),
+                        ContainsSubstring("only supports Pauli observables"));
+    auto z0 = device.Observable(ObsId::PauliZ, {}, {qubits[0]});
+    REQUIRE_THROWS_WITH(device.TensorObservable({z0, z0}), ContainsSubstring("sharing wires"));
+    REQUIRE_THROWS_WITH(device.Expval(100), ContainsSubstring("Invalid key"));
+
+    device.ReleaseAllQubits();
+    CHECK(device.GetNumQubits() == 0);
+}
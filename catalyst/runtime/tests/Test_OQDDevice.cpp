@@ -14,7 +14,9 @@
 
 #include <filesystem>
 #include <fstream>
+#include <random>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 #include <nlohmann/json.hpp>
@@ -23,6 +25,7 @@
 #include "TestUtils.hpp"
 
 #include "OQDDevice.hpp"
+#include "OQDRecordPool.hpp"
 #include "OQDRuntimeCAPI.h"
 
 using namespace Catch::Matchers;
@@ -30,9 +33,36 @@ using namespace Catalyst::Runtime::Device;
 
 using json = nlohmann::json;
 
+namespace {
+/**
+ * A unique OpenAPL output file in the temporary directory, removed at the end of the test.
+ */
+struct TempOutputFile {
+    const std::string name =
+        (std::filesystem::temp_directory_path() /
+         ("catalyst_openapl_" + std::to_string(std::random_device{}()) + ".json"))
+            .string();
+
+    TempOutputFile() = default;
+    ~TempOutputFile() { std::filesystem::remove(name); }
+
+    TempOutputFile(const TempOutputFile &) = delete;
+    TempOutputFile &operator=(const TempOutputFile &) = delete;
+
+    /**
+     * The device kwargs writing the program into this file.
+     */
+    auto getKwargs(size_t shots) const -> std::string
+    {
+        return "{shots : " + std::to_string(shots) + ", openapl_file_name : " + name + "}";
+    }
+};
+} // namespace
+
 TEST_CASE("Test the OQDDevice constructor", "[oqd]")
 {
-    auto device = OQDDevice("{shots : 100}");
+    TempOutputFile output;
+    auto device = OQDDevice(output.getKwargs(100));
 
     REQUIRE_THROWS_WITH(device.GetNumQubits(), ContainsSubstring("unsupported by device"));
     REQUIRE_THROWS_WITH(device.Measure(0), ContainsSubstring("unsupported by device"));
@@ -40,9 +70,11 @@ TEST_CASE("Test the OQDDevice constructor", "[oqd]")
 
 TEST_CASE("Test the OQDDevice qubit allocation and release", "[oqd]")
 {
-    auto device = OQDDevice(R"({shots : 100}ION:{"name":"Yb171"}PHONON:{"class_":"Phonon"})");
+    TempOutputFile output;
+    auto device =
+        OQDDevice(output.getKwargs(100) + R"(ION:{"name":"Yb171"}PHONON:{"class_":"Phonon"})");
 
-    CHECK(device.getOutputFile() == "__openapl__output.json");
+    CHECK(device.getOutputFile() == output.name);
     CHECK(device.getIonSpecs() == "{\"name\":\"Yb171\"}");
     CHECK(device.getPhononSpecs()[0] == "{\"class_\":\"Phonon\"}");
 
@@ -54,13 +86,12 @@ TEST_CASE("Test the OQDDevice qubit allocation and release", "[oqd]")
     device.ReleaseAllQubits();
     CHECK(device.getIonSpecs() == "");
     CHECK(device.getPhononSpecs().empty());
-
-    std::filesystem::remove("__openapl__output.json");
 }
 
 TEST_CASE("Test the OQDDevice ion index out of range", "[oqd]")
 {
-    auto device = OQDDevice(R"({shots : 100}ION:{"name":"Yb171"})");
+    TempOutputFile output;
+    auto device = OQDDevice(output.getKwargs(100) + R"(ION:{"name":"Yb171"})");
     std::vector<QubitIdType> allocaedQubits = device.AllocateQubits(3);
 
     Beam beam = {0, 1.1, 2.2, {1, 0, 0}, {0, 1, 0}};
@@ -73,7 +104,8 @@ TEST_CASE("Test the OQDDevice ion index out of range", "[oqd]")
 
 TEST_CASE("Test the OQDDevice transition index out of range", "[oqd]")
 {
-    auto device = OQDDevice(R"({shots : 100}ION:{"transitions":[]})");
+    TempOutputFile output;
+    auto device = OQDDevice(output.getKwargs(100) + R"(ION:{"transitions":[]})");
     std::vector<QubitIdType> allocaedQubits = device.AllocateQubits(1);
 
     Beam beam = {/*transition_index=*/100, 1.1, 2.2, {1, 0, 0}, {0, 1, 0}};
@@ -721,9 +753,11 @@ TEST_CASE("Test OpenAPL Program generation", "[oqd]")
 }
 )");
 
+    TempOutputFile output;
     const auto [rtd_lib, rtd_name, rtd_kwargs] =
         std::array<std::string, 3>{"oqd.qubit", "oqd",
-                                   R"({'shots': 0, 'mcmc': False}ION:
+                                   "{'shots': 0, 'mcmc': False, 'openapl_file_name': '" +
+                                       output.name + R"('}ION:
       {
         "class_": "Ion",
         "mass": 171.0,
@@ -952,8 +986,173 @@ TEST_CASE("Test OpenAPL Program generation", "[oqd]")
     __catalyst__rt__device_release();
     __catalyst__rt__finalize();
 
-    json observed = json::parse(std::ifstream("__openapl__output.json"));
+    json observed = json::parse(std::ifstream(output.name));
     CHECK(expected == observed);
+}
+
+TEST_CASE("Test streaming a long OpenAPL program", "[oqd]")
+{
+    constexpr size_t num_protocols = 10000;
+    TempOutputFile output;
+
+    Beam beam = {1, 31.41592653589793, 2.0, {1, 0, 0}, {0, 1, 0}};
+    {
+        auto device = OQDDevice(
+            output.getKwargs(0) +
+            R"(ION:{"transitions":[{"label":"t0"},{"label":"t1","einsteinA":1.0}]})"
+            R"(PHONON:{"class_":"Phonon"})");
+        std::vector<QubitIdType> qubits = device.AllocateQubits(2);
+
+        for (size_t i = 0; i < num_protocols; i++) {
+            Pulse p0 = {&beam, 0, 0.5 * static_cast<double>(i), 3.14};
+            Pulse p1 = {&beam, 1, 1.0, -0.1};
+            Pulse *pulses[] = {&p0, &p1};
+            __catalyst__oqd__ParallelProtocol(pulses, 2);
+        }
+
+        // Invalid pulses don't leave a partial entry in the output
+        Pulse invalid = {&beam, 5, 1.0, 0.0};
+        Pulse *pulses[] = {&invalid};
+        REQUIRE_THROWS_WITH(__catalyst__oqd__ParallelProtocol(pulses, 1),
+                            ContainsSubstring("ion index out of range"));
+    }
+
+    json observed = json::parse(std::ifstream(output.name));
+
+    CHECK(observed["class_"] == "AtomicCircuit");
+    CHECK(observed["system"]["ions"].size() == 2);
+    CHECK(observed["system"]["modes"] == json::parse(R"([{"class_":"Phonon"}])"));
+
+    const auto &sequence = observed["protocol"]["sequence"];
+    REQUIRE(sequence.size() == num_protocols);
+
+    const auto &pulse = sequence[num_protocols - 1]["sequence"][0];
+    CHECK(pulse["class_"] == "Pulse");
+    CHECK(pulse["duration"] == 0.5 * static_cast<double>(num_protocols - 1));
+    CHECK(pulse["beam"]["target"] == 0);
+    CHECK(pulse["beam"]["phase"]["value"] == 3.14);
+    CHECK(pulse["beam"]["detuning"] == json::parse(R"({"class_":"MathNum","value":2.0})"));
+    CHECK(pulse["beam"]["polarization"] == json::parse("[1,0,0]"));
+    CHECK(pulse["beam"]["transition"] == json::parse(R"({"label":"t1","einsteinA":1.0})"));
+    CHECK(sequence[0]["sequence"][1]["beam"]["phase"]["value"] == -0.1);
+}
+
+TEST_CASE("Test the OQD RecordPool", "[oqd]")
+{
+    Catalyst::Runtime::OQD::RecordPool<Beam, 4> pool;
+    CHECK(pool.getNumRecords() == 0);
+    CHECK(pool.getCapacity() == 0);
+
+    std::vector<Beam *> beams;
+    for (int64_t i = 0; i < 10; i++) {
+        beams.push_back(pool.allocate(Beam{i, 1.0, 2.0, {1, 0, 0}, {0, 1, 0}}));
+    }
+    CHECK(pool.getNumRecords() == 10);
+    CHECK(pool.getCapacity() == 12);
+
+    // Records never move
+    for (int64_t i = 0; i < 10; i++) {
+        CHECK(beams[i]->transition_index == i);
+        CHECK(!pool.isRecycled(beams[i]));
+    }
+    Beam outside{};
+    CHECK(!pool.isRecycled(&outside));
+
+    // Slabs are kept across resets, and records are reused
+    pool.reset();
+    CHECK(pool.getNumRecords() == 0);
+    CHECK(pool.getCapacity() == 12);
+    CHECK(pool.isRecycled(beams[0]));
+    CHECK(pool.isRecycled(beams[9]));
+    CHECK(pool.allocate(Beam{42, 0.0, 0.0, {0, 0, 0}, {0, 0, 0}}) == beams[0]);
+    CHECK(beams[0]->transition_index == 42);
+    CHECK(!pool.isRecycled(beams[0]));
+    CHECK(pool.isRecycled(beams[1]));
+
+    pool.release();
+    CHECK(pool.getNumRecords() == 0);
+    CHECK(pool.getCapacity() == 0);
+}
+
+TEST_CASE("Test the reuse of pulse records across parallel protocols", "[oqd]")
+{
+    TempOutputFile output;
+    {
+        auto device = OQDDevice(output.getKwargs(0) + R"(ION:{"transitions":[{}]})");
+        std::vector<QubitIdType> qubits = device.AllocateQubits(1);
+        QUBIT *qubit = reinterpret_cast<QUBIT *>(qubits[0]);
+
+        Pulse *first = nullptr;
+        for (size_t i = 0; i < 3; i++) {
+            // The beam may only live until the pulse is created
+            Pulse *pulse = nullptr;
+            {
+                Beam beam = {0, 1.0, static_cast<double>(i), {1, 0, 0}, {0, 1, 0}};
+                pulse = __catalyst__oqd__pulse(qubit, 1.0, 0.0, &beam);
+            }
+            CHECK(pulse->beam->detuning == static_cast<double>(i));
+
+            first = first ? first : pulse;
+            CHECK(pulse == first);
+            __catalyst__oqd__ParallelProtocol(&pulse, 1);
+        }
+    }
+
+    json observed = json::parse(std::ifstream(output.name));
+
+    const auto &sequence = observed["protocol"]["sequence"];
+    REQUIRE(sequence.size() == 3);
+    for (size_t i = 0; i < 3; i++) {
+        CHECK(sequence[i]["sequence"][0]["beam"]["detuning"]["value"] == static_cast<double>(i));
+    }
+}
+
+TEST_CASE("Test the pulses used after their parallel protocol", "[oqd]")
+{
+    auto device = OQDDevice(
+        R"({shots : 0, openapl_file_name : /dev/null}ION:{"transitions":[{}]})");
+    std::vector<QubitIdType> qubits = device.AllocateQubits(1);
+    QUBIT *qubit = reinterpret_cast<QUBIT *>(qubits[0]);
+    Beam beam = {0, 1.0, 2.0, {1, 0, 0}, {0, 1, 0}};
+
+    // A pulse played in a protocol can't be played again
+    Pulse *played = __catalyst__oqd__pulse(qubit, 1.0, 0.0, &beam);
+    __catalyst__oqd__ParallelProtocol(&played, 1);
+    REQUIRE_THROWS_WITH(__catalyst__oqd__ParallelProtocol(&played, 1),
+                        ContainsSubstring("only valid until the next parallel protocol"));
+
+    // Neither can a pulse created before another protocol
+    Pulse *pending = __catalyst__oqd__pulse(qubit, 1.0, 0.0, &beam);
+    Pulse *other = __catalyst__oqd__pulse(qubit, 2.0, 0.0, &beam);
+    __catalyst__oqd__ParallelProtocol(&other, 1);
+    REQUIRE_THROWS_WITH(__catalyst__oqd__ParallelProtocol(&pending, 1),
+                        ContainsSubstring("only valid until the next parallel protocol"));
+
+    // Pulses created again are valid
+    Pulse *pulse = __catalyst__oqd__pulse(qubit, 1.0, 0.0, &beam);
+    __catalyst__oqd__ParallelProtocol(&pulse, 1);
+}
+
+TEST_CASE("Benchmark OQD programs with a million pulses", "[.][benchmark][oqd]")
+{
+    constexpr size_t num_protocols = 500000;
+
+    Beam beam0 = {0, 31.41592653589793, 157.07963267948966, {1, 0, 0}, {0, 1, 0}};
+    Beam beam1 = {1, 31.41592653589793, 157.07963267948966, {0, 0, 1}, {1, 0, 0}};
+
+    BENCHMARK("Emit 10^6 pulses")
+    {
+        auto device = OQDDevice(
+            R"({shots : 0, openapl_file_name : /dev/null}ION:{"transitions":[{},{}]})");
+        std::vector<QubitIdType> qubits = device.AllocateQubits(2);
+        QUBIT *q0 = reinterpret_cast<QUBIT *>(qubits[0]);
+        QUBIT *q1 = reinterpret_cast<QUBIT *>(qubits[1]);
 
-    std::filesystem::remove("__openapl__output.json");
+        for (size_t i = 0; i < num_protocols; i++) {
+            Pulse *pulses[] = {__catalyst__oqd__pulse(q0, 2.0, 0.0, &beam0),
+                               __catalyst__oqd__pulse(q1, 2.0, 3.14, &beam1)};
+            __catalyst__oqd__ParallelProtocol(pulses, 2);
+        }
+        return qubits.size();
+    };
 }
@@ -12,15 +12,20 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <iomanip>
 #include <memory>
+#include <numbers>
+#include <sstream>
 #include <string>
 #include <typeinfo>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
 #include "OpenQasmBuilder.hpp"
+#include "OpenQasmMeasurementBatch.hpp"
 
 #define TYPE_INFO(x) std::string(typeid(x).name())
 
@@ -548,3 +553,375 @@ TEMPLATE_TEST_CASE("Test OpenQasmBuilder with custom instructions", "[openqasm]"
               toqasm + state_pragma_str);
     }
 }
+
+TEST_CASE("Test QasmVariable(type=Float64) from OpenQasmBuilder", "[openqasm]")
+{
+    auto var = QasmVariable(VariableType::Float64, "theta_0");
+    CHECK(var.getType() == VariableType::Float64);
+    CHECK(var.toOpenQasm() == "input float[64] theta_0;\n");
+}
+
+TEMPLATE_TEST_CASE("Test OpenQasmBuilder in the parametric mode", "[openqasm]", OpenQasmBuilder,
+                   BraketBuilder)
+{
+    auto build = [](double rx_angle, double rz_angle, bool parametric) {
+        auto builder = TestType(parametric);
+        builder.Register(RegisterType::Qubit, "q", 2);
+        builder.Gate("RX", {rx_angle}, {}, {0}, false);
+        builder.Gate("CNOT", {}, {}, {0, 1}, false);
+        builder.Gate("RZ", {rz_angle}, {}, {1}, false);
+        return builder;
+    };
+
+    auto builder = build(0.1, 0.2, true);
+    CHECK(builder.isParametric());
+
+    auto &&values = builder.getParameterValues();
+    REQUIRE(values.size() == 2);
+    CHECK(values[0] == std::make_pair(std::string{"theta_0"}, 0.1));
+    CHECK(values[1] == std::make_pair(std::string{"theta_1"}, 0.2));
+
+    std::string toqasm;
+    if (TYPE_INFO(TestType) == TYPE_INFO(OpenQasmBuilder)) {
+        toqasm = "OPENQASM 3.0;\n"
+                 "input float[64] theta_0;\n"
+                 "input float[64] theta_1;\n"
+                 "qubit[2] q;\n"
+                 "rx(theta_0) q[0];\n"
+                 "cnot q[0], q[1];\n"
+                 "rz(theta_1) q[1];\n"
+                 "reset q;\n";
+    }
+    else if (TYPE_INFO(TestType) == TYPE_INFO(BraketBuilder)) {
+        toqasm = "OPENQASM 3.0;\n"
+                 "input float[64] theta_0;\n"
+                 "input float[64] theta_1;\n"
+                 "qubit[2] q;\n"
+                 "bit[2] bits;\n"
+                 "rx(theta_0) q[0];\n"
+                 "cnot q[0], q[1];\n"
+                 "rz(theta_1) q[1];\n"
+                 "bits = measure q;\n";
+    }
+    CHECK(builder.toOpenQasm() == toqasm);
+
+    // Only the parameter values differ; the template and its structure key don't.
+    auto other = build(0.3, 0.4, true);
+    CHECK(other.toOpenQasm() == toqasm);
+    CHECK(other.getStructureKey() == builder.getStructureKey());
+
+    auto other_structure = build(0.1, 0.2, true);
+    other_structure.Gate("Hadamard", {}, {}, {0}, false);
+    CHECK(other_structure.getStructureKey() != builder.getStructureKey());
+
+    // The programs of non-parametric circuits are not cached, so they have no structure key.
+    auto non_parametric = build(0.1, 0.2, false);
+    CHECK(!non_parametric.isParametric());
+    CHECK(non_parametric.getParameterValues().empty());
+    CHECK(non_parametric.getStructureKey().empty());
+
+    auto mixed = TestType(true);
+    mixed.Register(RegisterType::Qubit, "q", 1);
+    REQUIRE_THROWS_WITH(mixed.Gate("RX", {0.1}, {"alpha"}, {0}, false),
+                        ContainsSubstring("either their values or names but not both"));
+}
+
+TEST_CASE("Test QasmPeephole", "[openqasm]")
+{
+    auto run = [](const std::vector<QasmGate> &gates) {
+        QasmPeepholeStats stats{};
+        auto &&result = QasmPeephole::run(gates, stats);
+        CHECK(stats.num_gates_in == gates.size());
+        CHECK(stats.num_gates_out == result.size());
+        CHECK(stats.getDelta() == stats.num_cancelled + stats.num_merged + stats.num_dropped);
+        return std::make_pair(result, stats);
+    };
+
+    SECTION("Cancel adjacent inverses")
+    {
+        // h x x h cancels out completely, and cnot only cancels with the same control
+        auto &&[gates, stats] = run({QasmGate("Hadamard", {}, {}, {0}, false),
+                                     QasmGate("PauliX", {}, {}, {0}, false),
+                                     QasmGate("PauliX", {}, {}, {0}, false),
+                                     QasmGate("Hadamard", {}, {}, {0}, false),
+                                     QasmGate("CNOT", {}, {}, {0, 1}, false),
+                                     QasmGate("CNOT", {}, {}, {1, 0}, false),
+                                     QasmGate("CZ", {}, {}, {2, 3}, false),
+                                     QasmGate("CZ", {}, {}, {3, 2}, false)});
+        REQUIRE(gates.size() == 2);
+        CHECK(gates[0].getWires() == std::vector<size_t>{0, 1});
+        CHECK(gates[1].getWires() == std::vector<size_t>{1, 0});
+        CHECK(stats.num_cancelled == 6);
+    }
+
+    SECTION("Gates in between on any wire block the cancellation")
+    {
+        auto &&[gates, stats] = run({QasmGate("CNOT", {}, {}, {0, 1}, false),
+                                     QasmGate("PauliZ", {}, {}, {1}, false),
+                                     QasmGate("CNOT", {}, {}, {0, 1}, false),
+                                     QasmGate("PauliY", {}, {}, {2}, false),
+                                     QasmGate("PauliY", {}, {}, {2}, true)});
+        CHECK(gates.size() == 5);
+        CHECK(stats.getDelta() == 0);
+    }
+
+    SECTION("Merge rotations")
+    {
+        auto &&[gates, stats] = run({QasmGate("RX", {0.25}, {}, {0}, false),
+                                     QasmGate("RX", {0.5}, {}, {0}, false),
+                                     QasmGate("RZ", {0.1}, {}, {1}, false),
+                                     QasmGate("RY", {0.1}, {}, {1}, false),
+                                     QasmGate("PhaseShift", {std::numbers::pi}, {}, {2}, false),
+                                     QasmGate("PhaseShift", {std::numbers::pi}, {}, {2}, false),
+                                     QasmGate("S", {}, {}, {3}, false),
+                                     QasmGate("S", {}, {}, {3}, false),
+                                     QasmGate("RX", {0.3}, {}, {0}, false)});
+        REQUIRE(gates.size() == 4);
+        CHECK(gates[0].getName() == "rx");
+        CHECK(std::abs(gates[0].getParams()[0] - 1.05) < 1e-12);
+        CHECK(gates[1].getName() == "rz");
+        CHECK(gates[2].getName() == "ry");
+        CHECK(gates[3].getName() == "z");
+        CHECK(stats.num_merged == 4);
+        CHECK(stats.num_dropped == 1);
+    }
+
+    SECTION("Drop identities")
+    {
+        // rx(2pi) = -I is kept, as its global phase is observable by `State`
+        auto &&[gates, stats] = run({QasmGate("Identity", {}, {}, {0}, false),
+                                     QasmGate("RZ", {0.0}, {}, {0}, false),
+                                     QasmGate("RY", {4 * std::numbers::pi}, {}, {0}, false),
+                                     QasmGate("RX", {2 * std::numbers::pi}, {}, {1}, false),
+                                     QasmGate({{1, 0}, {0, 0}, {0, 0}, {1, 0}}, {1}, false)});
+        REQUIRE(gates.size() == 1);
+        CHECK(gates[0].getName() == "rx");
+        CHECK(stats.num_dropped == 4);
+    }
+
+    SECTION("Merge unitaries")
+    {
+        const std::vector<std::complex<double>> x{{0, 0}, {1, 0}, {1, 0}, {0, 0}};
+        const std::vector<std::complex<double>> z{{1, 0}, {0, 0}, {0, 0}, {-1, 0}};
+        auto &&[gates, stats] =
+            run({QasmGate(x, {0}, false), QasmGate(z, {0}, false), QasmGate(x, {1}, false),
+                 QasmGate(x, {1}, false)});
+        REQUIRE(gates.size() == 1);
+        // Z X = [[0, 1], [-1, 0]]
+        CHECK(gates[0].getMatrix() ==
+              std::vector<std::complex<double>>{{0, 0}, {1, 0}, {-1, 0}, {0, 0}});
+        CHECK(stats.num_merged == 2);
+        CHECK(stats.num_dropped == 1);
+    }
+
+    SECTION("Symbolic parameters are not merged")
+    {
+        auto &&[gates, stats] = run({QasmGate("RX", {}, {"a"}, {0}, false),
+                                     QasmGate("RX", {}, {"b"}, {0}, false)});
+        CHECK(gates.size() == 2);
+    }
+}
+
+TEMPLATE_TEST_CASE("Test OpenQasmBuilder with the peephole stage", "[openqasm]", OpenQasmBuilder,
+                   BraketBuilder)
+{
+    auto builder = TestType(false, true);
+    CHECK(builder.isPeephole());
+    builder.Register(RegisterType::Qubit, "q", 2);
+    builder.Gate("Hadamard", {}, {}, {0}, false);
+    builder.Gate("Hadamard", {}, {}, {0}, false);
+    builder.Gate("RX", {0.5}, {}, {1}, false);
+    builder.Gate("RX", {0.25}, {}, {1}, false);
+    builder.Gate("CNOT", {}, {}, {0, 1}, false);
+
+    std::string toqasm;
+    if (TYPE_INFO(TestType) == TYPE_INFO(OpenQasmBuilder)) {
+        toqasm = "OPENQASM 3.0;\n"
+                 "qubit[2] q;\n"
+                 "rx(0.75) q[1];\n"
+                 "cnot q[0], q[1];\n"
+                 "reset q;\n";
+    }
+    else if (TYPE_INFO(TestType) == TYPE_INFO(BraketBuilder)) {
+        toqasm = "OPENQASM 3.0;\n"
+                 "qubit[2] q;\n"
+                 "bit[2] bits;\n"
+                 "rx(0.75) q[1];\n"
+                 "cnot q[0], q[1];\n"
+                 "bits = measure q;\n";
+    }
+    CHECK(builder.toOpenQasm() == toqasm);
+
+    auto &&stats = builder.getPeepholeStats();
+    CHECK(stats.num_gates_in == 5);
+    CHECK(stats.num_gates_out == 2);
+    CHECK(stats.getDelta() == 3);
+
+    // The stage is applied again to the gates recorded afterwards.
+    builder.Gate("CNOT", {}, {}, {0, 1}, false);
+    CHECK(builder.getPeepholeStats().num_gates_out == 1);
+
+    auto plain = TestType();
+    CHECK(!plain.isPeephole());
+    plain.Register(RegisterType::Qubit, "q", 1);
+    plain.Gate("PauliX", {}, {}, {0}, false);
+    plain.Gate("PauliX", {}, {}, {0}, false);
+    CHECK(plain.getPeepholeStats().getDelta() == 0);
+    CHECK(plain.toOpenQasm().find("x q[0];\nx q[0];") != std::string::npos);
+}
+
+TEST_CASE("Test streaming the OpenQasm instructions into one buffer", "[openqasm]")
+{
+    auto reg = QasmRegister(RegisterType::Qubit, "q", 3);
+    auto breg = QasmRegister(RegisterType::Bit, "b", 3);
+    auto gate = QasmGate("RX", {0.123456789}, {}, {1}, false);
+    auto unitary = QasmGate({{0.5, -0.25}, {0, 0}, {0, 0}, {1e-7, 1}}, {2}, false);
+    auto measure = QasmMeasure(2, 1);
+
+    std::string buffer{"// prefix\n"};
+    reg.toOpenQasm(buffer, RegisterMode::Alloc);
+    gate.toOpenQasm(buffer, reg, 4);
+    unitary.toOpenQasm(buffer, reg, 3);
+    measure.toOpenQasm(buffer, breg, reg);
+    reg.toOpenQasm(buffer, RegisterMode::Reset);
+
+    CHECK(buffer == "// prefix\n" + reg.toOpenQasm(RegisterMode::Alloc) +
+                        gate.toOpenQasm(reg, 4) + unitary.toOpenQasm(reg, 3) +
+                        measure.toOpenQasm(breg, reg) + reg.toOpenQasm(RegisterMode::Reset));
+    CHECK(buffer == "// prefix\n"
+                    "qubit[3] q;\n"
+                    "rx(0.1235) q[1];\n"
+                    "#pragma braket unitary([[0.5-0.25im, 0], [0, 1e-07+1im]]) q[2]\n"
+                    "b[2] = measure q[1];\n"
+                    "reset q;\n");
+
+    // Values are formatted as `std::ostream` does with `std::setprecision`.
+    for (double value : {0.0, -0.0, 1.0, -2.5, 0.1, 1.0 / 3, 123456.789, 1e-12, -6.02e23}) {
+        for (size_t precision : {1, 5, 9, 17}) {
+            std::ostringstream oss;
+            oss << std::setprecision(precision) << value;
+
+            std::string serialized;
+            appendOpenQasm(serialized, value, precision);
+            CHECK(serialized == oss.str());
+        }
+    }
+}
+
+TEST_CASE("Benchmark OpenQasmBuilder with large circuits", "[.][benchmark][openqasm]")
+{
+    constexpr size_t num_qubits{20};
+    constexpr size_t num_gates{100000};
+
+    auto build = []() {
+        BraketBuilder builder{};
+        builder.Register(RegisterType::Qubit, "qubits", num_qubits);
+        for (size_t idx = 0; idx < num_gates; idx++) {
+            const size_t wire = idx % num_qubits;
+            switch (idx % 4) {
+            case 0:
+                builder.Gate("Hadamard", {}, {}, {wire}, false);
+                break;
+            case 1:
+                builder.Gate("RX", {0.001 * static_cast<double>(idx)}, {}, {wire}, false);
+                break;
+            case 2:
+                builder.Gate("CNOT", {}, {}, {wire, (wire + 1) % num_qubits}, false);
+                break;
+            default:
+                builder.Gate("RZ", {-0.5 / static_cast<double>(idx)}, {}, {wire}, false);
+                break;
+            }
+        }
+        return builder;
+    };
+
+    auto &&builder = build();
+    CHECK(builder.toOpenQasm().size() > num_gates * 10);
+
+    BENCHMARK("BraketBuilder::toOpenQasm with 10^5 gates") { return builder.toOpenQasm(); };
+
+    BENCHMARK("BraketBuilder::toOpenQasmWithCustomInstructions with 10^5 gates")
+    {
+        return builder.toOpenQasmWithCustomInstructions(
+            "#pragma braket result expectation z(qubits[0])\n", 9);
+    };
+}
+
+TEST_CASE("Test QasmMeasurementBatch", "[openqasm]")
+{
+    using Catalyst::Runtime::MeasurementsT;
+
+    auto reg = QasmRegister(RegisterType::Qubit, "q", 3);
+
+    auto obs_x0 = QasmNamedObs("PauliX", {0});
+    auto obs_z0 = QasmNamedObs("PauliZ", {0});
+    auto obs_z1 = QasmNamedObs("PauliZ", {1});
+    auto obs_i2 = QasmNamedObs("Identity", {2});
+    auto obs_x0z1 = QasmTensorObs(std::make_shared<QasmNamedObs>(obs_x0),
+                                  std::make_shared<QasmNamedObs>(obs_z1));
+
+    SECTION("Analytic batch")
+    {
+        auto batch = QasmMeasurementBatch(reg, true);
+
+        auto slot_x0 = batch.add(MeasurementsT::Expval, obs_x0);
+        auto slot_z0 = batch.add(MeasurementsT::Expval, obs_z0);
+        auto slot_var_x0 = batch.add(MeasurementsT::Var, obs_x0);
+        auto slot_dup = batch.add(MeasurementsT::Expval, obs_x0);
+
+        CHECK(slot_dup == slot_x0);
+        CHECK(batch.getNumSlots() == 3);
+        CHECK(batch.getNumGroups() == 1);
+        CHECK(batch.getGroupInstructions(0) == "#pragma braket result expectation x(q[0])\n"
+                                               "#pragma braket result expectation z(q[0])\n"
+                                               "#pragma braket result variance x(q[0])\n");
+
+        REQUIRE_THROWS_WITH(batch.getResult(slot_x0), ContainsSubstring("is not computed"));
+        REQUIRE_THROWS_WITH(batch.setGroupValues(0, {0.1}),
+                            ContainsSubstring("Invalid number of results"));
+
+        batch.setGroupValues(0, {0.1, 0.2, 0.3});
+        CHECK(batch.getResult(slot_x0) == 0.1);
+        CHECK(batch.getResult(slot_z0) == 0.2);
+        CHECK(batch.getResult(slot_var_x0) == 0.3);
+    }
+
+    SECTION("Shot-based batch")
+    {
+        auto batch = QasmMeasurementBatch(reg, false);
+
+        auto slot_x0 = batch.add(MeasurementsT::Expval, obs_x0);
+        auto slot_z0 = batch.add(MeasurementsT::Expval, obs_z0);
+        auto slot_x0z1 = batch.add(MeasurementsT::Expval, obs_x0z1);
+        auto slot_i2 = batch.add(MeasurementsT::Expval, obs_i2);
+
+        // z(q[0]) conflicts with x(q[0]); the tensor product and the identity don't.
+        CHECK(batch.getNumGroups() == 2);
+        CHECK(batch.getGroupInstructions(0) == "#pragma braket result expectation x(q[0])\n"
+                                               "#pragma braket result expectation x(q[0]) @ "
+                                               "z(q[1])\n"
+                                               "#pragma braket result expectation i(q[2])\n");
+        CHECK(batch.getGroupInstructions(1) == "#pragma braket result expectation z(q[0])\n");
+
+        batch.setGroupValues(0, {0.1, 0.2, 1.0});
+        batch.setGroupValues(1, {0.3});
+        CHECK(batch.getResult(slot_x0) == 0.1);
+        CHECK(batch.getResult(slot_x0z1) == 0.2);
+        CHECK(batch.getResult(slot_i2) == 1.0);
+        CHECK(batch.getResult(slot_z0) == 0.3);
+    }
+
+    SECTION("Invalid requests")
+    {
+        auto batch = QasmMeasurementBatch(reg, true);
+        auto ham = QasmHamiltonianObs::create({0.5}, {std::make_shared<QasmNamedObs>(obs_x0)});
+
+        REQUIRE_THROWS_WITH(batch.add(MeasurementsT::Expval, *ham),
+                            ContainsSubstring("Hamiltonian terms must be added separately"));
+        REQUIRE_THROWS_WITH(batch.add(MeasurementsT::Probs, obs_x0),
+                            ContainsSubstring("Unsupported measurement process to batch"));
+        REQUIRE_THROWS_WITH(batch.getGroupInstructions(0),
+                            ContainsSubstring("Invalid measurement group"));
+    }
+}
@@ -12,6 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <random>
+#include <thread>
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
@@ -23,6 +29,8 @@
 #include "RuntimeCAPI.h"
 
 #include "OpenQasmDevice.hpp"
+#include "OpenQasmJob.hpp"
+#include "OpenQasmNativeRunner.hpp"
 #include "OpenQasmRunner.hpp"
 
 using namespace Catch::Matchers;
@@ -54,6 +62,10 @@ TEST_CASE("Test OpenQasmRunner base class", "[openqasm]")
                         ContainsSubstring("[Function:Var] Error in Catalyst Runtime: "
                                           "Not implemented method"));
 
+    REQUIRE_THROWS_WITH(runner.Values("", "", 0),
+                        ContainsSubstring("[Function:Values] Error in Catalyst Runtime: "
+                                          "Not implemented method"));
+
     REQUIRE_THROWS_WITH(runner.State("", "", 0, 0),
                         ContainsSubstring("[Function:State] Error in Catalyst Runtime: "
                                           "Not implemented method"));
@@ -63,6 +75,18 @@ TEST_CASE("Test OpenQasmRunner base class", "[openqasm]")
                                           "Not implemented method"));
 }
 
+TEST_CASE("Test serializeInputs", "[openqasm]")
+{
+    CHECK(OpenQasm::serializeInputs({}).empty());
+    CHECK(OpenQasm::serializeInputs({{"theta_0", 0.5}}) == "theta_0:0.5");
+    CHECK(OpenQasm::serializeInputs({{"theta_0", 0.1}, {"theta_1", -2}}) ==
+          "theta_0:0.1,theta_1:-2");
+
+    // Values are serialized without loss of precision.
+    auto &&serialized = OpenQasm::serializeInputs({{"theta_0", 1.0 / 3}});
+    CHECK(std::stod(serialized.substr(serialized.find(':') + 1)) == 1.0 / 3);
+}
+
 TEST_CASE("Test BraketRunner", "[openqasm]")
 {
     OpenQasm::BraketBuilder builder{};
@@ -170,6 +194,288 @@ TEST_CASE("Test BraketRunner Expval and Var", "[openqasm]")
     }
 }
 
+TEST_CASE("Test BraketRunner session lifecycle", "[openqasm]")
+{
+    OpenQasm::BraketBuilder builder{};
+
+    builder.Register(OpenQasm::RegisterType::Qubit, "q", 1);
+    builder.Gate("Hadamard", {}, {}, {0}, false);
+
+    auto &&circuit =
+        builder.toOpenQasmWithCustomInstructions("#pragma braket result expectation z(q[0])");
+
+    if (!Py_IsInitialized()) {
+        pybind11::initialize_interpreter();
+    }
+
+    OpenQasm::BraketRunner runner{};
+    CHECK(!runner.isSessionOpen());
+
+    // The session is opened by the first execution and reused by the following ones.
+    CHECK(runner.Expval(circuit, "default", 0) == Catch::Approx(0.0).margin(1e-5));
+    CHECK(runner.isSessionOpen());
+    CHECK(runner.Expval(circuit, "default", 0) == Catch::Approx(0.0).margin(1e-5));
+    CHECK(runner.isSessionOpen());
+
+    runner.closeSession();
+    CHECK(!runner.isSessionOpen());
+
+    runner.openSession();
+    CHECK(runner.isSessionOpen());
+    CHECK(runner.Var(circuit, "default", 0) == Catch::Approx(1.0).margin(1e-5));
+}
+
+TEST_CASE("Test the buffer sizes of BraketRunner", "[openqasm]")
+{
+    OpenQasm::BraketRunner runner{};
+    std::vector<double> buffer(4);
+
+    // The sizes are checked before the session is opened
+    REQUIRE_THROWS_WITH(runner.ProbsInto(buffer.data(), buffer.size(), "", "default", 0, 64),
+                        ContainsSubstring("probabilities of 64 qubits or more"));
+    REQUIRE_THROWS_WITH(runner.ProbsInto(buffer.data(), 3, "", "default", 0, 2),
+                        ContainsSubstring("Invalid size for the pre-allocated probabilities"));
+    REQUIRE_THROWS_WITH(runner.SampleInto(buffer.data(), 3, "", "default", 2, 2),
+                        ContainsSubstring("Invalid size for the pre-allocated samples"));
+    CHECK(!runner.isSessionOpen());
+}
+
+TEST_CASE("Test NativeRunner", "[openqasm]")
+{
+    OpenQasm::BraketBuilder builder{};
+
+    builder.Register(OpenQasm::RegisterType::Qubit, "q", 2);
+
+    builder.Gate("RX", {0.5}, {}, {0}, false);
+    builder.Gate("Hadamard", {}, {}, {1}, false);
+    builder.Gate("CNOT", {}, {}, {0, 1}, false);
+
+    // No Python interpreter is required by the native runner.
+    OpenQasm::NativeRunner runner{42};
+
+    SECTION("Test NativeRunner::runCircuit()")
+    {
+        auto &&results = runner.runCircuit(builder.toOpenQasm(), "native", 100);
+        CHECK(results.find("NativeTaskResult(num_qubits=2, shots=100") != std::string::npos);
+        CHECK(results.find("measurement_counts") != std::string::npos);
+    }
+
+    SECTION("Test NativeRunner::Probs()")
+    {
+        // |psi> = (cos(0.25)|0> - i sin(0.25)|1>) (|0> + |1>) / sqrt(2), followed by CNOT
+        const double p0 = std::pow(std::cos(0.25), 2) / 2;
+        const double p1 = std::pow(std::sin(0.25), 2) / 2;
+
+        auto &&probs = runner.Probs(builder.toOpenQasm(), "native", 0, 2);
+        REQUIRE(probs.size() == 4);
+        CHECK(probs[0] == Catch::Approx(p0).margin(1e-5));
+        CHECK(probs[1] == Catch::Approx(p0).margin(1e-5));
+        CHECK(probs[2] == Catch::Approx(p1).margin(1e-5));
+        CHECK(probs[3] == Catch::Approx(p1).margin(1e-5));
+
+        auto &&partial_probs = runner.Probs(
+            builder.toOpenQasmWithCustomInstructions("#pragma braket result probability q[0]"),
+            "native", 0, 1);
+        REQUIRE(partial_probs.size() == 2);
+        CHECK(partial_probs[0] == Catch::Approx(2 * p0).margin(1e-5));
+        CHECK(partial_probs[1] == Catch::Approx(2 * p1).margin(1e-5));
+
+        auto &&shots_probs = runner.Probs(builder.toOpenQasm(), "native", 10000, 2);
+        CHECK(shots_probs[0] + shots_probs[1] == Catch::Approx(2 * p0).margin(5e-2));
+
+        REQUIRE_THROWS_WITH(runner.Probs(builder.toOpenQasm(), "native", 0, 3),
+                            ContainsSubstring("Invalid number of qubits for the probabilities"));
+    }
+
+    SECTION("Test NativeRunner::Sample()")
+    {
+        auto &&samples = runner.Sample(builder.toOpenQasm(), "native", 100, 2);
+        CHECK(samples.size() == 200);
+        for (size_t shot = 0; shot < 100; shot++) {
+            // The second qubit is H-then-CNOT'd; each bit is 0 or 1
+            CHECK((samples[2 * shot] == 0 || samples[2 * shot] == 1));
+            CHECK((samples[2 * shot + 1] == 0 || samples[2 * shot + 1] == 1));
+        }
+
+        REQUIRE_THROWS_WITH(runner.Sample(builder.toOpenQasm(), "native", 0, 2),
+                            ContainsSubstring("The number of shots must be positive"));
+    }
+
+    SECTION("Test NativeRunner::Expval() and NativeRunner::Var()")
+    {
+        auto &&circuit_expval = builder.toOpenQasmWithCustomInstructions(
+            "#pragma braket result expectation z(q[0]) @ x(q[1])");
+        CHECK(runner.Expval(circuit_expval, "native", 0) ==
+              Catch::Approx(std::cos(0.5)).margin(1e-5));
+
+        circuit_expval =
+            builder.toOpenQasmWithCustomInstructions("#pragma braket result expectation z(q[0])");
+        CHECK(runner.Expval(circuit_expval, "native", 0) ==
+              Catch::Approx(std::cos(0.5)).margin(1e-5));
+        CHECK(runner.Expval(circuit_expval, "native", 10000) ==
+              Catch::Approx(std::cos(0.5)).margin(5e-2));
+
+        auto &&circuit_var =
+            builder.toOpenQasmWithCustomInstructions("#pragma braket result variance z(q[0])");
+        CHECK(runner.Var(circuit_var, "native", 0) ==
+              Catch::Approx(1 - std::pow(std::cos(0.5), 2)).margin(1e-5));
+        CHECK(runner.Var(circuit_var, "native", 10000) ==
+              Catch::Approx(1 - std::pow(std::cos(0.5), 2)).margin(5e-2));
+
+        auto &&circuit_hermitian = builder.toOpenQasmWithCustomInstructions(
+            "#pragma braket result expectation hermitian([[1+0im, 0], [0, -1+0im]]) q[0]");
+        CHECK(runner.Expval(circuit_hermitian, "native", 0) ==
+              Catch::Approx(std::cos(0.5)).margin(1e-5));
+        REQUIRE_THROWS_WITH(runner.Expval(circuit_hermitian, "native", 100),
+                            ContainsSubstring("only supported with zero shots"));
+
+        REQUIRE_THROWS_WITH(runner.Expval(builder.toOpenQasmWithCustomInstructions(""), "native",
+                                          0),
+                            ContainsSubstring("Unable to compute expectation value"));
+        REQUIRE_THROWS_WITH(runner.Var(builder.toOpenQasmWithCustomInstructions(""), "native", 0),
+                            ContainsSubstring("Unable to compute variance"));
+    }
+
+    SECTION("Test NativeRunner::Values()")
+    {
+        auto &&circuit = builder.toOpenQasmWithCustomInstructions(
+            "#pragma braket result expectation x(q[1])\n"
+            "#pragma braket result variance y(q[0])\n"
+            "#pragma braket result expectation h(q[0]) @ i(q[1])\n");
+
+        auto &&values = runner.Values(circuit, "native", 0);
+        REQUIRE(values.size() == 3);
+        CHECK(values[0] == Catch::Approx(1.0).margin(1e-5));
+        CHECK(values[1] == Catch::Approx(1 - std::pow(std::sin(0.5), 2)).margin(1e-5));
+        CHECK(values[2] == Catch::Approx(std::cos(0.5) / std::sqrt(2)).margin(1e-5));
+    }
+
+    SECTION("Test NativeRunner::State()")
+    {
+        auto &&state = runner.State(
+            builder.toOpenQasmWithCustomInstructions("#pragma braket result state_vector"),
+            "native", 0, 2);
+        REQUIRE(state.size() == 4);
+        CHECK(state[0].real() == Catch::Approx(std::cos(0.25) / std::sqrt(2)).margin(1e-5));
+        CHECK(state[3].imag() == Catch::Approx(-std::sin(0.25) / std::sqrt(2)).margin(1e-5));
+
+        REQUIRE_THROWS_WITH(runner.State(builder.toOpenQasm(), "native", 100, 2),
+                            ContainsSubstring("The number of shots must be zero"));
+    }
+
+    SECTION("Test NativeRunner with inputs")
+    {
+        OpenQasm::BraketBuilder parametric{true};
+        parametric.Register(OpenQasm::RegisterType::Qubit, "q", 1);
+        parametric.Gate("RY", {0.0}, {}, {0}, false);
+
+        auto &&circuit = parametric.toOpenQasmWithCustomInstructions(
+            "#pragma braket result expectation z(q[0])");
+        CHECK(runner.Expval(circuit, "native", 0, "", "theta_0:0") ==
+              Catch::Approx(1.0).margin(1e-5));
+        CHECK(runner.Expval(circuit, "native", 0, "", "theta_0:3.141592653589793") ==
+              Catch::Approx(-1.0).margin(1e-5));
+
+        REQUIRE_THROWS_WITH(runner.Expval(circuit, "native", 0),
+                            ContainsSubstring("Missing value for an input variable"));
+    }
+
+    SECTION("Test NativeRunner with invalid programs")
+    {
+        REQUIRE_THROWS_WITH(
+            runner.Probs("OPENQASM 3.0;\nqubit[1] q;\nu3(0.1) q[0];\n", "", 0, 1),
+            ContainsSubstring("not supported by the native runner"));
+        REQUIRE_THROWS_WITH(runner.Probs("OPENQASM 3.0;\nqubit[1] q;\nx q[1];\n", "", 0, 1),
+                            ContainsSubstring("Invalid OpenQasm operands"));
+        REQUIRE_THROWS_WITH(runner.Probs("OPENQASM 3.0;\nqubit[1] q;\nx q[0]\n", "", 0, 1),
+                            ContainsSubstring("Missing semicolon"));
+        REQUIRE_THROWS_WITH(runner.Probs("OPENQASM 3.0;\nx q[0];\n", "", 0, 1),
+                            ContainsSubstring("No quantum register declared"));
+        REQUIRE_THROWS_WITH(
+            runner.Probs("OPENQASM 3.0;\nqubit[1] q;\nmeasure q[0];\nx q[0];\n", "", 0, 1),
+            ContainsSubstring("Mid-circuit measurements are not supported"));
+    }
+}
+
+TEST_CASE("Test deserializeInputs", "[openqasm]")
+{
+    CHECK(OpenQasm::deserializeInputs("").empty());
+
+    auto &&inputs = OpenQasm::deserializeInputs(
+        OpenQasm::serializeInputs({{"theta_0", 0.1}, {"theta_1", -2}, {"theta_2", 1.0 / 3}}));
+    REQUIRE(inputs.size() == 3);
+    CHECK(inputs["theta_0"] == 0.1);
+    CHECK(inputs["theta_1"] == -2);
+    CHECK(inputs["theta_2"] == 1.0 / 3);
+
+    REQUIRE_THROWS_WITH(OpenQasm::deserializeInputs("theta_0"),
+                        ContainsSubstring("Invalid serialized input value"));
+    REQUIRE_THROWS_WITH(OpenQasm::deserializeInputs("theta_0:x"),
+                        ContainsSubstring("Invalid serialized input value"));
+}
+
+TEST_CASE("Test QasmResultCache", "[openqasm]")
+{
+    using OpenQasm::QasmResultCache;
+
+    SECTION("Digest")
+    {
+        auto &&key = QasmResultCache::digest({"probs", "default", "OPENQASM 3.0;"});
+        CHECK(key.size() == 32);
+        CHECK(key == QasmResultCache::digest({"probs", "default", "OPENQASM 3.0;"}));
+        CHECK(key != QasmResultCache::digest({"values", "default", "OPENQASM 3.0;"}));
+        CHECK(QasmResultCache::digest({"ab", "c"}) != QasmResultCache::digest({"a", "bc"}));
+    }
+
+    SECTION("LRU eviction")
+    {
+        QasmResultCache cache{2};
+        CHECK(!cache.isPersistent());
+
+        cache.insert("a", {1.0});
+        cache.insert("b", {2.0});
+        CHECK(cache.lookup("a") == std::vector<double>{1.0}); // "b" is the least recently used
+        cache.insert("c", {3.0});
+
+        CHECK(cache.getSize() == 2);
+        CHECK(!cache.lookup("b"));
+        CHECK(cache.lookup("c") == std::vector<double>{3.0});
+        CHECK(cache.lookup("a") == std::vector<double>{1.0});
+        CHECK(cache.getHits() == 3);
+        CHECK(cache.getMisses() == 1);
+
+        cache.insert("a", {4.0, 5.0});
+        CHECK(cache.lookup("a") == std::vector<double>{4.0, 5.0});
+
+        cache.clear();
+        CHECK(cache.getSize() == 0);
+        CHECK(!cache.lookup("a"));
+
+        REQUIRE_THROWS_WITH(QasmResultCache{0}, ContainsSubstring("Invalid capacity"));
+    }
+
+    SECTION("On-disk store")
+    {
+        auto &&dir = std::filesystem::temp_directory_path() /
+                     ("catalyst_qasm_result_cache_" + std::to_string(std::random_device{}()));
+        auto &&key = QasmResultCache::digest({"values", "circuit"});
+        {
+            QasmResultCache cache{1, dir.string()};
+            CHECK(cache.isPersistent());
+            cache.insert(key, {0.25, -0.5});
+            cache.insert("other", {1.0}); // evicts `key` from memory
+            CHECK(cache.lookup(key) == std::vector<double>{0.25, -0.5});
+        }
+
+        // A new cache, e.g. in another process, shares the stored results.
+        QasmResultCache cache{4, dir.string()};
+        CHECK(cache.lookup(key) == std::vector<double>{0.25, -0.5});
+        CHECK(!cache.lookup(QasmResultCache::digest({"values", "other circuit"})));
+
+        std::filesystem::remove_all(dir);
+    }
+}
+
 TEST_CASE("Test the OpenQasmDevice constructor", "[openqasm]")
 {
     SECTION("Common")
@@ -532,8 +838,51 @@ TEST_CASE("Test measurement processes, a simple circuit with BuilderType::Braket
         CHECK(expval == Catch::Approx(0.7071067812).margin(1e-5));
 
         auto obs = device->HamiltonianObservable({0.2}, {tp});
-        REQUIRE_THROWS_WITH(device->Expval(obs),
-                            ContainsSubstring("Unsupported observable: QasmHamiltonianObs"));
+        CHECK(device->Expval(obs) == Catch::Approx(0.2 * 0.7071067812).margin(1e-5));
+    }
+
+    SECTION("Expval(0.2 * z(0) @ h(1) + 0.5 * x(1) + 0.3 * z(1))")
+    {
+        device->SetDeviceShots(0); // to get deterministic results
+        auto obs_z0 = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{0});
+        auto obs_h1 = device->Observable(ObsId::Hadamard, {}, std::vector<QubitIdType>{1});
+        auto obs_x1 = device->Observable(ObsId::PauliX, {}, std::vector<QubitIdType>{1});
+        auto obs_z1 = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{1});
+        auto tp = device->TensorObservable({obs_z0, obs_h1});
+        auto obs = device->HamiltonianObservable({0.2, 0.5, 0.3}, {tp, obs_x1, obs_z1});
+
+        const double expected = 0.2 * device->Expval(tp) + 0.5 * device->Expval(obs_x1) +
+                                0.3 * device->Expval(obs_z1);
+        CHECK(device->Expval(obs) == Catch::Approx(expected).margin(1e-5));
+
+        // Non-commuting terms on the same wire are split into separate submissions with shots.
+        device->SetDeviceShots(1000);
+        auto expval = device->Expval(obs);
+        CHECK((expval >= -1.0 && expval <= 1.0));
+    }
+
+    SECTION("Deferred Expval and Var")
+    {
+        device->SetDeviceShots(0); // to get deterministic results
+        auto obs_z0 = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{0});
+        auto obs_h1 = device->Observable(ObsId::Hadamard, {}, std::vector<QubitIdType>{1});
+        auto tp = device->TensorObservable({obs_z0, obs_h1});
+
+        CHECK(device->DeferExpval(obs_h1) == 0);
+        CHECK(device->DeferExpval(tp) == 1);
+        CHECK(device->DeferVar(obs_h1) == 2);
+        CHECK(device->DeferExpval(obs_h1) == 3);
+
+        auto &&results = device->ExecuteDeferred();
+        REQUIRE(results.size() == 4);
+        CHECK(results[0] == Catch::Approx(-0.7071067812).margin(1e-5));
+        CHECK(results[1] == Catch::Approx(0.7071067812).margin(1e-5));
+        CHECK(results[2] == Catch::Approx(0.5).margin(1e-5));
+        CHECK(results[3] == Catch::Approx(-0.7071067812).margin(1e-5));
+
+        auto ham = device->HamiltonianObservable({0.2}, {tp});
+        REQUIRE_THROWS_WITH(device->DeferExpval(ham),
+                            ContainsSubstring("Unsupported observable to defer"));
     }
 
     SECTION("Var(h(1))")
@@ -573,6 +922,110 @@ TEST_CASE("Test measurement processes, a simple circuit with BuilderType::Braket
     }
 }
 
+TEST_CASE("Test parametric programs with BuilderType::Braket", "[openqasm]")
+{
+    std::unique_ptr<OpenQasmDevice> device = std::make_unique<OpenQasmDevice>(
+        "{device_type : braket.local.qubit, backend : default, parametric : True}");
+    device->SetDeviceShots(0); // to get deterministic results
+
+    std::string toqasm = "OPENQASM 3.0;\n"
+                         "input float[64] theta_0;\n"
+                         "qubit[1] qubits;\n"
+                         "bit[1] bits;\n"
+                         "rx(theta_0) qubits[0];\n"
+                         "bits = measure qubits;\n";
+
+    for (double angle : {0.0, 0.6, 1.2}) {
+        auto wires = device->AllocateQubits(1);
+        device->NamedOperation("RX", {angle}, {wires[0]}, false);
+        CHECK(device->Circuit() == toqasm);
+
+        auto obs = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{wires[0]});
+        CHECK(device->Expval(obs) == Catch::Approx(std::cos(angle)).margin(1e-5));
+
+        std::vector<double> probs(2);
+        DataView<double, 1> view(probs);
+        device->Probs(view);
+        CHECK(probs[0] == Catch::Approx(std::pow(std::cos(angle / 2), 2)).margin(1e-5));
+
+        device->ReleaseAllQubits();
+    }
+}
+
+TEST_CASE("Test the program cache of parametric programs", "[openqasm]")
+{
+    std::unique_ptr<OpenQasmDevice> device = std::make_unique<OpenQasmDevice>(
+        "{device_type : braket.local.qubit, backend : native, parametric : True}");
+    device->SetDeviceShots(0); // to get deterministic results
+
+    // Circuits of the same structure share their program, whatever their parameter values
+    for (double angle : {0.0, 0.6, 1.2}) {
+        auto wires = device->AllocateQubits(2);
+        device->NamedOperation("RX", {angle}, {wires[0]}, false);
+
+        std::vector<double> probs(4);
+        DataView<double, 1> view(probs);
+        device->Probs(view);
+        CHECK(probs[0] == Catch::Approx(std::pow(std::cos(angle / 2), 2)).margin(1e-5));
+
+        device->ReleaseAllQubits();
+    }
+    CHECK(device->GetProgramCacheSize() == 1);
+    CHECK(device->GetProgramCacheHits() == 2);
+
+    // Circuits of different structures never share an entry, even with the same gates and the
+    // same number of wires and parameters
+    auto run = [&device](const std::string &gate, size_t wire) {
+        auto wires = device->AllocateQubits(2);
+        device->NamedOperation(gate, {0.6}, {wires[wire]}, false);
+
+        std::vector<double> probs(4);
+        DataView<double, 1> view(probs);
+        device->Probs(view);
+        device->ReleaseAllQubits();
+        return probs;
+    };
+
+    const double flipped = std::pow(std::sin(0.3), 2);
+    auto rx1 = run("RX", 1);
+    CHECK(rx1[1] == Catch::Approx(flipped).margin(1e-5));
+    CHECK(rx1[2] == Catch::Approx(0.0).margin(1e-5));
+    CHECK(device->GetProgramCacheSize() == 2);
+
+    auto rz0 = run("RZ", 0);
+    CHECK(rz0[0] == Catch::Approx(1.0).margin(1e-5));
+    CHECK(device->GetProgramCacheSize() == 3);
+
+    auto rx0 = run("RX", 0);
+    CHECK(rx0[2] == Catch::Approx(flipped).margin(1e-5));
+    CHECK(device->GetProgramCacheSize() == 3);
+    CHECK(device->GetProgramCacheHits() == 3);
+
+    // The least recently used programs are evicted first: fill the cache with circuits of
+    // increasing depth after using the RX circuit on wire 0 again
+    run("RX", 0);
+    CHECK(device->GetProgramCacheHits() == 4);
+    for (size_t depth = 2; device->GetProgramCacheSize() < 128; depth++) {
+        auto wires = device->AllocateQubits(2);
+        for (size_t idx = 0; idx < depth; idx++) {
+            device->NamedOperation("RX", {0.1}, {wires[0]}, false);
+        }
+        std::vector<double> probs(4);
+        DataView<double, 1> view(probs);
+        device->Probs(view);
+        device->ReleaseAllQubits();
+    }
+    CHECK(device->GetProgramCacheHits() == 4);
+
+    // The next new program evicts the RX circuit on wire 1, used the least recently
+    run("RY", 1);
+    CHECK(device->GetProgramCacheSize() == 128);
+    run("RX", 0);
+    CHECK(device->GetProgramCacheHits() == 5);
+    run("RX", 1);
+    CHECK(device->GetProgramCacheHits() == 5);
+}
+
 TEST_CASE("Test MatrixOperation with BuilderType::Braket", "[openqasm]")
 {
     std::unique_ptr<OpenQasmDevice> device =
@@ -638,6 +1091,649 @@ TEST_CASE("Test PSWAP and ISWAP with BuilderType::Braket", "[openqasm]")
     CHECK(expval == Catch::Approx(1).margin(1e-5));
 }
 
+TEST_CASE("Test measurement processes with the native backend", "[openqasm]")
+{
+    std::unique_ptr<OpenQasmDevice> device = std::make_unique<OpenQasmDevice>(
+        "{device_type : braket.local.qubit, backend : native, seed : 42}");
+    device->SetDeviceShots(0);
+
+    constexpr size_t n{3};
+    constexpr size_t size{1UL << n};
+    auto wires = device->AllocateQubits(n);
+
+    device->NamedOperation("Hadamard", {}, {wires[0]}, false);
+    device->NamedOperation("CNOT", {}, {wires[0], wires[1]}, false);
+    device->NamedOperation("RY", {0.4}, {wires[2]}, false);
+    std::vector<std::complex<double>> matrix{
+        {0, 0},
+        {1, 0},
+        {1, 0},
+        {0, 0},
+    };
+    device->MatrixOperation(matrix, {wires[1]}, false);
+
+    // |psi> = (|01> + |10>) / sqrt(2) (cos(0.2)|0> + sin(0.2)|1>)
+    const double c2 = std::pow(std::cos(0.2), 2);
+    const double s2 = std::pow(std::sin(0.2), 2);
+
+    SECTION("State")
+    {
+        std::vector<std::complex<double>> state(size);
+        DataView<std::complex<double>, 1> view(state);
+        device->State(view);
+        CHECK(state[2].real() == Catch::Approx(std::cos(0.2) / std::sqrt(2)).margin(1e-5));
+        CHECK(state[5].real() == Catch::Approx(std::sin(0.2) / std::sqrt(2)).margin(1e-5));
+        CHECK(std::abs(state[0]) == Catch::Approx(0.0).margin(1e-5));
+    }
+
+    SECTION("Probs and PartialProbs")
+    {
+        std::vector<double> probs(size);
+        DataView<double, 1> view(probs);
+        device->Probs(view);
+        CHECK(probs[2] == Catch::Approx(c2 / 2).margin(1e-5));
+        CHECK(probs[3] == Catch::Approx(s2 / 2).margin(1e-5));
+
+        std::vector<double> partial_probs(2);
+        DataView<double, 1> partial_view(partial_probs);
+        device->PartialProbs(partial_view, std::vector<QubitIdType>{wires[2]});
+        CHECK(partial_probs[0] == Catch::Approx(c2).margin(1e-5));
+        CHECK(partial_probs[1] == Catch::Approx(s2).margin(1e-5));
+    }
+
+    SECTION("Expval and Var")
+    {
+        auto z0 = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{wires[0]});
+        auto z1 = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{wires[1]});
+        auto x2 = device->Observable(ObsId::PauliX, {}, std::vector<QubitIdType>{wires[2]});
+        auto z0z1 = device->TensorObservable({z0, z1});
+        auto hamiltonian = device->HamiltonianObservable({0.5, 0.2}, {z0z1, x2});
+
+        CHECK(device->Expval(z0) == Catch::Approx(0.0).margin(1e-5));
+        CHECK(device->Expval(z0z1) == Catch::Approx(-1.0).margin(1e-5));
+        CHECK(device->Expval(x2) == Catch::Approx(std::sin(0.4)).margin(1e-5));
+        CHECK(device->Expval(hamiltonian) ==
+              Catch::Approx(-0.5 + 0.2 * std::sin(0.4)).margin(1e-5));
+        CHECK(device->Var(z0) == Catch::Approx(1.0).margin(1e-5));
+        CHECK(device->Var(z0z1) == Catch::Approx(0.0).margin(1e-5));
+
+        device->SetDeviceShots(10000);
+        CHECK(device->Expval(hamiltonian) ==
+              Catch::Approx(-0.5 + 0.2 * std::sin(0.4)).margin(5e-2));
+    }
+
+    SECTION("Samples and Counts")
+    {
+        constexpr size_t shots{1000};
+        device->SetDeviceShots(shots);
+
+        std::vector<double> samples(shots * n);
+        MemRefT<double, 2> buffer{samples.data(), samples.data(), 0, {shots, n}, {n, 1}};
+        DataView<double, 2> view(buffer.data_aligned, buffer.offset, buffer.sizes, buffer.strides);
+        device->Sample(view);
+        for (size_t shot = 0; shot < shots; shot++) {
+            // The first two qubits are anti-correlated
+            CHECK(samples[shot * n] + samples[shot * n + 1] == 1.0);
+        }
+
+        std::vector<double> eigvals(size);
+        std::vector<int64_t> counts(size);
+        DataView<double, 1> eview(eigvals);
+        DataView<int64_t, 1> cview(counts);
+        device->Counts(eview, cview);
+        CHECK(counts[2] + counts[3] + counts[4] + counts[5] == static_cast<int64_t>(shots));
+    }
+}
+
+TEST_CASE("Test packed samples", "[openqasm]")
+{
+    CHECK(OpenQasm::packSamples({1, 0, 1, 0, 1, 1}, 2, 3) == std::vector<uint64_t>{5, 3});
+    CHECK(OpenQasm::packSamples({}, 0, 3).empty());
+
+    REQUIRE_THROWS_WITH(OpenQasm::packSamples({1, 0}, 2, 3),
+                        ContainsSubstring("Invalid number of samples to pack"));
+    REQUIRE_THROWS_WITH(OpenQasm::packSamples({}, 0, 65),
+                        ContainsSubstring("Unable to pack the samples of more than 64 qubits"));
+
+    OpenQasm::BraketBuilder builder{};
+    builder.Register(OpenQasm::RegisterType::Qubit, "q", 3);
+    builder.Gate("Hadamard", {}, {}, {0}, false);
+    builder.Gate("CNOT", {}, {}, {0, 2}, false);
+    builder.Gate("RX", {0.7}, {}, {1}, false);
+    const std::string circuit = builder.toOpenQasm(0);
+
+    // Runners with the same seed draw the same samples, packed or not.
+    OpenQasm::NativeRunner runner{7};
+    OpenQasm::NativeRunner packed_runner{7};
+    auto &&samples = runner.Sample(circuit, "", 100, 3);
+    auto &&packed = packed_runner.PackedSample(circuit, "", 100, 3);
+    CHECK(packed == OpenQasm::packSamples(samples, 100, 3));
+    for (auto state : packed) {
+        // The first and last qubits are correlated
+        CHECK((state >> 2) == (state & 1U));
+    }
+
+    REQUIRE_THROWS_WITH(runner.PackedSample(circuit, "", 0, 3),
+                        ContainsSubstring("The number of shots must be positive"));
+}
+
+TEST_CASE("Test Counts, PartialCounts and PartialSample from packed samples", "[openqasm]")
+{
+    std::unique_ptr<OpenQasmDevice> device = std::make_unique<OpenQasmDevice>(
+        "{device_type : braket.local.qubit, backend : native, seed : 11}");
+
+    constexpr size_t n{3};
+    constexpr size_t shots{200};
+    device->SetDeviceShots(shots);
+    auto wires = device->AllocateQubits(n);
+
+    // |psi> = |1> (|0> + |1>) / sqrt(2) |1>
+    device->NamedOperation("PauliX", {}, {wires[0]}, false);
+    device->NamedOperation("Hadamard", {}, {wires[1]}, false);
+    device->NamedOperation("PauliX", {}, {wires[2]}, false);
+
+    SECTION("Counts")
+    {
+        std::vector<double> eigvals(1UL << n);
+        std::vector<int64_t> counts(1UL << n);
+        DataView<double, 1> eview(eigvals);
+        DataView<int64_t, 1> cview(counts);
+        device->Counts(eview, cview);
+
+        CHECK(eigvals == std::vector<double>{0, 1, 2, 3, 4, 5, 6, 7});
+        CHECK(counts[5] > 0);
+        CHECK(counts[7] > 0);
+        CHECK(counts[5] + counts[7] == static_cast<int64_t>(shots));
+    }
+
+    SECTION("PartialCounts")
+    {
+        std::vector<double> eigvals(4);
+        std::vector<int64_t> counts(4);
+        DataView<double, 1> eview(eigvals);
+        DataView<int64_t, 1> cview(counts);
+
+        // A leading range of wires
+        device->PartialCounts(eview, cview, std::vector<QubitIdType>{wires[0], wires[1]});
+        CHECK(eigvals == std::vector<double>{0, 1, 2, 3});
+        CHECK(counts[0] == 0);
+        CHECK(counts[1] == 0);
+        CHECK(counts[2] + counts[3] == static_cast<int64_t>(shots));
+
+        // Any other wires
+        device->PartialCounts(eview, cview, std::vector<QubitIdType>{wires[2], wires[0]});
+        CHECK(counts == std::vector<int64_t>{0, 0, 0, shots});
+
+        device->PartialCounts(eview, cview, std::vector<QubitIdType>{wires[1], wires[2]});
+        CHECK(counts[0] == 0);
+        CHECK(counts[2] == 0);
+        CHECK(counts[1] + counts[3] == static_cast<int64_t>(shots));
+    }
+
+    SECTION("PartialSample")
+    {
+        constexpr size_t k{2};
+        std::vector<double> samples(shots * k);
+        MemRefT<double, 2> buffer{samples.data(), samples.data(), 0, {shots, k}, {k, 1}};
+        DataView<double, 2> view(buffer.data_aligned, buffer.offset, buffer.sizes, buffer.strides);
+        device->PartialSample(view, std::vector<QubitIdType>{wires[2], wires[1]});
+
+        size_t num_ones{0};
+        for (size_t shot = 0; shot < shots; shot++) {
+            CHECK(samples[shot * k] == 1.0);
+            num_ones += static_cast<size_t>(samples[shot * k + 1]);
+        }
+        CHECK(num_ones > 0);
+        CHECK(num_ones < shots);
+    }
+}
+
+/**
+ * A local mock runner, which returns the size of the circuit and the number of shots after a
+ * fixed latency, and records the maximum number of jobs in flight.
+ */
+struct MockRunner final : public OpenQasm::OpenQasmRunner {
+    mutable std::atomic<size_t> in_flight{0};
+    mutable std::atomic<size_t> max_in_flight{0};
+
+    [[nodiscard]] auto Values(const std::string &circuit,
+                              [[maybe_unused]] const std::string &device, size_t shots,
+                              [[maybe_unused]] const std::string &kwargs = "",
+                              [[maybe_unused]] const std::string &inputs = "") const
+        -> std::vector<double> override
+    {
+        RT_FAIL_IF(circuit.empty(), "Empty circuit");
+
+        const size_t current = ++in_flight;
+        size_t expected = max_in_flight.load();
+        while (current > expected && !max_in_flight.compare_exchange_weak(expected, current)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        in_flight--;
+
+        return {static_cast<double>(circuit.size()), static_cast<double>(shots)};
+    }
+};
+
+TEST_CASE("Test QasmJob", "[openqasm]")
+{
+    OpenQasm::QasmJob invalid{};
+    CHECK(!invalid.isValid());
+    REQUIRE_THROWS_WITH(invalid.isReady(), ContainsSubstring("Invalid OpenQasm job"));
+    REQUIRE_THROWS_WITH(invalid.getValues(), ContainsSubstring("Invalid OpenQasm job"));
+
+    auto &&job = OpenQasm::QasmJob::fromValues({1.0, 2.0});
+    CHECK(job.isValid());
+    CHECK(job.isReady());
+    CHECK(job.getValues() == std::vector<double>{1.0, 2.0});
+
+    // Copies share the same job
+    auto copy = job;
+    CHECK(&copy.getValues() == &job.getValues());
+
+    // Deferred jobs report the completion of the work they poll, without running
+    size_t runs = 0;
+    bool done = false;
+    bool released = false;
+    {
+        auto guard = std::shared_ptr<void>(nullptr, [&released](void *) { released = true; });
+        auto &&deferred = OpenQasm::QasmJob{
+            std::async(std::launch::deferred,
+                       [&runs, guard]() {
+                           runs++;
+                           return std::vector<double>{3.0};
+                       })
+                .share(),
+            [&done, guard]() { return done; }};
+        auto deferred_copy = deferred;
+        CHECK(!deferred.isReady());
+        done = true;
+        CHECK(deferred_copy.isReady());
+        CHECK(runs == 0);
+        CHECK(deferred.getValues() == std::vector<double>{3.0});
+        CHECK(runs == 1);
+        CHECK(!released);
+    }
+    // The state captured by the job is released with its last copy
+    CHECK(released);
+}
+
+TEST_CASE("Test asynchronous jobs with a mock runner", "[openqasm]")
+{
+    auto runner = std::make_shared<MockRunner>();
+
+    std::vector<OpenQasm::QasmJob> jobs;
+    for (size_t idx = 1; idx <= 4; idx++) {
+        jobs.push_back(runner->SubmitValues(std::string(idx, 'x'), "mock", idx * 10));
+    }
+
+    for (size_t idx = 1; idx <= 4; idx++) {
+        auto &&values = jobs[idx - 1].getValues();
+        CHECK(values == std::vector<double>{static_cast<double>(idx), idx * 10.0});
+        CHECK(jobs[idx - 1].isReady());
+    }
+
+    // The jobs were in flight concurrently
+    CHECK(runner->max_in_flight > 1);
+    CHECK(runner->in_flight == 0);
+
+    // Errors are reported when the values are requested
+    auto &&failed = runner->SubmitValues("", "mock", 0);
+    REQUIRE_THROWS_WITH(failed.getValues(), ContainsSubstring("Empty circuit"));
+
+    // The jobs keep their runner alive
+    auto owner = std::make_shared<MockRunner>();
+    std::weak_ptr<MockRunner> weak_runner = owner;
+    auto pending = owner->SubmitValues("xyz", "mock", 5);
+    owner.reset();
+    CHECK(!weak_runner.expired());
+    CHECK(pending.getValues() == std::vector<double>{3.0, 5.0});
+    pending = OpenQasm::QasmJob{};
+    CHECK(weak_runner.expired());
+
+    // Runners that are not shared execute the program before returning the job
+    MockRunner unshared{};
+    auto &&executed = unshared.SubmitValues("xy", "mock", 1);
+    CHECK(executed.isReady());
+    CHECK(executed.getValues() == std::vector<double>{2.0, 1.0});
+    REQUIRE_THROWS_WITH(unshared.SubmitValues("", "mock", 0).getValues(),
+                        ContainsSubstring("Empty circuit"));
+
+    OpenQasm::OpenQasmRunner base{};
+    REQUIRE_THROWS_WITH(base.SubmitValues("", "", 0).getValues(),
+                        ContainsSubstring("Not implemented method"));
+}
+
+TEST_CASE("Test asynchronous deferred measurements", "[openqasm]")
+{
+    const std::string kwargs = "{device_type : braket.local.qubit, backend : native, seed : 3}";
+
+    // Devices sharing the same configuration, e.g. of several qnodes
+    std::vector<std::unique_ptr<OpenQasmDevice>> devices;
+    std::vector<size_t> job_ids;
+    for (size_t idx = 0; idx < 3; idx++) {
+        auto &device = devices.emplace_back(std::make_unique<OpenQasmDevice>(kwargs));
+        auto wires = device->AllocateQubits(2);
+        device->NamedOperation("RX", {0.1 * static_cast<double>(idx + 1)}, {wires[0]}, false);
+        device->NamedOperation("CNOT", {}, {wires[0], wires[1]}, false);
+
+        auto z1 = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{wires[1]});
+        auto x1 = device->Observable(ObsId::PauliX, {}, std::vector<QubitIdType>{wires[1]});
+        device->DeferExpval(z1);
+        device->DeferVar(x1);
+        job_ids.push_back(device->SubmitDeferred());
+        CHECK(device->GetNumPendingJobs() == 1);
+
+        // Operations applied after the submission don't change the submitted job.
+        device->NamedOperation("PauliX", {}, {wires[1]}, false);
+    }
+
+    for (size_t idx = 0; idx < 3; idx++) {
+        auto &device = devices[idx];
+        auto &&results = device->CollectDeferred(job_ids[idx]);
+        REQUIRE(results.size() == 2);
+        CHECK(results[0] == Catch::Approx(std::cos(0.1 * static_cast<double>(idx + 1))));
+        CHECK(results[1] == Catch::Approx(1.0));
+        CHECK(device->GetNumPendingJobs() == 0);
+
+        REQUIRE_THROWS_WITH(device->CollectDeferred(job_ids[idx]),
+                            ContainsSubstring("Invalid job id of the deferred measurements"));
+        REQUIRE_THROWS_WITH(device->IsDeferredReady(job_ids[idx]),
+                            ContainsSubstring("Invalid job id of the deferred measurements"));
+    }
+
+    SECTION("Several groups of a shot-based batch are in flight at once")
+    {
+        auto &device = devices[0];
+        device->SetDeviceShots(1000);
+        auto wires = std::vector<QubitIdType>{0, 1};
+        auto z0 = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{wires[0]});
+        auto x0 = device->Observable(ObsId::PauliX, {}, std::vector<QubitIdType>{wires[0]});
+        device->DeferExpval(z0);
+        device->DeferExpval(x0);
+
+        auto job_id = device->SubmitDeferred();
+        auto &&results = device->CollectDeferred(job_id);
+        REQUIRE(results.size() == 2);
+        CHECK(results[0] == Catch::Approx(std::cos(0.1)).margin(1e-1));
+        CHECK(results[1] == Catch::Approx(0.0).margin(1e-1));
+    }
+
+    SECTION("Synchronous execution")
+    {
+        auto &device = devices[1];
+        auto z1 = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{1});
+        device->DeferExpval(z1);
+        auto &&results = device->ExecuteDeferred();
+        REQUIRE(results.size() == 1);
+        CHECK(results[0] == Catch::Approx(-std::cos(0.2)));
+        CHECK(device->GetNumPendingJobs() == 0);
+    }
+}
+
+TEST_CASE("Test the peephole stage of OpenQasmDevice", "[openqasm]")
+{
+    auto run = [](const std::string &kwargs) {
+        auto device = std::make_unique<OpenQasmDevice>(kwargs);
+        auto wires = device->AllocateQubits(2);
+        device->NamedOperation("Hadamard", {}, {wires[0]}, false);
+        device->NamedOperation("PauliX", {}, {wires[1]}, false);
+        device->NamedOperation("PauliX", {}, {wires[1]}, false);
+        device->NamedOperation("RY", {0.2}, {wires[1]}, false);
+        device->NamedOperation("RY", {0.3}, {wires[1]}, false);
+        device->NamedOperation("CNOT", {}, {wires[0], wires[1]}, false);
+        device->NamedOperation("Identity", {}, {wires[0]}, false);
+
+        std::vector<std::complex<double>> state(4);
+        DataView<std::complex<double>, 1> view(state);
+        device->State(view);
+        return std::make_tuple(device->Circuit(), device->GetPeepholeStats(), state);
+    };
+
+    auto &&[circuit, stats, state] =
+        run("{device_type : braket.local.qubit, backend : native, peephole : True}");
+    CHECK(circuit == "OPENQASM 3.0;\n"
+                     "qubit[2] qubits;\n"
+                     "bit[2] bits;\n"
+                     "h qubits[0];\n"
+                     "ry(0.5) qubits[1];\n"
+                     "cnot qubits[0], qubits[1];\n"
+                     "bits = measure qubits;\n");
+    CHECK(stats.num_gates_in == 7);
+    CHECK(stats.num_gates_out == 3);
+    CHECK(stats.num_cancelled == 2);
+    CHECK(stats.num_merged == 1);
+    CHECK(stats.num_dropped == 1);
+
+    // The compressed circuit prepares the same state.
+    auto &&[plain_circuit, plain_stats, plain_state] =
+        run("{device_type : braket.local.qubit, backend : native}");
+    CHECK(plain_stats.getDelta() == 0);
+    CHECK(plain_circuit.size() > circuit.size());
+    for (size_t idx = 0; idx < state.size(); idx++) {
+        CHECK(std::abs(state[idx] - plain_state[idx]) < 1e-12);
+    }
+}
+
+TEST_CASE("Test writing the results directly into DataViews", "[openqasm]")
+{
+    std::vector<double> buffer(12);
+    size_t sizes[2] = {3, 4};
+
+    size_t row_major[2] = {4, 1};
+    CHECK(DataView<double, 2>(buffer.data(), 0, sizes, row_major).isContiguous());
+    size_t column_major[2] = {1, 3};
+    CHECK(!DataView<double, 2>(buffer.data(), 0, sizes, column_major).isContiguous());
+    CHECK(DataView<double, 1>(buffer).isContiguous());
+    CHECK(DataView<double, 2>(buffer.data(), 2, sizes, row_major).data() == buffer.data() + 2);
+
+    const std::string kwargs = "{device_type : braket.local.qubit, backend : native, seed : 5}";
+    auto run = [&kwargs](auto &&measure) {
+        auto device = std::make_unique<OpenQasmDevice>(kwargs);
+        auto wires = device->AllocateQubits(2);
+        device->NamedOperation("RX", {0.8}, {wires[0]}, false);
+        device->NamedOperation("CNOT", {}, {wires[0], wires[1]}, false);
+        measure(*device, wires);
+    };
+
+    SECTION("Probs and PartialProbs")
+    {
+        std::vector<double> probs(4);
+        std::vector<double> partial_probs(2);
+        run([&](OpenQasmDevice &device, const std::vector<QubitIdType> &wires) {
+            DataView<double, 1> view(probs);
+            device.Probs(view);
+
+            DataView<double, 1> partial_view(partial_probs);
+            device.PartialProbs(partial_view, std::vector<QubitIdType>{wires[1]});
+        });
+        CHECK(probs[0] == Catch::Approx(std::pow(std::cos(0.4), 2)));
+        CHECK(probs[3] == Catch::Approx(std::pow(std::sin(0.4), 2)));
+        CHECK(partial_probs[1] == Catch::Approx(std::pow(std::sin(0.4), 2)));
+
+        // Strided views are filled element by element.
+        std::vector<double> strided(8, -1.0);
+        run([&](OpenQasmDevice &device, [[maybe_unused]] const std::vector<QubitIdType> &wires) {
+            size_t size = 4;
+            size_t stride = 2;
+            DataView<double, 1> view(strided.data(), 0, &size, &stride);
+            device.Probs(view);
+        });
+        for (size_t idx = 0; idx < 4; idx++) {
+            CHECK(strided[2 * idx] == Catch::Approx(probs[idx]));
+            CHECK(strided[2 * idx + 1] == -1.0);
+        }
+    }
+
+    SECTION("Sample")
+    {
+        constexpr size_t shots{100};
+        std::vector<double> samples(shots * 2);
+        std::vector<double> transposed(shots * 2);
+        size_t sample_sizes[2] = {shots, 2};
+        run([&](OpenQasmDevice &device, [[maybe_unused]] const std::vector<QubitIdType> &wires) {
+            device.SetDeviceShots(shots);
+            size_t strides[2] = {2, 1};
+            DataView<double, 2> view(samples.data(), 0, sample_sizes, strides);
+            device.Sample(view);
+        });
+        run([&](OpenQasmDevice &device, [[maybe_unused]] const std::vector<QubitIdType> &wires) {
+            device.SetDeviceShots(shots);
+            size_t strides[2] = {1, shots};
+            DataView<double, 2> view(transposed.data(), 0, sample_sizes, strides);
+            device.Sample(view);
+        });
+
+        // Devices with the same seed draw the same samples, whichever path writes them.
+        for (size_t shot = 0; shot < shots; shot++) {
+            CHECK(samples[shot * 2] == samples[shot * 2 + 1]);
+            CHECK(samples[shot * 2] == transposed[shot]);
+            CHECK(samples[shot * 2 + 1] == transposed[shots + shot]);
+        }
+    }
+}
+
+/**
+ * A runner of samples with a known bit per shot and wire, for circuits of any number of qubits.
+ */
+struct MockSampleRunner final : public OpenQasm::OpenQasmRunner {
+    static auto getBit(size_t shot, size_t wire) -> size_t { return (shot + wire) % 3 == 0; }
+
+    [[nodiscard]] auto Sample([[maybe_unused]] const std::string &circuit,
+                              [[maybe_unused]] const std::string &device, size_t shots,
+                              size_t num_qubits, [[maybe_unused]] const std::string &kwargs = "",
+                              [[maybe_unused]] const std::string &inputs = "") const
+        -> std::vector<size_t> override
+    {
+        std::vector<size_t> samples(shots * num_qubits);
+        for (size_t shot = 0; shot < shots; shot++) {
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                samples[shot * num_qubits + wire] = getBit(shot, wire);
+            }
+        }
+        return samples;
+    }
+};
+
+TEST_CASE("Test the samples of more than 64 qubits", "[openqasm]")
+{
+    constexpr size_t num_qubits{70};
+    constexpr size_t shots{6};
+
+    OpenQasmDevice device("{device_type : braket.local.qubit, backend : native}");
+    device.SetRunner(std::make_unique<MockSampleRunner>());
+    auto wires = device.AllocateQubits(num_qubits);
+    device.SetDeviceShots(shots);
+    device.NamedOperation("Hadamard", {}, {wires[0]}, false);
+
+    SECTION("Sample")
+    {
+        // Contiguous and transposed views
+        std::vector<double> samples(shots * num_qubits);
+        std::vector<double> transposed(shots * num_qubits);
+        size_t sizes[2] = {shots, num_qubits};
+        size_t row_major[2] = {num_qubits, 1};
+        size_t column_major[2] = {1, shots};
+        DataView<double, 2> view(samples.data(), 0, sizes, row_major);
+        DataView<double, 2> transposed_view(transposed.data(), 0, sizes, column_major);
+        device.Sample(view);
+        device.Sample(transposed_view);
+
+        for (size_t shot = 0; shot < shots; shot++) {
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                const auto bit = static_cast<double>(MockSampleRunner::getBit(shot, wire));
+                CHECK(samples[shot * num_qubits + wire] == bit);
+                CHECK(transposed[wire * shots + shot] == bit);
+            }
+        }
+    }
+
+    SECTION("PartialSample")
+    {
+        const std::vector<QubitIdType> partial_wires{wires[68], wires[1], wires[66]};
+        std::vector<double> samples(shots * partial_wires.size());
+        size_t sizes[2] = {shots, partial_wires.size()};
+        size_t strides[2] = {partial_wires.size(), 1};
+        DataView<double, 2> view(samples.data(), 0, sizes, strides);
+        device.PartialSample(view, partial_wires);
+
+        for (size_t shot = 0; shot < shots; shot++) {
+            CHECK(samples[shot * 3] == static_cast<double>(MockSampleRunner::getBit(shot, 68)));
+            CHECK(samples[shot * 3 + 1] == static_cast<double>(MockSampleRunner::getBit(shot, 1)));
+            CHECK(samples[shot * 3 + 2] ==
+                  static_cast<double>(MockSampleRunner::getBit(shot, 66)));
+        }
+    }
+
+    SECTION("PartialCounts")
+    {
+        std::vector<double> eigvals(4);
+        std::vector<int64_t> counts(4);
+        DataView<double, 1> eigvals_view(eigvals);
+        DataView<int64_t, 1> counts_view(counts);
+        device.PartialCounts(eigvals_view, counts_view, {wires[69], wires[2]});
+
+        std::vector<int64_t> expected(4, 0);
+        for (size_t shot = 0; shot < shots; shot++) {
+            expected[MockSampleRunner::getBit(shot, 69) << 1 | MockSampleRunner::getBit(shot, 2)]++;
+        }
+        CHECK(eigvals == std::vector<double>{0, 1, 2, 3});
+        CHECK(counts == expected);
+    }
+
+    SECTION("Counts")
+    {
+        std::vector<double> eigvals(4);
+        std::vector<int64_t> counts(4);
+        DataView<double, 1> eigvals_view(eigvals);
+        DataView<int64_t, 1> counts_view(counts);
+        REQUIRE_THROWS_WITH(
+            device.Counts(eigvals_view, counts_view),
+            ContainsSubstring("Unable to count the samples of more than 64 qubits"));
+    }
+}
+
+TEST_CASE("Test the result cache of OpenQasmDevice", "[openqasm]")
+{
+    auto &&dir = std::filesystem::temp_directory_path() /
+                 ("catalyst_qasm_device_cache_" + std::to_string(std::random_device{}()));
+    const std::string kwargs = "{device_type : braket.local.qubit, backend : native, "
+                               "result_cache_size : 8, result_cache_dir : " +
+                               dir.string() + "}";
+
+    auto run = [&kwargs](size_t shots) {
+        auto device = std::make_unique<OpenQasmDevice>(kwargs);
+        device->SetDeviceShots(shots);
+        auto wires = device->AllocateQubits(2);
+        device->NamedOperation("RX", {0.3}, {wires[0]}, false);
+        device->NamedOperation("CNOT", {}, {wires[0], wires[1]}, false);
+
+        auto obs = device->Observable(ObsId::PauliZ, {}, std::vector<QubitIdType>{wires[1]});
+        std::vector<double> probs(4);
+        DataView<double, 1> view(probs);
+        device->Probs(view);
+        return std::make_pair(device->Expval(obs), probs);
+    };
+
+    // Analytic results are stored on disk, and shared by the following devices.
+    auto &&[expval, probs] = run(0);
+    CHECK(expval == Catch::Approx(std::cos(0.3)).margin(1e-5));
+    const auto num_entries = std::distance(std::filesystem::directory_iterator(dir),
+                                           std::filesystem::directory_iterator{});
+    CHECK(num_entries == 2);
+
+    auto &&[cached_expval, cached_probs] = run(0);
+    CHECK(cached_expval == expval);
+    CHECK(cached_probs == probs);
+
+    // Shot-based results are never cached.
+    run(100);
+    CHECK(std::distance(std::filesystem::directory_iterator(dir),
+                        std::filesystem::directory_iterator{}) == num_entries);
+
+    std::filesystem::remove_all(dir);
+}
+
 TEST_CASE("Test MatrixOperation with OpenQasmDevice and BuilderType::Common", "[openqasm]")
 {
     auto device = OpenQasmDevice("{}");
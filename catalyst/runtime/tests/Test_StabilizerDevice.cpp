@@ -0,0 +1,204 @@
+// Copyright 2025 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <numbers>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "StabilizerDevice.hpp"
+
+using namespace Catch::Matchers;
+using namespace Catalyst::Runtime::Devices;
+
+TEST_CASE("Test StabilizerDevice samples of a large GHZ state", "[stabilizer]")
+{
+    constexpr size_t num_qubits = 1000;
+    constexpr size_t shots = 100;
+
+    StabilizerDevice device("{'seed': 42}");
+    auto qubits = device.AllocateQubits(num_qubits);
+    CHECK(device.GetNumQubits() == num_qubits);
+
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    for (size_t i = 1; i < num_qubits; i++) {
+        device.NamedOperation("CNOT", {}, {qubits[i - 1], qubits[i]});
+    }
+
+    device.SetDeviceShots(shots);
+    std::vector<double> samples(shots * num_qubits);
+    size_t sizes[2] = {shots, num_qubits};
+    size_t strides[2] = {num_qubits, 1};
+    DataView<double, 2> samples_view(samples.data(), 0, sizes, strides);
+    device.Sample(samples_view);
+
+    size_t num_ones = 0;
+    for (size_t shot = 0; shot < shots; shot++) {
+        const double first = samples[shot * num_qubits];
+        num_ones += first == 1.0;
+        bool all_equal = true;
+        for (size_t i = 1; i < num_qubits; i++) {
+            all_equal = all_equal && samples[shot * num_qubits + i] == first;
+        }
+        CHECK(all_equal);
+    }
+    CHECK(num_ones > 0);
+    CHECK(num_ones < shots);
+
+    // Sampling doesn't change the state
+    const bool first = *device.Measure(qubits[0]);
+    CHECK(*device.Measure(qubits[num_qubits - 1]) == first);
+}
+
+TEST_CASE("Test StabilizerDevice counts", "[stabilizer]")
+{
+    constexpr size_t shots = 1000;
+
+    StabilizerDevice device("{'seed': 7}");
+    auto qubits = device.AllocateQubits(4);
+    device.SetDeviceShots(shots);
+
+    // The outcomes are uniform over q0 q1 q2 q3 = a b b 1
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    device.NamedOperation("Hadamard", {}, {qubits[1]});
+    device.NamedOperation("CNOT", {}, {qubits[1], qubits[2]});
+    device.NamedOperation("PauliX", {}, {qubits[3]});
+
+    std::vector<double> eigvals(16);
+    std::vector<int64_t> counts(16);
+    DataView<double, 1> eigvals_view(eigvals);
+    DataView<int64_t, 1> counts_view(counts);
+    device.Counts(eigvals_view, counts_view);
+
+    int64_t total = 0;
+    for (size_t state = 0; state < 16; state++) {
+        CHECK(eigvals[state] == static_cast<double>(state));
+        const bool reachable = (state & 1U) && (((state >> 1) & 1U) == ((state >> 2) & 1U));
+        if (reachable) {
+            CHECK(counts[state] > 150);
+        }
+        else {
+            CHECK(counts[state] == 0);
+        }
+        total += counts[state];
+    }
+    CHECK(total == shots);
+
+    // q3 q2 = 1 b
+    std::vector<double> partial_eigvals(4);
+    std::vector<int64_t> partial_counts(4);
+    DataView<double, 1> partial_eigvals_view(partial_eigvals);
+    DataView<int64_t, 1> partial_counts_view(partial_counts);
+    device.PartialCounts(partial_eigvals_view, partial_counts_view, {qubits[3], qubits[2]});
+    CHECK(partial_counts[0] == 0);
+    CHECK(partial_counts[1] == 0);
+    CHECK(partial_counts[2] + partial_counts[3] == shots);
+
+    std::vector<double> samples(shots * 2);
+    size_t sizes[2] = {shots, 2};
+    size_t strides[2] = {2, 1};
+    DataView<double, 2> samples_view(samples.data(), 0, sizes, strides);
+    device.PartialSample(samples_view, {qubits[2], qubits[1]});
+    for (size_t shot = 0; shot < shots; shot++) {
+        CHECK(samples[2 * shot] == samples[2 * shot + 1]);
+    }
+
+    std::vector<double> eigvals_small(4);
+    DataView<double, 1> eigvals_small_view(eigvals_small);
+    REQUIRE_THROWS_WITH(device.Counts(eigvals_small_view, counts_view),
+                        ContainsSubstring("Invalid size for the pre-allocated counts"));
+}
+
+TEST_CASE("Test StabilizerDevice Pauli expectation values", "[stabilizer]")
+{
+    StabilizerDevice device;
+    auto qubits = device.AllocateQubits(3);
+
+    // A Bell state on q0 q1, and |-> on q2
+    device.NamedOperation("Hadamard", {}, {qubits[0]});
+    device.NamedOperation("CNOT", {}, {qubits[0], qubits[1]});
+    device.NamedOperation("PauliX", {}, {qubits[2]});
+    device.NamedOperation("RY", {std::numbers::pi / 2}, {qubits[2]});
+
+    auto x0 = device.Observable(ObsId::PauliX, {}, {qubits[0]});
+    auto x1 = device.Observable(ObsId::PauliX, {}, {qubits[1]});
+    auto y0 = device.Observable(ObsId::PauliY, {}, {qubits[0]});
+    auto y1 = device.Observable(ObsId::PauliY, {}, {qubits[1]});
+    auto z0 = device.Observable(ObsId::PauliZ, {}, {qubits[0]});
+    auto z1 = device.Observable(ObsId::PauliZ, {}, {qubits[1]});
+    auto x2 = device.Observable(ObsId::PauliX, {}, {qubits[2]});
+    auto id = device.Observable(ObsId::Identity, {}, {qubits[2]});
+
+    auto xx = device.TensorObservable({x0, x1});
+    auto yy = device.TensorObservable({y0, y1});
+    auto zz = device.TensorObservable({z0, z1});
+    auto xy = device.TensorObservable({x0, y1});
+
+    CHECK(device.Expval(xx) == Catch::Approx(1.0));
+    CHECK(device.Expval(yy) == Catch::Approx(-1.0));
+    CHECK(device.Expval(zz) == Catch::Approx(1.0));
+    CHECK(device.Expval(xy) == Catch::Approx(0.0));
+    CHECK(device.Expval(z0) == Catch::Approx(0.0));
+    CHECK(device.Expval(x2) == Catch::Approx(-1.0));
+    CHECK(device.Expval(id) == Catch::Approx(1.0));
+
+    CHECK(device.Var(z0) == Catch::Approx(1.0));
+    CHECK(device.Var(zz) == Catch::Approx(0.0));
+
+    auto ham = device.HamiltonianObservable({0.5, 2.0, 3.0}, {xx, zz, x2});
+    CHECK(device.Expval(ham) == Catch::Approx(-0.5));
+    REQUIRE_THROWS_WITH(device.Var(ham), ContainsSubstring("Unsupported observable"));
+    REQUIRE_THROWS_WITH(device.TensorObservable({x0, z0}), ContainsSubstring("sharing wires"));
+    REQUIRE_THROWS_WITH(device.Observable(ObsId::Hermitian, {}, {qubits[0]}),
+                        ContainsSubstring("only supports Pauli observables"));
+    REQUIRE_THROWS_WITH(device.Expval(100), ContainsSubstring("Invalid key"));
+}
+
+TEST_CASE("Test StabilizerDevice gates and measurements", "[stabilizer]")
+{
+    StabilizerDevice device("{'seed': 3}");
+    auto qubits = device.AllocateQubits(2);
+
+    // RX(pi)|0> = -i|1>
+    device.NamedOperation("RX", {std::numbers::pi}, {qubits[0]});
+    CHECK(*device.Measure(qubits[0]) == true);
+
+    // CY|10> = i|11>, and S^dagger S = I
+    device.NamedOperation("CY", {}, {qubits[0], qubits[1]});
+    device.NamedOperation("S", {}, {qubits[1]});
+    device.NamedOperation("S", {}, {qubits[1]}, true);
+    CHECK(*device.Measure(qubits[1]) == true);
+
+    // SWAP and a Hadamard on |01>
+    device.NamedOperation("PauliX", {}, {qubits[0]});
+    device.NamedOperation("SWAP", {}, {qubits[0], qubits[1]});
+    CHECK(*device.Measure(qubits[0]) == true);
+    CHECK(*device.Measure(qubits[1]) == false);
+
+    device.NamedOperation("Hadamard", {}, {qubits[1]});
+    CHECK(*device.Measure(qubits[1], 1) == true);
+    CHECK(*device.Measure(qubits[1]) == true);
+
+    REQUIRE_THROWS_WITH(device.Measure(qubits[1], 0), ContainsSubstring("postselect value is 0"));
+    REQUIRE_THROWS_WITH(device.NamedOperation("RZ", {0.1}, {qubits[0]}),
+                        ContainsSubstring("Clifford rotation angles"));
+    REQUIRE_THROWS_WITH(device.NamedOperation("T", {}, {qubits[0]}),
+                        ContainsSubstring("Unsupported gate"));
+    REQUIRE_THROWS_WITH(device.NamedOperation("CNOT", {}, {qubits[0]}),
+                        ContainsSubstring("Invalid number of wires"));
+
+    device.ReleaseAllQubits();
+    CHECK(device.GetNumQubits() == 0);
+}